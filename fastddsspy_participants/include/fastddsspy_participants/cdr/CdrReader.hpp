@@ -0,0 +1,152 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <fastddsspy_participants/cdr/TypeLayout.hpp>
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+namespace cdr {
+
+/**
+ * @brief Minimal reader of a serialized CDR payload
+ *
+ * Reads plain (non parameter list) XCDR1 and XCDR2 payloads in either endianness, taking care of alignment.
+ * Every read checks the payload bounds and returns false instead of reading past the end.
+ */
+class CdrReader
+{
+public:
+
+    //! Size of the encapsulation header that precedes the serialized data
+    static constexpr std::size_t ENCAPSULATION_SIZE = 4;
+
+    /**
+     * @brief Start reading a new payload
+     *
+     * @param data Payload, starting with the encapsulation header
+     * @param size Size of the payload
+     * @return false if the payload is too short or its encapsulation is not supported
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool reset(
+            const uint8_t* data,
+            std::size_t size) noexcept;
+
+    //! Whether the payload uses XCDR2 rules (DHEADERs, alignment up to 4 bytes)
+    bool xcdr2() const noexcept
+    {
+        return xcdr2_;
+    }
+
+    //! Current position in the payload
+    std::size_t position() const noexcept
+    {
+        return position_;
+    }
+
+    //! Move to an absolute position in the payload, previously returned by \c position
+    void seek(
+            std::size_t position) noexcept
+    {
+        position_ = position;
+    }
+
+    //! Size of the payload
+    std::size_t size() const noexcept
+    {
+        return size_;
+    }
+
+    //! Move to the next position aligned to \c alignment bytes (capped to the encoding maximum alignment)
+    bool align(
+            std::size_t alignment) noexcept;
+
+    /**
+     * @brief Read an aligned primitive of type \c T
+     *
+     * \c T must be a boolean, an integer or a floating point type.
+     */
+    template <typename T>
+    bool read(
+            T& value) noexcept;
+
+    /**
+     * @brief Read a string without copying it
+     *
+     * @param chars Set to the first character of the string inside the payload
+     * @param length Set to the number of characters, without the null terminator
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool read_string(
+            const char*& chars,
+            uint32_t& length) noexcept;
+
+    /**
+     * @brief Skip \c count primitives of \c element_size bytes
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool skip(
+            std::size_t element_size,
+            std::size_t count) noexcept;
+
+    //! Move after a value of \c layout without reading it
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool skip_value(
+            const TypeLayout& layout) noexcept;
+
+    /**
+     * @brief Read the DHEADER of a delimited value, if the encoding uses it
+     *
+     * @param end Set to the position right after the value, or 0 if the value is not delimited
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool read_delimiter(
+            bool delimited,
+            std::size_t& end) noexcept;
+
+    //! Move to the end of a delimited value, skipping members unknown to the reader type
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool close_delimiter(
+            std::size_t end) noexcept;
+
+protected:
+
+    const uint8_t* data_ {nullptr};
+
+    std::size_t size_ {0};
+
+    std::size_t position_ {0};
+
+    //! Whether the payload endianness is not the host one
+    bool swap_ {false};
+
+    bool xcdr2_ {false};
+
+    std::size_t max_alignment_ {8};
+};
+
+} /* namespace cdr */
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <fastddsspy_participants/cdr/impl/CdrReader.ipp>
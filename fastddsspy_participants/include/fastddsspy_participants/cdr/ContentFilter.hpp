@@ -0,0 +1,316 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastddsspy_participants/cdr/CdrReader.hpp>
+#include <fastddsspy_participants/cdr/TypeLayout.hpp>
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+namespace cdr {
+
+/**
+ * @brief Filter expression of a ContentFilteredTopic, parsed once and independent of any type
+ *
+ * Supports the DDS-SQL grammar of the DDS specification without parameters: comparisons (=, <>, !=, <, <=, >, >=),
+ * LIKE and [NOT] BETWEEN, combined with AND, OR, NOT and parentheses. Operands are member paths separated by dots
+ * (e.g. \c header.stamp.sec), numbers, strings between single quotes and TRUE / FALSE.
+ */
+class FilterExpression
+{
+public:
+
+    struct Node
+    {
+        enum class Kind : uint8_t
+        {
+            field,
+            integer,
+            real,
+            string,
+            boolean,
+            equal,
+            not_equal,
+            less,
+            less_equal,
+            greater,
+            greater_equal,
+            like,
+            between,
+            logical_and,
+            logical_or,
+            logical_not,
+        };
+
+        //! Whether the node is an operand (field or constant) rather than a condition
+        bool is_operand() const noexcept
+        {
+            return kind <= Kind::boolean;
+        }
+
+        Kind kind {Kind::boolean};
+
+        //! Member path of fields, text of strings
+        std::string text;
+
+        //! Value of integers and booleans
+        int64_t integer {0};
+
+        //! Value of reals
+        double real {0};
+
+        //! Operands of conditions
+        std::vector<std::unique_ptr<Node>> children;
+    };
+
+    /**
+     * @brief Parse a filter expression
+     *
+     * @param expression Text of the expression
+     * @param error Set to the reason the expression is not valid
+     *
+     * @return Parsed expression, or nullptr if it is not valid.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static std::shared_ptr<const FilterExpression> parse(
+            const std::string& expression,
+            std::string& error);
+
+    //! Text the expression was parsed from
+    const std::string& text() const noexcept
+    {
+        return text_;
+    }
+
+    //! Root condition of the expression
+    const Node& root() const noexcept
+    {
+        return *root_;
+    }
+
+protected:
+
+    std::string text_;
+
+    std::unique_ptr<Node> root_;
+};
+
+/**
+ * @brief Filter expression compiled for a type, evaluated directly on serialized CDR payloads
+ *
+ * The fields of the expression are resolved once against the \c TypeLayout of the type, so evaluating a sample only
+ * reads the members the expression uses (skipping the rest) and runs a small stack based program over their values.
+ * Fields can only go through structures and must end in a primitive, string or enumeration member.
+ */
+class ContentFilter
+{
+public:
+
+    /**
+     * @brief Compile \c expression for the type described by \c layout
+     *
+     * @param expression Parsed filter expression
+     * @param layout Layout of the type, must be a structure
+     * @param error Set to the reason the expression cannot be applied to the type
+     *
+     * @return Compiled filter, or nullptr if a field is not a member of the type or operands cannot be compared.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static std::shared_ptr<const ContentFilter> compile(
+            const FilterExpression& expression,
+            const std::shared_ptr<const TypeLayout>& layout,
+            std::string& error);
+
+    /**
+     * @brief Whether a sample passes the filter
+     *
+     * @param data Serialized payload, starting with the encapsulation header
+     * @param size Size of the payload
+     * @return false if the sample does not pass the filter or the payload cannot be read.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool evaluate(
+            const uint8_t* data,
+            std::size_t size) const;
+
+protected:
+
+    //! Value of a field or constant, all of them reduced to integers, reals and strings
+    struct Value
+    {
+        enum class Kind : uint8_t
+        {
+            integer,
+            real,
+            string,
+        };
+
+        Kind kind {Kind::integer};
+
+        int64_t integer {0};
+
+        double real {0};
+
+        const char* chars {nullptr};
+
+        uint32_t length {0};
+
+        //! Storage of char8 fields, pointed by \c chars
+        char character {0};
+    };
+
+    enum class OpCode : uint8_t
+    {
+        push_field,
+        push_constant,
+        equal,
+        not_equal,
+        less,
+        less_equal,
+        greater,
+        greater_equal,
+        like,
+        between,
+        logical_not,
+        //! Jump if the top of the stack is false keeping it, pop it otherwise
+        jump_if_false,
+        //! Jump if the top of the stack is true keeping it, pop it otherwise
+        jump_if_true,
+    };
+
+    struct Instruction
+    {
+        OpCode code;
+
+        //! Slot, constant or jump target
+        uint32_t argument;
+    };
+
+    //! Members of a structure to read into the value slots
+    struct ReadPlan
+    {
+        struct Member
+        {
+            //! Slot the value is read into, or -1 if the member is nested or not used
+            int32_t slot {-1};
+
+            //! Plan of nested structures used by the expression
+            std::unique_ptr<ReadPlan> nested;
+        };
+
+        std::vector<Member> members;
+
+        //! Index of the last member used, so the members after it are never read
+        uint32_t last_member {0};
+    };
+
+    //! Kinds of operands, checked when compiling
+    enum class OperandKind : uint8_t
+    {
+        boolean,
+        number,
+        string,
+        enumeration,
+    };
+
+    //! Append an instruction that changes the depth of the stack by \c depth_change
+    void emit_(
+            OpCode code,
+            uint32_t argument,
+            int32_t depth_change);
+
+    //! Resolve the field \c path, adding it to the read plan
+    bool compile_field_(
+            const std::string& path,
+            uint32_t& slot,
+            const TypeLayout*& field,
+            std::string& error);
+
+    //! Kind of an operand, resolving fields
+    bool operand_kind_(
+            const FilterExpression::Node& node,
+            OperandKind& kind,
+            const TypeLayout*& field,
+            std::string& error);
+
+    //! Emit the instructions that push an operand, \c enumeration resolves string constants to its literals
+    bool compile_operand_(
+            const FilterExpression::Node& node,
+            const TypeLayout* enumeration,
+            std::string& error);
+
+    //! Emit the instructions of a condition
+    bool compile_condition_(
+            const FilterExpression::Node& node,
+            std::string& error);
+
+    //! Whether \c left and \c right satisfy the comparison \c code
+    static bool compare_(
+            OpCode code,
+            const Value& left,
+            const Value& right) noexcept;
+
+    //! Whether the string \c text matches the LIKE \c pattern (% for any characters, _ for a single one)
+    static bool like_(
+            const Value& text,
+            const Value& pattern) noexcept;
+
+    //! Read the values of the members used in a structure
+    bool read_structure_(
+            CdrReader& reader,
+            const TypeLayout& layout,
+            const ReadPlan& plan,
+            bool root,
+            Value* values) const noexcept;
+
+    //! Read a primitive, string or enumeration value
+    static bool read_value_(
+            CdrReader& reader,
+            const TypeLayout& layout,
+            Value& value) noexcept;
+
+    std::shared_ptr<const TypeLayout> layout_;
+
+    ReadPlan plan_;
+
+    //! Number of fields read from each payload
+    uint32_t slot_count_ {0};
+
+    std::vector<Value> constants_;
+
+    //! Text of string constants, stable so \c constants_ can point to them
+    std::deque<std::string> texts_;
+
+    std::vector<Instruction> program_;
+
+    //! Maximum depth of the stack while running \c program_
+    uint32_t stack_size_ {0};
+
+    //! Depth of the stack at the end of \c program_, while compiling
+    uint32_t depth_ {0};
+};
+
+} /* namespace cdr */
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,72 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastddsspy_participants/cdr/TypeLayout.hpp>
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+namespace cdr {
+
+/**
+ * @brief Members of a structure selected to be written, compiled once from their paths and the \c TypeLayout
+ *
+ * A projection with no \c members selects the whole value. Otherwise it selects only the members of the structure
+ * with a projection, each of them in turn with its own selection.
+ */
+struct FieldProjection
+{
+    //! Whether the whole value is selected
+    bool selects_all() const noexcept
+    {
+        return members.empty();
+    }
+
+    //! Projection of each member of the structure, in serialization order, null for members not selected
+    std::vector<std::shared_ptr<const FieldProjection>> members;
+
+    //! Index of the last member selected, so the members after it are never read
+    uint32_t last_member {0};
+};
+
+/**
+ * @brief Compile the projection of a structure type that selects the members in \c paths
+ *
+ * Each path is a list of member names separated by dots (e.g. \c header.stamp), that goes only through structures.
+ * A path selects the whole value of its last member, so it overrides any longer path under it.
+ *
+ * @param layout Layout of the type, must be a structure
+ * @param paths Paths of the members to select, at least one
+ * @param error Set to the reason the projection cannot be compiled
+ *
+ * @return Projection of the type, or nullptr if any path is not a member of the type.
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+std::shared_ptr<const FieldProjection> build_field_projection(
+        const TypeLayout& layout,
+        const std::vector<std::string>& paths,
+        std::string& error);
+
+} /* namespace cdr */
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
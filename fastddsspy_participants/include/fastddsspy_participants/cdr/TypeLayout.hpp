@@ -0,0 +1,128 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+namespace cdr {
+
+/**
+ * @brief Kinds of values a \c TypeLayout can describe
+ */
+enum class TypeLayoutKind : uint8_t
+{
+    boolean,
+    int8,
+    uint8,
+    int16,
+    uint16,
+    int32,
+    uint32,
+    int64,
+    uint64,
+    float32,
+    float64,
+    char8,
+    string,
+    enumeration,
+    structure,
+    sequence,
+    array,
+};
+
+/**
+ * @brief Serialization layout of a type, compiled once from its \c DynamicType
+ *
+ * Describes everything needed to walk a CDR (XCDR1 or XCDR2) buffer of the type without \c DynamicData.
+ * Only final and appendable types without optional members, unions, maps, bitsets or bitmasks can be described.
+ */
+struct TypeLayout
+{
+    struct Member
+    {
+        std::string name;
+        std::shared_ptr<const TypeLayout> layout;
+    };
+
+    struct EnumLiteral
+    {
+        int32_t value;
+        std::string name;
+    };
+
+    /**
+     * @brief Whether the value is a CDR primitive
+     *
+     * Collections of primitives carry no DHEADER in XCDR2. Enumerations count as primitives.
+     */
+    bool is_primitive() const noexcept
+    {
+        return primitive_size > 0;
+    }
+
+    //! Index of the member called \c name, or the number of members if there is none
+    uint32_t member_index(
+            const std::string& name) const noexcept
+    {
+        const auto it = std::lower_bound(members_by_name.begin(), members_by_name.end(), name,
+                        [this](uint32_t index, const std::string& member_name)
+                        {
+                            return members[index].name < member_name;
+                        });
+        if (it == members_by_name.end() || members[*it].name != name)
+        {
+            return static_cast<uint32_t>(members.size());
+        }
+        return *it;
+    }
+
+    TypeLayoutKind kind {TypeLayoutKind::structure};
+
+    //! Serialized size of primitives and enumerations, 0 for any other kind
+    uint32_t primitive_size {0};
+
+    //! Length of arrays, or maximum length of strings and sequences (0 if unbounded)
+    uint32_t bound {0};
+
+    //! Element of sequences and arrays
+    std::shared_ptr<const TypeLayout> element;
+
+    //! Members of structures, in serialization order
+    std::vector<Member> members;
+
+    //! Indexes of \c members sorted by member name
+    std::vector<uint32_t> members_by_name;
+
+    //! Whether serialization order and name order are the same
+    bool members_sorted {true};
+
+    //! Appendable structures are delimited by a DHEADER in XCDR2
+    bool appendable {false};
+
+    //! Literals of enumerations, sorted by value
+    std::vector<EnumLiteral> literals;
+};
+
+} /* namespace cdr */
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
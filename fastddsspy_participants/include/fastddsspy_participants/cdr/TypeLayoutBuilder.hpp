@@ -0,0 +1,71 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+
+#include <fastddsspy_participants/cdr/TypeLayout.hpp>
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+namespace cdr {
+
+/**
+ * @brief Compiles the \c TypeLayout of a \c DynamicType
+ */
+class TypeLayoutBuilder
+{
+public:
+
+    //! Maximum nesting of types supported
+    static constexpr unsigned int MAX_DEPTH = 32;
+
+    /**
+     * @brief Compile the layout of a structure type
+     *
+     * @param dyn_type Type to compile
+     * @return Layout of the type, or nullptr if the type cannot be described by a \c TypeLayout
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static std::shared_ptr<const TypeLayout> build(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type) noexcept;
+
+protected:
+
+    static std::shared_ptr<const TypeLayout> build_type_(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type,
+            unsigned int depth);
+
+    static std::shared_ptr<const TypeLayout> build_structure_(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type,
+            const fastdds::dds::TypeDescriptor::_ref_type& descriptor,
+            unsigned int depth);
+
+    static std::shared_ptr<const TypeLayout> build_enumeration_(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type);
+
+    static std::shared_ptr<const TypeLayout> build_collection_(
+            const fastdds::dds::TypeDescriptor::_ref_type& descriptor,
+            unsigned int depth);
+};
+
+} /* namespace cdr */
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
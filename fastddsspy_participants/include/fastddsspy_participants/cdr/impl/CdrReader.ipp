@@ -0,0 +1,138 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+namespace cdr {
+
+namespace detail {
+
+template <std::size_t Size>
+struct SwapBytes;
+
+template <>
+struct SwapBytes<1>
+{
+    static void apply(
+            uint8_t*) noexcept
+    {
+        // Nothing to swap
+    }
+
+};
+
+template <>
+struct SwapBytes<2>
+{
+    static void apply(
+            uint8_t* bytes) noexcept
+    {
+        std::swap(bytes[0], bytes[1]);
+    }
+
+};
+
+template <>
+struct SwapBytes<4>
+{
+    static void apply(
+            uint8_t* bytes) noexcept
+    {
+        std::swap(bytes[0], bytes[3]);
+        std::swap(bytes[1], bytes[2]);
+    }
+
+};
+
+template <>
+struct SwapBytes<8>
+{
+    static void apply(
+            uint8_t* bytes) noexcept
+    {
+        std::swap(bytes[0], bytes[7]);
+        std::swap(bytes[1], bytes[6]);
+        std::swap(bytes[2], bytes[5]);
+        std::swap(bytes[3], bytes[4]);
+    }
+
+};
+
+} /* namespace detail */
+
+inline bool CdrReader::align(
+        std::size_t alignment) noexcept
+{
+    if (alignment > max_alignment_)
+    {
+        alignment = max_alignment_;
+    }
+
+    // Alignment is relative to the end of the encapsulation header
+    const std::size_t padding = (alignment - ((position_ - ENCAPSULATION_SIZE) & (alignment - 1))) & (alignment - 1);
+    if (padding > size_ - position_)
+    {
+        return false;
+    }
+    position_ += padding;
+    return true;
+}
+
+template <typename T>
+bool CdrReader::read(
+        T& value) noexcept
+{
+    static_assert(std::is_arithmetic<T>::value, "CdrReader only reads primitive types");
+
+    if (!align(sizeof(T)) || sizeof(T) > size_ - position_)
+    {
+        return false;
+    }
+
+    uint8_t bytes[sizeof(T)];
+    std::memcpy(bytes, data_ + position_, sizeof(T));
+    if (swap_)
+    {
+        detail::SwapBytes<sizeof(T)>::apply(bytes);
+    }
+    std::memcpy(&value, bytes, sizeof(T));
+
+    position_ += sizeof(T);
+    return true;
+}
+
+template <>
+inline bool CdrReader::read<bool>(
+        bool& value) noexcept
+{
+    uint8_t byte;
+    if (!read(byte))
+    {
+        return false;
+    }
+    value = (byte != 0);
+    return true;
+}
+
+} /* namespace cdr */
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,104 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Bounded lock-free multi-producer queue
+ *
+ * Fixed ring of cells, each one with its own sequence counter (D. Vyukov's bounded queue), so neither
+ * producers nor consumers ever take a lock or allocate once the queue is built.
+ *
+ * Any thread may pop. This is what allows a producer to discard the oldest element when the queue is full.
+ *
+ * @note The capacity is rounded up to the next power of two.
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+
+    explicit BoundedQueue(
+            std::size_t capacity);
+
+    BoundedQueue(
+            const BoundedQueue&) = delete;
+
+    BoundedQueue& operator =(
+            const BoundedQueue&) = delete;
+
+    /**
+     * @brief Move \c value into the queue
+     *
+     * @return false if the queue is full. \c value is left untouched in that case.
+     */
+    bool try_push(
+            T&& value) noexcept;
+
+    /**
+     * @brief Move the oldest element of the queue into \c value
+     *
+     * @return false if the queue is empty.
+     */
+    bool try_pop(
+            T& value) noexcept;
+
+    //! Number of elements the queue can hold
+    std::size_t capacity() const noexcept;
+
+    //! Number of elements in the queue (only exact when no other thread is using it)
+    std::size_t size() const noexcept;
+
+    bool empty() const noexcept;
+
+protected:
+
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        T value;
+    };
+
+    //! Cache line size, used to keep producer and consumer positions apart
+    static constexpr std::size_t CACHE_LINE_SIZE_ = 64;
+
+    std::unique_ptr<Cell[]> cells_;
+
+    const std::size_t mask_;
+
+    char padding_0_[CACHE_LINE_SIZE_];
+
+    std::atomic<std::size_t> enqueue_position_;
+
+    char padding_1_[CACHE_LINE_SIZE_];
+
+    std::atomic<std::size_t> dequeue_position_;
+
+    char padding_2_[CACHE_LINE_SIZE_];
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <fastddsspy_participants/model/impl/BoundedQueue.ipp>
@@ -0,0 +1,308 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <fastddsspy_participants/library/library_dll.h>
+#include <fastddsspy_participants/model/BoundedQueue.hpp>
+#include <fastddsspy_participants/model/DataStreamer.hpp>
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief What to do with a new sample when the dispatcher queue is full
+ */
+enum class DropPolicy
+{
+    drop_oldest,    //! Discard the oldest queued sample to make room for the new one
+    drop_newest,    //! Discard the new sample
+    block,          //! Wait in the reception thread until there is room
+};
+
+/**
+ * @brief Moves the processing of received samples out of the reception threads
+ *
+ * Reception threads only \c push a reference to the entry of the topic and to the payload of the sample into a
+ * bounded lock-free queue. The entry is looked up by topic in \c push, or resolved once with \c topic_callback.
+ * Dedicated threads pop the samples and call the callback with them. Topics are spread across the threads by the hash
+ * of their name, each thread with its own queue, so the samples of a topic are always processed by the same thread in
+ * the same order they were pushed, while different topics are processed in parallel.
+ *
+ * The samples queued are kept in storage reserved when the dispatcher is built, so pushing a sample whose payload
+ * belongs to a payload pool does not allocate memory.
+ *
+ * When a queue is full, the \c DropPolicy decides which sample is lost. Dropped samples are counted per topic.
+ */
+class DataDispatcher
+{
+public:
+
+    //! Default number of samples that can wait to be processed by each thread
+    static constexpr std::size_t DEFAULT_QUEUE_SIZE = 1024;
+
+    //! Default number of dispatching threads
+    static constexpr std::size_t DEFAULT_THREADS = 4;
+
+    /**
+     * @brief Create a stopped dispatcher
+     *
+     * @param queue_size Number of samples that can wait to be processed by each thread
+     * @param threads Number of dispatching threads, at least 1
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    DataDispatcher(
+            std::size_t queue_size = DEFAULT_QUEUE_SIZE,
+            DropPolicy drop_policy = DropPolicy::drop_oldest,
+            std::size_t threads = 1);
+
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    ~DataDispatcher();
+
+    /**
+     * @brief Start the dispatching threads
+     *
+     * Samples left from a previous run and drop counters are discarded.
+     *
+     * @param callback Callback called from the dispatching threads for every sample pushed. It is called
+     * concurrently for samples of different topics.
+     * @return false if the dispatcher is already running
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool start(
+            const std::shared_ptr<DataStreamer::CallbackType>& callback);
+
+    /**
+     * @brief Start the dispatching threads, each of them with its own callback
+     *
+     * @param callbacks Callback of each dispatching thread, as many as \c threads
+     * @return false if the dispatcher is already running or there is not a callback per thread
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool start(
+            const std::vector<std::shared_ptr<DataStreamer::CallbackType>>& callbacks);
+
+    /**
+     * @brief Stop the dispatching threads
+     *
+     * The samples being processed are completed, and the samples being pushed are waited for. Pending ones are
+     * discarded, releasing their payloads.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void stop();
+
+    //! Number of dispatching threads
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::size_t threads() const noexcept;
+
+    /**
+     * @brief Queue a sample to be processed by the dispatching thread of its topic
+     *
+     * The payload is not copied if it belongs to a payload pool.
+     * Samples pushed while the dispatcher is not running are ignored.
+     * The topic is looked up under a lock, reception threads should push with \c topic_callback instead.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void push(
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<TypeDecoder>& decoder,
+            const ddspipe::core::types::RtpsPayloadData& data);
+
+    /**
+     * @brief Callback that pushes the samples of \c topic with \c decoder
+     *
+     * The topic is resolved once when the callback is created, so that pushing its samples does not look it up.
+     * The callback must not be called once the dispatcher is destroyed.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::shared_ptr<DataStreamer::CallbackType> topic_callback(
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<TypeDecoder>& decoder);
+
+    //! Number of samples dropped since last \c start, by topic name
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::map<std::string, uint64_t> dropped_samples() const;
+
+protected:
+
+    struct Worker;
+
+    //! Topic whose samples are dispatched, created with its first sample and kept while the dispatcher lives
+    struct TopicEntry
+    {
+        ddspipe::core::types::DdsTopic topic;
+
+        std::shared_ptr<TypeDecoder> decoder;
+
+        //! Worker that processes the samples of the topic
+        Worker* worker;
+
+        //! Samples of the topic dropped since last \c start
+        std::atomic<uint64_t> dropped {0};
+    };
+
+    //! Entries of the topics by topic name
+    using TopicEntries = std::unordered_map<std::string, std::vector<std::unique_ptr<TopicEntry>>>;
+
+    //! Storage of the data of a sample, constructed when the sample is pushed
+    using DataSlot = std::aligned_storage<
+        sizeof(ddspipe::core::types::RtpsPayloadData),
+        alignof(ddspipe::core::types::RtpsPayloadData)>::type;
+
+    struct Sample
+    {
+        TopicEntry* topic {nullptr};
+
+        //! Data constructed in a slot of the worker
+        ddspipe::core::types::RtpsPayloadData* data {nullptr};
+    };
+
+    //! Dispatching thread, with the queue of the topics assigned to it
+    struct Worker
+    {
+        Worker(
+                std::size_t queue_size);
+
+        BoundedQueue<Sample> queue;
+
+        //! Storage of the data of the samples queued, being processed or being pushed
+        std::unique_ptr<DataSlot[]> slots;
+
+        //! Slots not in use
+        BoundedQueue<DataSlot*> free_slots;
+
+        std::shared_ptr<DataStreamer::CallbackType> callback;
+
+        std::thread thread;
+
+        std::mutex wake_mutex;
+
+        std::condition_variable wake_cv;
+
+        //! Producers waiting for room in the queue with \c DropPolicy::block
+        std::atomic<uint32_t> blocked_producers {0};
+
+        std::mutex room_mutex;
+
+        std::condition_variable room_cv;
+
+        //! Samples of the topics of this worker dropped since last \c start
+        std::atomic<uint64_t> dropped {0};
+    };
+
+    //! Queue a sample of the topic of \c entry, if the dispatcher is running
+    void push_(
+            TopicEntry& entry,
+            const ddspipe::core::types::RtpsPayloadData& data);
+
+    //! Queue a sample, once \c push_ has checked that the dispatcher is running
+    void enqueue_(
+            TopicEntry& entry,
+            const ddspipe::core::types::RtpsPayloadData& data);
+
+    //! Dispatching thread routine
+    void run_(
+            Worker& worker);
+
+    //! Worker that processes the samples of \c topic_name
+    Worker& worker_(
+            const std::string& topic_name) noexcept;
+
+    //! Entry of \c topic with \c decoder, created if it is the first sample of both
+    TopicEntry& topic_entry_(
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<TypeDecoder>& decoder);
+
+    /**
+     * @brief Take a free slot of \c worker, making room as the drop policy says if every slot is in use
+     *
+     * @return null if there is no room for the sample, which must then be dropped.
+     */
+    DataSlot* acquire_slot_(
+            Worker& worker);
+
+    //! Destroy the data of a sample and give its slot back to \c worker
+    void release_data_(
+            Worker& worker,
+            ddspipe::core::types::RtpsPayloadData* data);
+
+    /**
+     * @brief Wait in a producer until \c has_room is true or the dispatcher stops
+     *
+     * @return false if the dispatcher stopped.
+     */
+    bool wait_room_(
+            Worker& worker,
+            const std::function<bool()>& has_room);
+
+    //! Wake up the producers waiting for room in \c worker, if any
+    void notify_room_(
+            Worker& worker);
+
+    //! Wait until every \c push in progress returns
+    void wait_producers_() const noexcept;
+
+    //! Discard every sample in the queues
+    void clear_queues_();
+
+    void count_dropped_(
+            TopicEntry& topic) noexcept;
+
+    //! Time the dispatching thread sleeps when the queue is empty, unless notified earlier
+    static constexpr std::chrono::milliseconds IDLE_WAIT_{10};
+
+    //! Slots of each worker on top of its queue capacity, for the samples being processed or pushed
+    static constexpr std::size_t IN_FLIGHT_SLOTS_ = 16;
+
+    const DropPolicy drop_policy_;
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+
+    std::atomic<bool> running_ {false};
+
+    //! Calls to \c push in progress, waited for by \c stop before the queues are cleared
+    std::atomic<uint32_t> producers_ {0};
+
+    /**
+     * @brief Entries of the topics pushed, guarded by \c topic_entries_mutex_
+     *
+     * Entries are never removed, so the samples queued and the callbacks of \c topic_callback can point to them.
+     */
+    TopicEntries topic_entries_;
+
+    mutable std::mutex topic_entries_mutex_;
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
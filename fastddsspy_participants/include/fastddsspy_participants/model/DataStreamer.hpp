@@ -16,9 +16,15 @@
 
 #include <functional>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
 #include <shared_mutex>
+#include <string>
 #include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include <fastcdr/cdr/fixed_size_string.hpp>
 
@@ -28,9 +34,15 @@
 #include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 #include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
 
+#include <fastddsspy_participants/cdr/ContentFilter.hpp>
 #include <fastddsspy_participants/library/library_dll.h>
 #include <fastddsspy_participants/model/TopicRateCalculator.hpp>
 #include <fastddsspy_participants/model/InstanceCache.hpp>
+#include <fastddsspy_participants/model/RcuValue.hpp>
+#include <fastddsspy_participants/model/SampleHistory.hpp>
+#include <fastddsspy_participants/model/SampleThrottle.hpp>
+#include <fastddsspy_participants/model/TopicRanking.hpp>
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
 
 namespace eprosima {
 namespace spy {
@@ -45,31 +57,200 @@ public:
 
     using CallbackType = std::function<void (
                         const ddspipe::core::types::DdsTopic&,
-                        const fastdds::dds::DynamicType::_ref_type&,
+                        const std::shared_ptr<TypeDecoder>&,
                         const ddspipe::core::types::RtpsPayloadData&)>;
 
+    /**
+     * @brief Callback for the data of a topic, given the topic and its decoder
+     *
+     * Called once for each topic and decoder when the topic is resolved, so that the callback returned can keep
+     * whatever it needs of the topic instead of looking it up with every data.
+     */
+    using TopicBinderType = std::function<std::shared_ptr<CallbackType> (
+                        const ddspipe::core::types::DdsTopic&,
+                        const std::shared_ptr<TypeDecoder>&)>;
+
+    //! Identifies a subscription, valid handles are never \c INVALID_SUBSCRIPTION
+    using SubscriptionHandle = uint64_t;
+
+    static constexpr SubscriptionHandle INVALID_SUBSCRIPTION = 0;
+
+    /**
+     * @brief Call \c callback with the data of every topic, along with any other subscription
+     *
+     * @param throttle If set, only data accepted by it is passed to \c callback
+     *
+     * @return handle to remove the subscription with \c unsubscribe
+     */
     FASTDDSSPY_PARTICIPANTS_DllAPI
-    bool activate_all(
-            const std::shared_ptr<CallbackType>& callback);
+    SubscriptionHandle subscribe_all(
+            const std::shared_ptr<CallbackType>& callback,
+            const std::shared_ptr<SampleThrottle>& throttle = nullptr);
 
+    //! Same as \c subscribe_all, with the callback of each topic given by \c binder
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    SubscriptionHandle subscribe_all_bound(
+            const std::shared_ptr<TopicBinderType>& binder,
+            const std::shared_ptr<SampleThrottle>& throttle = nullptr);
+
+    /**
+     * @brief Call \c callback with the data of the topics matching \c filter, along with any other subscription
+     *
+     * @param throttle If set, only data accepted by it is passed to \c callback
+     *
+     * @return handle to remove the subscription with \c unsubscribe
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    SubscriptionHandle subscribe(
+            const ddspipe::core::types::WildcardDdsFilterTopic& filter,
+            const std::shared_ptr<CallbackType>& callback,
+            const std::shared_ptr<SampleThrottle>& throttle = nullptr);
+
+    //! Same as \c subscribe, with the callback of each topic given by \c binder
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    SubscriptionHandle subscribe_bound(
+            const ddspipe::core::types::WildcardDdsFilterTopic& filter,
+            const std::shared_ptr<TopicBinderType>& binder,
+            const std::shared_ptr<SampleThrottle>& throttle = nullptr);
+
+    /**
+     * @brief Remove the subscription identified by \c handle
+     *
+     * Waits for the data being delivered to the subscription, so its callback is no longer called once it returns.
+     *
+     * @note It must not be called from a callback of a subscription.
+     *
+     * @return false if there is no such subscription.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool unsubscribe(
+            SubscriptionHandle handle);
+
+    /**
+     * @brief Call \c callback with the data of every topic
+     *
+     * Replaces the subscription of the previous call to \c activate or \c activate_all.
+     *
+     * @param throttle If set, only data accepted by it is passed to \c callback
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool activate_all(
+            const std::shared_ptr<CallbackType>& callback,
+            const std::shared_ptr<SampleThrottle>& throttle = nullptr);
+
+    /**
+     * @brief Call \c callback with the data of the topics matching \c topic_to_activate
+     *
+     * Replaces the subscription of the previous call to \c activate or \c activate_all.
+     *
+     * @param throttle If set, only data accepted by it is passed to \c callback
+     */
     FASTDDSSPY_PARTICIPANTS_DllAPI
     bool activate(
             const ddspipe::core::types::WildcardDdsFilterTopic& topic_to_activate,
-            const std::shared_ptr<CallbackType>& callback);
+            const std::shared_ptr<CallbackType>& callback,
+            const std::shared_ptr<SampleThrottle>& throttle = nullptr);
 
+    //! Remove the subscription of \c activate or \c activate_all
     FASTDDSSPY_PARTICIPANTS_DllAPI
     void deactivate();
 
+    /**
+     * @brief Topic resolved once, so that its data is added without looking it up
+     *
+     * There is a single handle for each topic name and type, shared by all the writers of the topic.
+     */
+    struct TopicHandle
+    {
+        //! Everything resolved from the types, the history and the filters for the topic
+        struct State
+        {
+            //! Decoder of the type of the topic, null while it has not been discovered
+            std::shared_ptr<TypeDecoder> decoder;
+
+            //! History the samples of the topic are kept in, null if it is not enabled
+            std::shared_ptr<SampleHistory> history;
+
+            //! Samples kept of the topic, owned by \c history
+            SampleHistory::TopicHistory* topic_history {nullptr};
+
+            //! Content filter compiled for the type of the topic, null if the topic is not filtered
+            std::shared_ptr<const cdr::ContentFilter> filter;
+
+            //! Instances of the topic in \c instance_cache_, null if its type has no keys
+            InstanceCache::TopicInstances* instances {nullptr};
+
+            //! Subscription matching the topic
+            struct TopicSubscription
+            {
+                //! Callback bound to the topic
+                std::shared_ptr<CallbackType> callback;
+
+                //! Selects the data passed to callback, null to pass all of it
+                std::shared_ptr<SampleThrottle> throttle;
+
+                //! State of the topic in \c throttle
+                SampleThrottle::TopicState* throttle_state {nullptr};
+            };
+
+            //! Subscriptions matching the topic, only once its type is discovered
+            std::vector<TopicSubscription> subscriptions;
+        };
+
+        //! Topic the handle is resolved for, passed to the subscriptions along with its data
+        ddspipe::core::types::DdsTopic topic;
+
+        //! Rate info of the topic, owned by \c TopicRateCalculator
+        DataRateInfo* rate_data {nullptr};
+
+        /**
+         * @brief Current state of the topic
+         *
+         * Read without locks, and only replaced while holding \c mutex_ when a type is discovered, or the history,
+         * the filter or the subscriptions of the topic change.
+         */
+        RcuValue<State> state {std::unique_ptr<const State>(new State())};
+
+        //! Writers holding the handle, guarded by \c mutex_
+        std::size_t writers {0};
+    };
+
+    /**
+     * @brief Handle of \c topic for a writer of its data
+     *
+     * The writer adds its data with the handle, with no lookup nor lock. Every call must be paired with a call to
+     * \c release_topic_handle once the writer is done.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::shared_ptr<TopicHandle> acquire_topic_handle(
+            const ddspipe::core::types::DdsTopic& topic);
+
+    //! Give back a handle of \c acquire_topic_handle, removing it with the last writer of its topic
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void release_topic_handle(
+            const std::shared_ptr<TopicHandle>& handle);
+
     FASTDDSSPY_PARTICIPANTS_DllAPI
     void add_schema(
             const fastdds::dds::DynamicType::_ref_type& dynamic_type,
             const fastdds::dds::xtypes::TypeIdentifier& type_identifier) override;
 
+    /**
+     * @brief Add the data of \c topic, looking its handle up by topic name and type
+     *
+     * Writers of a topic should add its data with the handle of \c acquire_topic_handle instead.
+     */
     FASTDDSSPY_PARTICIPANTS_DllAPI
     void add_data(
             const ddspipe::core::types::DdsTopic& topic,
             ddspipe::core::types::RtpsPayloadData& data) override;
 
+    //! Add the data of the topic of \c handle
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void add_data(
+            TopicHandle& handle,
+            ddspipe::core::types::RtpsPayloadData& data);
+
     FASTDDSSPY_PARTICIPANTS_DllAPI
     bool is_topic_type_discovered(
             const ddspipe::core::types::DdsTopic& topic_to_activate) const noexcept;
@@ -78,6 +259,49 @@ public:
     bool is_any_topic_type_discovered(
             const std::set<eprosima::ddspipe::core::types::DdsTopic>& topics) const noexcept;
 
+    //! Decoder of the type \c type_name, null if it has not been discovered
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::shared_ptr<TypeDecoder> get_type_decoder(
+            const std::string& type_name) const noexcept;
+
+    /**
+     * @brief Keep the last \c depth samples of each topic, taking at most \c max_memory bytes
+     *
+     * Samples received before enabling it are not kept. Enabling it again drops the samples kept so far.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void enable_history(
+            std::size_t depth,
+            std::size_t max_memory = SampleHistory::DEFAULT_MAX_MEMORY);
+
+    //! Maximum number of samples kept of each topic, 0 if the history is not enabled
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::size_t history_depth() const noexcept;
+
+    //! Last \c n samples kept of \c topic, oldest first
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::vector<std::shared_ptr<const ddspipe::core::types::RtpsPayloadData>> get_topic_history(
+            const ddspipe::core::types::DdsTopic& topic,
+            std::size_t n) const;
+
+    /**
+     * @brief Drop the data of \c topic_name that does not pass the filter \c expression
+     *
+     * The expression is compiled once for the type of the topic and evaluated on the serialized data, before it is
+     * counted, kept or passed to any subscription. Topics whose type cannot be described by a \c TypeLayout are
+     * not filtered.
+     *
+     * @param expression DDS-SQL filter expression, empty to remove the filter of the topic
+     * @param error Set to the reason the expression is not valid
+     *
+     * @return false if the expression is not valid.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool set_content_filter(
+            const std::string& topic_name,
+            const std::string& expression,
+            std::string& error);
+
     FASTDDSSPY_PARTICIPANTS_DllAPI
     std::set<std::string> get_topic_instances(
             const std::string& topic_name) const noexcept;
@@ -86,32 +310,164 @@ public:
     std::vector<std::string> get_topic_key_fields(
             const std::string& topic_name) const noexcept;
 
+    /**
+     * @brief Statistics of each instance of \c topic, with their current rate over the rate window
+     *
+     * For data that is not live, the window ends at the latest data of the topic.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::vector<InstanceCache::InstanceStats> get_topic_instance_stats(
+            const ddspipe::core::types::DdsTopic& topic) const noexcept;
+
+    //! Instances of \c topic_name evicted so far to make room for newer ones
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    InstanceCache::EvictionStats get_topic_instance_evictions(
+            const std::string& topic_name) const noexcept;
+
+    /**
+     * @brief Keep at most \c max_instances_per_topic instances of each topic and \c max_instances of all topics,
+     * with at most \c max_memory bytes of keys, evicting the least recently seen ones
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void set_instance_limits(
+            std::size_t max_instances_per_topic,
+            std::size_t max_instances,
+            std::size_t max_memory) noexcept;
+
+    /**
+     * @brief Update the instances and the active writers of \c topic_name with a writer discovered or changed
+     *
+     * It may be called several times for the same writer.
+     */
     FASTDDSSPY_PARTICIPANTS_DllAPI
     void on_writer_discovered(
             const ddspipe::core::types:: Guid& writer_guid,
             const std::string& topic_name,
             bool active) noexcept;
 
+    /**
+     * @brief The \c size most active topics, ranked by \c key from the highest
+     *
+     * Topics are those with data or active writers, taken by name.
+     * Ranking takes the current statistics of each topic, kept as data is received and writers are discovered,
+     * so it takes O(topics log size) and does not go through the endpoints.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::vector<TopicActivity> get_top_topics(
+            std::size_t size,
+            TopicRanking::Key key) const;
+
 protected:
 
+    //! Consumer of the data of the topics it is subscribed to
+    struct Subscription
+    {
+        SubscriptionHandle handle;
+
+        //! Whether it receives the data of every topic, regardless of \c filter
+        bool all;
+
+        ddspipe::core::types::WildcardDdsFilterTopic filter;
+
+        //! Gives the callback of each topic
+        std::shared_ptr<TopicBinderType> binder;
+
+        //! Selects the data passed to callback, null to pass all of it
+        std::shared_ptr<SampleThrottle> throttle;
+    };
+
+    /**
+     * @brief Add a subscription, and resolve it for the topics already resolved
+     *
+     * @return handle of the new subscription, or \c INVALID_SUBSCRIPTION if \c binder is null.
+     */
+    SubscriptionHandle add_subscription_nts_(
+            bool all,
+            const ddspipe::core::types::WildcardDdsFilterTopic& filter,
+            const std::shared_ptr<TopicBinderType>& binder,
+            const std::shared_ptr<SampleThrottle>& throttle);
+
+    //! Remove the subscription identified by \c handle, if any, from the topics already resolved
+    bool remove_subscription_nts_(
+            SubscriptionHandle handle);
+
+    //! Binder that gives \c callback for every topic
+    static std::shared_ptr<TopicBinderType> bind_all_(
+            const std::shared_ptr<CallbackType>& callback);
+
+    //! Handles of each topic, by topic name and type name
+    using TopicHandles = std::map<std::string, std::map<std::string, std::shared_ptr<TopicHandle>>>;
+
+    //! Handle of \c topic, created if it does not exist
+    std::shared_ptr<TopicHandle> get_or_create_topic_handle_nts_(
+            const ddspipe::core::types::DdsTopic& topic);
+
+    //! Resolve the decoder, history, filter and subscriptions of \c topic
+    std::unique_ptr<const TopicHandle::State> resolve_topic_state_nts_(
+            const ddspipe::core::types::DdsTopic& topic);
+
+    /**
+     * @brief Resolve again the state of the handles \c affected by a change of the types, history, filters or
+     * subscriptions
+     *
+     * Returns once no data is being added with the previous states.
+     */
+    void update_topic_states_nts_(
+            const std::function<bool(const TopicHandle&)>& affected);
+
     bool is_topic_type_discovered_nts_(
             const ddspipe::core::types::DdsTopic& topic_to_activate) const noexcept;
 
     bool is_any_topic_type_discovered_nts_(
             const std::set<eprosima::ddspipe::core::types::DdsTopic>& topics) const noexcept;
 
-    bool activated_ {false};
+    //! Current subscriptions, resolved into the state of each topic handle, guarded by \c mutex_
+    std::vector<Subscription> subscriptions_;
+
+    //! Last handle given to a subscription, guarded by \c mutex_
+    SubscriptionHandle last_handle_ {INVALID_SUBSCRIPTION};
 
-    std::shared_ptr<CallbackType> callback_;
+    //! Subscription of \c activate and \c activate_all, guarded by \c mutex_
+    SubscriptionHandle activated_handle_ {INVALID_SUBSCRIPTION};
 
-    bool activated_all_ {false};
+    //! Decoder of each type discovered, by type name
+    std::map<std::string, std::shared_ptr<TypeDecoder>> types_discovered_;
 
-    ddspipe::core::types::WildcardDdsFilterTopic activated_topic_;
+    /**
+     * @brief Handles of the topics with data or writers, guarded by \c mutex_
+     *
+     * The handle of a topic is removed with the release of its last writer. Topics whose data is added without a
+     * writer keep their handle, one per topic name and type.
+     */
+    TopicHandles topic_handles_;
 
-    std::map<std::string, fastdds::dds::DynamicType::_ref_type> types_discovered_;
+    //! Last samples of each topic, null if it is not enabled, guarded by \c mutex_
+    std::shared_ptr<SampleHistory> history_;
+
+    //! Filter expression of each filtered topic, by topic name, guarded by \c mutex_
+    std::map<std::string, std::shared_ptr<const cdr::FilterExpression>> content_filters_;
 
     mutable std::shared_timed_mutex mutex_;
 
+    //! What a topic is ranked by, kept up to date as its data is received and its writers are discovered
+    struct TopicActivityInfo
+    {
+        //! Rate info of each type of the topic, owned by \c TopicRateCalculator
+        std::vector<const DataRateInfo*> rate_data;
+
+        //! Active writers of the topic
+        std::set<ddspipe::core::types::Guid> writers;
+    };
+
+    /**
+     * @brief Activity of each topic with data or active writers, by topic name, guarded by \c topic_activity_mutex_
+     *
+     * NOTE: topics with the same name and different types are ranked together.
+     */
+    std::map<std::string, TopicActivityInfo> topic_activity_;
+
+    mutable std::mutex topic_activity_mutex_;
+
 private:
 
     InstanceCache instance_cache_;
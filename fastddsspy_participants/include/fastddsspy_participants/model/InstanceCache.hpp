@@ -15,11 +15,15 @@
 #ifndef _FASTDDSSPY_PARTICIPANTS_MODEL_INSTANCECACHE_HPP_
 #define _FASTDDSSPY_PARTICIPANTS_MODEL_INSTANCECACHE_HPP_
 
+#include <atomic>
+#include <cstdint>
+#include <list>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
-#include <chrono>
 #include <shared_mutex>
 
 #include <ddspipe_core/types/data/RtpsPayloadData.hpp>
@@ -33,6 +37,11 @@
 #include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
 
+#include <fastddsspy_participants/cdr/FieldProjection.hpp>
+#include <fastddsspy_participants/cdr/TypeLayout.hpp>
+#include <fastddsspy_participants/model/RateWindow.hpp>
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
+
 namespace eprosima {
 namespace spy {
 namespace participants {
@@ -43,17 +52,37 @@ namespace participants {
  * This class is responsible for:
  * - Tracking unique instances per topic using instanceHandle
  * - Caching key field representations as JSON
- * - Managing active writers per instance
- * - Cleaning up instances when writers disappear
+ * - Managing active writers and the lifecycle of each instance
+ * - Counting the samples, rate and payload size of each instance
+ * - Evicting the least recently seen instances when a topic, all topics or their keys take too much
  */
 class InstanceCache
 {
 public:
 
+    //! Default maximum number of instances kept of each topic
+    static constexpr std::size_t DEFAULT_MAX_INSTANCES_PER_TOPIC = 1000;
+
+    //! Default maximum number of instances kept of all topics
+    static constexpr std::size_t DEFAULT_MAX_INSTANCES = 100000;
+
+    //! Default maximum size in bytes of the keys kept of all topics
+    static constexpr std::size_t DEFAULT_MAX_MEMORY = 16 * 1024 * 1024;
+
     /**
-     * @brief Maximum number of instances to track per topic
+     * @brief Lifecycle state of an instance
      */
-    static constexpr size_t MAX_INSTANCES_PER_TOPIC = 1000;
+    enum class InstanceState
+    {
+        //! Its last sample was data
+        alive,
+
+        //! Disposed by one of its writers
+        disposed,
+
+        //! Unregistered or lost by all its writers
+        no_writers,
+    };
 
     /**
      * @brief Information about a single instance
@@ -61,10 +90,47 @@ public:
     struct InstanceInfo
     {
         std::string key_representation;                           // JSON representation of key fields
-        std::set<ddspipe::core::types::Guid> active_writers;      // Writers currently publishing this instance
-        std::chrono::system_clock::time_point last_seen;          // Last time data was received
+        std::vector<ddspipe::core::types::Guid> active_writers;   // Writers currently publishing this instance
+        InstanceState state {InstanceState::alive};               // Lifecycle state
+    };
+
+    /**
+     * @brief Statistics of a single instance, taken when they are read
+     */
+    struct InstanceStats
+    {
+        std::string key_representation;
+        InstanceState state;
+        std::size_t writers;
+
+        //! Data samples received
+        uint64_t samples;
+
+        //! Bytes of the payloads of the data samples received
+        uint64_t bytes;
+
+        //! Current data samples per second, over the rate window
+        double rate;
     };
 
+    /**
+     * @brief Instances of a topic evicted to make room for newer ones, by the limit that was reached
+     */
+    struct EvictionStats
+    {
+        //! Evicted because the topic had too many instances
+        uint64_t per_topic_limit{0};
+
+        //! Evicted because all topics had too many instances
+        uint64_t total_limit{0};
+
+        //! Evicted because the keys of all topics took too much memory
+        uint64_t memory_limit{0};
+    };
+
+    //! Instances kept of a topic, resolved once with \c topic_instances
+    struct TopicInstances;
+
     InstanceCache() = default;
     ~InstanceCache() = default;
 
@@ -74,22 +140,99 @@ public:
      * @param topic The DDS topic
      * @param dyn_type The dynamic type of the topic
      * @param data The RTPS payload data
-     * @return true if instance was added/updated, false if cache is full or error occurred
+     * @param time Time the data is counted in the rate of the instance, in nanoseconds
+     * @param window Length of the rate window in nanoseconds, 0 to not count the data in the rate
+     * @return true if instance was added/updated, false if its key does not fit in the cache or error occurred
      */
     bool add_or_update_instance(
             const ddspipe::core::types::DdsTopic& topic,
             const fastdds::dds::DynamicType::_ref_type& dyn_type,
-            const ddspipe::core::types::RtpsPayloadData& data) noexcept;
+            const ddspipe::core::types::RtpsPayloadData& data,
+            int64_t time = 0,
+            int64_t window = 0) noexcept;
+
+    /**
+     * @brief Add or update an instance in the cache, decoding the sample with an already built decoder
+     *
+     * The topic is looked up by name, use \c topic_instances to resolve it once.
+     * A data sample of an alive instance already published by its writer is only counted, under a shared lock.
+     * Dispose and unregister samples update the state of the instance, and are ignored if it is not cached.
+     *
+     * @param topic The DDS topic
+     * @param decoder The decoder of the topic type
+     * @param data The RTPS payload data
+     * @param time Time the data is counted in the rate of the instance, in nanoseconds
+     * @param window Length of the rate window in nanoseconds, 0 to not count the data in the rate
+     * @return true if instance was added/updated, false if its key does not fit in the cache or error occurred
+     */
+    bool add_or_update_instance(
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<TypeDecoder>& decoder,
+            const ddspipe::core::types::RtpsPayloadData& data,
+            int64_t time = 0,
+            int64_t window = 0) noexcept;
+
+    /**
+     * @brief Add or update an instance in the instances of its topic, already resolved with \c topic_instances
+     *
+     * A data sample of an alive instance already published by its writer is only counted, under a shared lock of
+     * its topic alone, without looking the topic up.
+     *
+     * @param topic_instances The instances of the topic
+     * @param topic The DDS topic
+     * @param decoder The decoder of the topic type
+     * @param data The RTPS payload data
+     * @param time Time the data is counted in the rate of the instance, in nanoseconds
+     * @param window Length of the rate window in nanoseconds, 0 to not count the data in the rate
+     * @return true if instance was added/updated, false if its key does not fit in the cache or error occurred
+     */
+    bool add_or_update_instance(
+            TopicInstances& topic_instances,
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<TypeDecoder>& decoder,
+            const ddspipe::core::types::RtpsPayloadData& data,
+            int64_t time = 0,
+            int64_t window = 0) noexcept;
+
+    /**
+     * @brief Instances of a topic whose type is the type of \c decoder, to add its samples with
+     *
+     * Compiles the key extractor of the topic for the type, so that it is resolved once per topic and not per sample.
+     * The samples of a topic without keys never make an instance, so they need not be added.
+     * The instances returned are kept until the cache is destroyed, also when it is cleared.
+     *
+     * @param topic The DDS topic
+     * @param decoder The decoder of the topic type
+     * @return nullptr if the type has no key members or they could not be read
+     */
+    TopicInstances* topic_instances(
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<TypeDecoder>& decoder) noexcept;
 
     /**
      * @brief Get all active instances for a topic
      *
+     * Only the \c alive instances are active, those disposed or left without writers are kept but not returned.
+     *
      * @param topic_name The name of the topic
      * @return Set of JSON key representations for active instances
      */
     std::set<std::string> get_active_instances(
             const std::string& topic_name) const noexcept;
 
+    /**
+     * @brief Get the statistics of all the instances of a topic, also of those without writers
+     *
+     * @param topic_name The name of the topic
+     * @param now Time that ends the rate window, in nanoseconds
+     * @param window Length of the rate window in nanoseconds, the same the data was counted with
+     * @return Statistics of each instance
+     */
+    std::vector<InstanceStats> get_instance_stats(
+            const std::string& topic_name,
+            int64_t now,
+            int64_t window) const noexcept;
+
     /**
      * @brief Get the key field names for a topic
      *
@@ -99,9 +242,36 @@ public:
     std::vector<std::string> get_key_fields(
             const std::string& topic_name) const noexcept;
 
+    /**
+     * @brief Get the instances of a topic evicted so far
+     *
+     * @param topic_name The name of the topic
+     * @return Evicted instances by the limit that was reached
+     */
+    EvictionStats get_eviction_stats(
+            const std::string& topic_name) const noexcept;
+
+    /**
+     * @brief Set the maximum instances kept and the maximum size of their keys
+     *
+     * When a new instance does not fit, the least recently seen instances are evicted, first of its topic if the
+     * topic is full, and then of any topic. Instances already kept over the new limits are evicted right away.
+     * With a limit of 0 no instance is kept.
+     *
+     * @param max_instances_per_topic Maximum number of instances kept of each topic
+     * @param max_instances Maximum number of instances kept of all topics
+     * @param max_memory Maximum size in bytes of the JSON keys kept of all topics
+     */
+    void set_limits(
+            std::size_t max_instances_per_topic,
+            std::size_t max_instances,
+            std::size_t max_memory) noexcept;
+
     /**
      * @brief Handle writer discovery/removal
      *
+     * The instances left without writers are kept with state \c no_writers until they are evicted.
+     *
      * @param writer_guid The GUID of the writer
      * @param topic_name The name of the topic
      * @param active true if writer is active, false if removed
@@ -118,40 +288,203 @@ public:
 
 private:
 
+    //! Instance in the instances of all topics
+    struct LruEntry
+    {
+        TopicInstances* topic;
+        ddspipe::core::types::InstanceHandle handle;
+    };
+
+    //! Instance kept, with its position in the instances least recently seen
+    struct CachedInstance
+    {
+        InstanceInfo info;
+
+        std::atomic<uint64_t> samples {0};
+        std::atomic<uint64_t> bytes {0};
+        RateWindow rate;
+
+        //! Seen under a shared lock since its position was last moved, so it gets a second chance before eviction
+        std::atomic<bool> seen {false};
+
+        //! Position in the instances of its topic
+        std::list<ddspipe::core::types::InstanceHandle>::iterator topic_lru;
+
+        //! Position in the instances of all topics
+        std::list<LruEntry>::iterator lru;
+    };
+
+    //! Hash of the bytes of an instance handle
+    struct InstanceHandleHash
+    {
+        std::size_t operator ()(
+                const ddspipe::core::types::InstanceHandle& handle) const noexcept;
+    };
+
+    using Instances = std::unordered_map<ddspipe::core::types::InstanceHandle, CachedInstance, InstanceHandleHash>;
+
+    /**
+     * @brief Reads the keys of the samples of a topic, compiled once for the type of the topic
+     */
+    struct KeyExtractor
+    {
+        //! Type the extractor is compiled for
+        fastdds::dds::DynamicType::_ref_type type;
+
+        //! Key members of the type, read straight from the payload, null if the type has no \c TypeLayout
+        std::shared_ptr<const cdr::FieldProjection> projection;
+
+        //! Structure with only the key members, for the samples that cannot be read from their payload
+        fastdds::dds::DynamicType::_ref_type key_only_type;
+
+        //! Ids of the key members in \c type, empty if it has no keys
+        std::vector<fastdds::dds::MemberId> key_member_ids;
+    };
+
     /**
-     * @brief Extract and cache key field names for a topic
+     * @brief Key extractor of a topic for the type of \c decoder, compiled the first time the type is seen
+     *
+     * Also caches the key field names of the topic.
+     *
+     * @return nullptr if the extractor could not be compiled.
      */
-    void extract_key_field_names_(
+    std::shared_ptr<const KeyExtractor> key_extractor_(
             const std::string& topic_name,
-            const fastdds::dds::DynamicType::_ref_type& dyn_type) noexcept;
+            const TypeDecoder& decoder) noexcept;
 
     /**
-     * @brief Serialize key fields to JSON
+     * @brief Serialize the key fields of a sample to JSON
+     *
+     * Only the key members are read from the payload, the rest are skipped without being deserialized.
+     * Samples that cannot be read this way are deserialized whole.
      */
     std::string serialize_key_to_json_(
-            const fastdds::dds::DynamicType::_ref_type& dyn_type,
+            const KeyExtractor& extractor,
+            TypeDecoder& decoder,
             const ddspipe::core::types::RtpsPayloadData& data) noexcept;
 
     /**
-     * @brief Create a DynamicData containing only key fields
+     * @brief Create a DynamicData of the key-only type with the key values of \c original_data
      */
     fastdds::dds::DynamicData::_ref_type create_key_only_dynamic_data_(
-            const fastdds::dds::DynamicType::_ref_type& original_type,
+            const KeyExtractor& extractor,
             const fastdds::dds::DynamicData::_ref_type& original_data) noexcept;
 
+    //! Instances of a topic, created if the topic has none yet, with the exclusive lock taken
+    TopicInstances& topic_instances_nts_(
+            const std::string& topic_name);
+
+    /**
+     * @brief Update an instance with a sample of any kind, with the exclusive lock taken
+     */
+    void update_instance_(
+            TopicInstances& topic,
+            const ddspipe::core::types::InstanceHandle& handle,
+            CachedInstance& instance,
+            const ddspipe::core::types::RtpsPayloadData& data,
+            int64_t time,
+            int64_t window) noexcept;
+
+    //! Count a data sample of an instance, with atomic operations only
+    static void count_sample_(
+            CachedInstance& instance,
+            const ddspipe::core::types::RtpsPayloadData& data,
+            int64_t time,
+            int64_t window) noexcept;
+
+    /**
+     * @brief Evict the least recently seen instances until \c new_instances instances with \c new_memory bytes of
+     * keys fit in \c topic and in the cache
+     *
+     * Called with the lock of \c topic taken, the lock of any other topic is taken while its instances are evicted.
+     */
+    void evict_(
+            TopicInstances& topic,
+            std::size_t new_instances,
+            std::size_t new_memory) noexcept;
+
+    //! Add \c writer_guid to the writers of an instance, and the instance to the instances of the writer
+    void add_writer_(
+            TopicInstances& topic,
+            const ddspipe::core::types::InstanceHandle& handle,
+            CachedInstance& instance,
+            const ddspipe::core::types::Guid& writer_guid) noexcept;
+
+    //! Remove \c writer_guid from the writers of an instance, and the instance from the instances of the writer
+    void remove_writer_(
+            TopicInstances& topic,
+            const ddspipe::core::types::InstanceHandle& handle,
+            CachedInstance& instance,
+            const ddspipe::core::types::Guid& writer_guid) noexcept;
+
+    //! Remove an instance, also from the instances least recently seen and from the instances of its writers
+    void erase_instance_(
+            TopicInstances& topic,
+            Instances::iterator instance_it) noexcept;
+
+    /**
+     * @brief Whether the least recently seen instance \c handle of \c topic is evicted now
+     *
+     * An instance seen under a shared lock is moved to the end of the instances least recently seen instead.
+     */
+    bool evictable_(
+            TopicInstances& topic,
+            const ddspipe::core::types::InstanceHandle& handle) noexcept;
+
+    //! Move an instance to the end of the instances least recently seen
+    void touch_instance_(
+            TopicInstances& topic,
+            CachedInstance& instance) noexcept;
+
     // Thread-safe access
     mutable std::shared_timed_mutex mutex_;
 
-    // topic_name -> {instance_handle -> InstanceInfo}
-    std::map<std::string, std::map<ddspipe::core::types::InstanceHandle, InstanceInfo>> instances_by_topic_;
+    // topic_name -> instances of the topic, never removed so that they can be resolved once
+    std::unordered_map<std::string, std::unique_ptr<TopicInstances>> instances_by_topic_;
+
+    // Instances of all topics, least recently seen first
+    std::list<LruEntry> lru_;
+
+    // Size in bytes of the keys of all instances
+    std::size_t memory_{0};
+
+    // Limits of the instances kept
+    std::size_t max_instances_per_topic_{DEFAULT_MAX_INSTANCES_PER_TOPIC};
+    std::size_t max_instances_{DEFAULT_MAX_INSTANCES};
+    std::size_t max_memory_{DEFAULT_MAX_MEMORY};
 
     // topic_name -> [key_field_names]
     std::map<std::string, std::vector<std::string>> key_fields_cache_;
 
+    // topic_name -> key extractor of its type
+    std::map<std::string, std::shared_ptr<const KeyExtractor>> key_extractors_;
+
     // Topics already warned because key metadata could not be discovered
     std::set<std::string> no_key_metadata_warned_topics_;
 };
 
+/**
+ * @brief Instances kept of a topic
+ *
+ * The instances and their info are changed holding both the lock of the cache and the lock of the topic, so either
+ * one is enough to read them. The samples counted through the topic only take its lock.
+ */
+struct InstanceCache::TopicInstances
+{
+    //! Guards \c instances and the info of each instance against the samples counted through the topic
+    mutable std::shared_timed_mutex mutex;
+
+    Instances instances;
+
+    //! Instances of the topic, least recently seen first
+    std::list<ddspipe::core::types::InstanceHandle> lru;
+
+    //! Instances published by each writer of the topic
+    std::map<ddspipe::core::types::Guid, std::set<ddspipe::core::types::InstanceHandle>> writer_instances;
+
+    EvictionStats evictions;
+};
+
 } /* namespace participants */
 } /* namespace spy */
 } /* namespace eprosima */
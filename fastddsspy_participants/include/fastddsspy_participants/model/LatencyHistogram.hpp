@@ -0,0 +1,128 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Histogram of latencies with buckets of logarithmic width, as HDR histograms do
+ *
+ * Every power of two of nanoseconds is split in \c SUB_BUCKETS buckets of the same width, so any latency is counted
+ * with a relative error lower than 1 / \c SUB_BUCKETS and the histogram takes a fixed amount of memory.
+ * Latencies of \c MAX_LATENCY or more are counted in the last bucket, and the maximum latency is kept exactly.
+ *
+ * Adding a latency is a few relaxed atomic operations, so it can be done from several threads at once.
+ */
+class LatencyHistogram
+{
+public:
+
+    //! Each power of two is split in 2^SUB_BUCKET_BITS buckets
+    static constexpr uint32_t SUB_BUCKET_BITS = 4;
+
+    static constexpr uint32_t SUB_BUCKETS = 1u << SUB_BUCKET_BITS;
+
+    //! Latencies from 2^MAX_LATENCY_BITS nanoseconds (more than 4 hours) on share the last bucket
+    static constexpr uint32_t MAX_LATENCY_BITS = 44;
+
+    static constexpr int64_t MAX_LATENCY = int64_t(1) << MAX_LATENCY_BITS;
+
+    static constexpr std::size_t BUCKETS = (MAX_LATENCY_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+    //! Counts of a histogram at a moment
+    struct Snapshot
+    {
+        //! Number of latencies counted
+        uint64_t count {0};
+
+        //! Sum of the latencies counted, in nanoseconds
+        int64_t sum {0};
+
+        //! Highest latency counted, in nanoseconds
+        int64_t max {0};
+
+        //! Latencies counted in each bucket
+        std::vector<uint64_t> buckets;
+
+        //! Mean latency in nanoseconds, 0 if there are no latencies
+        FASTDDSSPY_PARTICIPANTS_DllAPI
+        double mean() const noexcept;
+
+        /**
+         * @brief Latency below which the fraction \c quantile of the latencies are, in nanoseconds
+         *
+         * Given as the highest latency of its bucket, and never above \c max.
+         *
+         * @param quantile Fraction of the latencies, between 0 and 1
+         *
+         * @return 0 if there are no latencies.
+         */
+        FASTDDSSPY_PARTICIPANTS_DllAPI
+        int64_t percentile(
+                double quantile) const noexcept;
+
+        //! Add the latencies counted in \c other, e.g. by another thread
+        FASTDDSSPY_PARTICIPANTS_DllAPI
+        void merge(
+                const Snapshot& other);
+    };
+
+    /**
+     * @brief Count a latency
+     *
+     * @param latency Latency in nanoseconds, negative latencies (from unsynchronized clocks) are counted as 0
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void add(
+            int64_t latency) noexcept;
+
+    //! Copy of the counts, consistent enough while latencies are being added
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    Snapshot snapshot() const;
+
+    //! Bucket where \c latency is counted
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static std::size_t bucket_index(
+            int64_t latency) noexcept;
+
+    //! Highest latency counted in the bucket \c index
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static int64_t bucket_upper_bound(
+            std::size_t index) noexcept;
+
+protected:
+
+    std::array<std::atomic<uint64_t>, BUCKETS> buckets_ {};
+
+    std::atomic<uint64_t> count_ {0};
+
+    std::atomic<int64_t> sum_ {0};
+
+    std::atomic<int64_t> max_ {0};
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,112 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Statistics of the sizes of serialized payloads
+ *
+ * Keeps the minimum, mean and maximum size, and a histogram with a bucket for each power of two: bucket 0 counts the
+ * empty payloads and bucket \c i the sizes from 2^(i-1) to 2^i - 1 bytes.
+ *
+ * Adding a size is a few relaxed atomic operations, so it can be done from several threads at once.
+ */
+class PayloadSizeStats
+{
+public:
+
+    //! Buckets of the histogram, enough for any 32 bits size
+    static constexpr std::size_t BUCKETS = 33;
+
+    //! Sizes counted at a moment
+    struct Snapshot
+    {
+        //! Number of payloads counted
+        uint64_t count {0};
+
+        //! Sum of the sizes counted, in bytes
+        uint64_t sum {0};
+
+        //! Lowest size counted, 0 if there are no payloads
+        uint32_t min {0};
+
+        //! Highest size counted
+        uint32_t max {0};
+
+        //! Payloads counted in each bucket
+        std::vector<uint64_t> buckets;
+
+        //! Mean size in bytes, 0 if there are no payloads
+        FASTDDSSPY_PARTICIPANTS_DllAPI
+        double mean() const noexcept;
+
+        //! Add the payloads counted in \c other, e.g. by another thread
+        FASTDDSSPY_PARTICIPANTS_DllAPI
+        void merge(
+                const Snapshot& other);
+    };
+
+    //! Count a payload of \c size bytes
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void add(
+            uint32_t size) noexcept;
+
+    //! Copy of the statistics, consistent enough while sizes are being added
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    Snapshot snapshot() const;
+
+    //! Bucket where \c size is counted
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static std::size_t bucket_index(
+            uint32_t size) noexcept;
+
+    //! Lowest size counted in the bucket \c index
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static uint64_t bucket_lower_bound(
+            std::size_t index) noexcept;
+
+    //! Highest size counted in the bucket \c index
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static uint64_t bucket_upper_bound(
+            std::size_t index) noexcept;
+
+protected:
+
+    std::array<std::atomic<uint64_t>, BUCKETS> buckets_ {};
+
+    std::atomic<uint64_t> count_ {0};
+
+    std::atomic<uint64_t> sum_ {0};
+
+    std::atomic<uint32_t> min_ {std::numeric_limits<uint32_t>::max()};
+
+    std::atomic<uint32_t> max_ {0};
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
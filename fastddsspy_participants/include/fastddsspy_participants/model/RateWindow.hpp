@@ -0,0 +1,124 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Rate of data (or of any amount received with it) over a sliding window of time, in a fixed amount of memory
+ *
+ * The window is split in \c BUCKETS buckets of the same width, each counting the data received in its span of time.
+ * Each bucket packs its count with the (truncated) number of the span it counts, so the bucket of an old span is
+ * reset by the first data of a new one, and a whole update is a single atomic operation.
+ *
+ * The rate is an exponentially weighted moving average of the buckets in the window, so it follows changes within a
+ * fraction of the window and drops to 0 once a whole window passes without data.
+ *
+ * Times are in nanoseconds from any origin, as long as the same one is used to add data and to get the rate.
+ * The window is given in every call, and must be the same while the data of one window is counted.
+ */
+class RateWindow
+{
+public:
+
+    //! Buckets in which the window is split
+    static constexpr std::size_t BUCKETS = 20;
+
+    //! Fraction of the window after which a bucket weighs half in the rate
+    static constexpr int64_t HALF_LIFE_DIVISOR = 4;
+
+    /**
+     * @brief Count \c amount (e.g. 1 data, or its bytes) received at \c time
+     *
+     * Data older than the window of the latest data counted is discarded.
+     * Each bucket counts less than 2^COUNT_BITS.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void add(
+            int64_t time,
+            int64_t window,
+            uint64_t amount = 1) noexcept;
+
+    /**
+     * @brief Amount per second at \c now
+     *
+     * Only the time since the first data counted is taken into account, so a new topic is not underestimated.
+     *
+     * @return 0 if no data has been counted within the window before \c now.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    double rate(
+            int64_t now,
+            int64_t window) const noexcept;
+
+    /**
+     * @brief Amount per second at \c now counted in all the \c size windows of \c windows
+     *
+     * Lets several threads count in windows of their own and merge them only to get the rate.
+     * All of them must use the same window.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static double rate(
+            const RateWindow* const* windows,
+            std::size_t size,
+            int64_t now,
+            int64_t window) noexcept;
+
+protected:
+
+    static constexpr uint32_t COUNT_BITS = 40;
+
+    static constexpr uint64_t COUNT_MASK = (uint64_t(1) << COUNT_BITS) - 1;
+
+    static constexpr uint64_t TAG_MASK = ~uint64_t(0) >> COUNT_BITS;
+
+    static constexpr int64_t UNSET_TIME = std::numeric_limits<int64_t>::min();
+
+    //! Width of each bucket, at least 1 ns
+    static int64_t bucket_width_(
+            int64_t window) noexcept;
+
+    //! Number of the span of \c time, rounded down
+    static int64_t span_(
+            int64_t time,
+            int64_t width) noexcept;
+
+    //! Bucket of \c span
+    static std::size_t bucket_index_(
+            int64_t span) noexcept;
+
+    //! Truncated \c span, as stored in the bucket
+    static uint64_t span_tag_(
+            int64_t span) noexcept;
+
+    //! Each bucket packs the tag of its span in the high bits and its count in the low \c COUNT_BITS bits
+    std::array<std::atomic<uint64_t>, BUCKETS> buckets_ {};
+
+    std::atomic<int64_t> first_time_ {UNSET_TIME};
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
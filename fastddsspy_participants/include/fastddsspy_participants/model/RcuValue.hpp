@@ -0,0 +1,131 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Value read by many threads without locks, and replaced as a whole by a single thread at a time
+ *
+ * Read-copy-update: readers take the current value and announce it in a counter of their own shard, of the parity of
+ * the current epoch. \c publish replaces the value, and then flips the epoch twice, each time waiting for the readers
+ * of the previous parity, before destroying the value replaced. A read is then a few atomic operations on the cache
+ * line of the shard of the thread, with no lock and no reference count shared by all the readers.
+ *
+ * @note Readers must not call \c publish while they hold a \c Reader, or it would wait for itself.
+ */
+template <typename T>
+class RcuValue
+{
+public:
+
+    //! Keeps the value read alive until it is destroyed
+    class Reader
+    {
+    public:
+
+        Reader(
+                const Reader&) = delete;
+
+        Reader& operator =(
+                const Reader&) = delete;
+
+        Reader(
+                Reader&& other) noexcept;
+
+        Reader& operator =(
+                Reader&&) = delete;
+
+        ~Reader();
+
+        const T& operator *() const noexcept;
+
+        const T* operator ->() const noexcept;
+
+    protected:
+
+        friend class RcuValue;
+
+        Reader(
+                std::atomic<uint32_t>& readers,
+                const T* value) noexcept;
+
+        //! Counter this reader is announced in, null once moved
+        std::atomic<uint32_t>* readers_;
+
+        const T* value_;
+    };
+
+    explicit RcuValue(
+            std::unique_ptr<const T>&& value);
+
+    RcuValue(
+            const RcuValue&) = delete;
+
+    RcuValue& operator =(
+            const RcuValue&) = delete;
+
+    ~RcuValue();
+
+    //! Current value, kept until the reader is destroyed
+    Reader read() const noexcept;
+
+    /**
+     * @brief Replace the value, and destroy the previous one once no reader holds it
+     *
+     * Calls must not be concurrent.
+     */
+    void publish(
+            std::unique_ptr<const T>&& value);
+
+protected:
+
+    //! Shards of the reader counters, so that threads reading at once rarely share them
+    static constexpr std::size_t SHARDS_ = 8;
+
+    //! Readers of a shard, by parity of the epoch they started in
+    struct alignas(64) ReaderShard
+    {
+        std::array<std::atomic<uint32_t>, 2> readers {};
+    };
+
+    //! Wait until no reader started in an epoch of \c parity
+    void wait_readers_(
+            uint32_t parity) const noexcept;
+
+    //! Shard of the calling thread
+    static std::size_t shard_index_() noexcept;
+
+    mutable std::array<ReaderShard, SHARDS_> shards_;
+
+    std::atomic<uint32_t> epoch_ {0};
+
+    std::atomic<const T*> value_;
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
+
+// Include implementation template file
+#include <fastddsspy_participants/model/impl/RcuValue.ipp>
@@ -0,0 +1,136 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Keeps the last samples received in each topic
+ *
+ * Samples are kept with a reference to their payload, shared with the payload pool it belongs to, so the payload
+ * is neither copied nor deserialized until the history is read.
+ *
+ * Each topic keeps at most \c depth samples, and the payloads of every topic together take at most \c max_memory
+ * bytes: each topic gets an even share of it, and drops its oldest samples to stay within its share.
+ *
+ * It is safe to use from several threads at once.
+ */
+class SampleHistory
+{
+public:
+
+    //! Default maximum size of the payloads kept by all topics, in bytes
+    static constexpr std::size_t DEFAULT_MAX_MEMORY = 64 * 1024 * 1024;
+
+    //! Samples kept of a topic, in a ring of \c depth positions
+    struct TopicHistory
+    {
+        std::vector<std::shared_ptr<const ddspipe::core::types::RtpsPayloadData>> ring;
+
+        //! Position of the oldest sample in \c ring
+        std::size_t first {0};
+
+        //! Number of samples in \c ring
+        std::size_t size {0};
+
+        //! Size of the payloads of the samples in \c ring
+        std::size_t bytes {0};
+
+        std::mutex mutex;
+    };
+
+    /**
+     * @param depth Maximum number of samples kept of each topic
+     * @param max_memory Maximum size of the payloads kept by all topics, in bytes
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    SampleHistory(
+            std::size_t depth,
+            std::size_t max_memory = DEFAULT_MAX_MEMORY);
+
+    /**
+     * @brief History of \c topic, created if it does not exist
+     *
+     * @note Histories are never removed, so the reference remains valid as long as this object.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    TopicHistory& topic_history(
+            const ddspipe::core::types::DdsTopic& topic);
+
+    /**
+     * @brief Keep \c data in \c history, dropping its oldest samples if needed
+     *
+     * A sample whose payload alone is larger than the share of memory of a topic is not kept.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void add(
+            TopicHistory& history,
+            const ddspipe::core::types::RtpsPayloadData& data);
+
+    //! Last \c n samples kept of \c topic (or all of them, if there are less), oldest first
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::vector<std::shared_ptr<const ddspipe::core::types::RtpsPayloadData>> last(
+            const ddspipe::core::types::DdsTopic& topic,
+            std::size_t n) const;
+
+    //! Maximum number of samples kept of each topic
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::size_t depth() const noexcept;
+
+protected:
+
+    //! Drop the oldest sample of \c history
+    static void pop_oldest_nts_(
+            TopicHistory& history);
+
+    //! Drop the oldest samples of \c history until its payloads take at most \c bytes
+    static void shrink_nts_(
+            TopicHistory& history,
+            std::size_t bytes);
+
+    //! Share of \c max_memory_ of each topic
+    std::size_t topic_memory_() const noexcept;
+
+    const std::size_t depth_;
+
+    const std::size_t max_memory_;
+
+    //! History of each topic, guarded by \c mutex_
+    std::map<ddspipe::core::types::DdsTopic, std::unique_ptr<TopicHistory>> topics_;
+
+    //! Number of topics in \c topics_, read without locking \c mutex_
+    std::atomic<std::size_t> topic_count_ {0};
+
+    mutable std::shared_timed_mutex mutex_;
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
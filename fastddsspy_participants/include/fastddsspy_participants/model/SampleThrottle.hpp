@@ -0,0 +1,130 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Decides which samples of each topic are echoed
+ *
+ * Keeps, for every topic, one of every \c every samples received and, of those, at most \c max_rate per second.
+ * Samples left out are counted as suppressed.
+ *
+ * Deciding takes a shared lock and a few atomic operations, or only the atomic operations with the state of the topic
+ * resolved beforehand, so it can be done for every sample received before any deserialization.
+ * It is safe to use from several threads at once.
+ */
+class SampleThrottle
+{
+public:
+
+    //! Value of \c max_rate that sets no limit to the rate
+    static constexpr double UNLIMITED_RATE = 0;
+
+    /**
+     * @param max_rate Maximum samples per second of each topic, \c UNLIMITED_RATE for no limit
+     * @param every Keep one of every \c every samples of each topic
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    SampleThrottle(
+            double max_rate = UNLIMITED_RATE,
+            uint32_t every = 1);
+
+    //! Whether any sample can be suppressed
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool limited() const noexcept;
+
+    /**
+     * @brief Whether a sample of a topic received now is to be echoed
+     *
+     * The sample is counted as suppressed otherwise.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool accept(
+            const std::string& topic_name);
+
+    //! Same as \c accept for a sample received at \c now
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool accept(
+            const std::string& topic_name,
+            std::chrono::steady_clock::time_point now);
+
+    //! Samples of a topic received and suppressed
+    struct TopicState
+    {
+        //! Samples received
+        std::atomic<uint64_t> received {0};
+
+        //! Samples suppressed
+        std::atomic<uint64_t> suppressed {0};
+
+        //! Earliest time (in nanoseconds of the steady clock) the next sample can be echoed
+        std::atomic<int64_t> next_allowed_time {std::numeric_limits<int64_t>::min()};
+    };
+
+    /**
+     * @brief State of \c topic_name, created the first time it is needed
+     *
+     * States are never removed, so it can be resolved once and passed to \c accept for every sample of the topic.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    TopicState& topic_state(
+            const std::string& topic_name);
+
+    //! Same as \c accept for a sample of the topic of \c state received now, without looking the topic up
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool accept(
+            TopicState& state);
+
+    //! Same as \c accept for a sample of the topic of \c state received at \c now
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool accept(
+            TopicState& state,
+            std::chrono::steady_clock::time_point now);
+
+    //! Number of samples suppressed, by topic name (only topics with suppressed samples)
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::map<std::string, uint64_t> suppressed_samples() const;
+
+protected:
+
+    //! Minimum time between two echoed samples of the same topic (0 for no limit)
+    const std::chrono::nanoseconds min_interval_;
+
+    const uint32_t every_;
+
+    //! State of each topic, by topic name
+    std::unordered_map<std::string, std::unique_ptr<TopicState>> topics_;
+
+    mutable std::shared_timed_mutex mutex_;
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,141 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+#include <fastddsspy_participants/library/library_dll.h>
+#include <fastddsspy_participants/model/LatencyHistogram.hpp>
+#include <fastddsspy_participants/model/RateWindow.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Samples received from a writer, checked against its sequence numbers
+ *
+ * A writer numbers its samples consecutively, so the sequence numbers skipped tell the samples lost (or filtered out
+ * before reaching the spy), those lower than the highest one received tell the samples arrived out of order, and
+ * those received twice tell the duplicates. The latest \c HISTORY sequence numbers are remembered to tell a late
+ * sample from a duplicate.
+ *
+ * Also measures the jitter of the live samples: how much the time between two of them at their reception differs from
+ * the time between them at their source.
+ */
+class SequenceTracker
+{
+public:
+
+    //! Sequence numbers below the highest one received that are remembered
+    static constexpr uint64_t HISTORY = 256;
+
+    //! Samples of the writer at a moment
+    struct Snapshot
+    {
+        //! Samples received, without duplicates
+        uint64_t received {0};
+
+        //! Sequence numbers skipped and not received later
+        uint64_t lost {0};
+
+        //! Samples received after one with a higher sequence number
+        uint64_t out_of_order {0};
+
+        //! Samples received more than once
+        uint64_t duplicates {0};
+
+        //! Fraction of the samples sent in the rate window that have not been received
+        double loss_ratio {0};
+
+        //! Jitter of the live samples, in nanoseconds
+        LatencyHistogram::Snapshot jitter;
+    };
+
+    /**
+     * @brief Count the sample with \c sequence_number
+     *
+     * @param sequence_number Sequence number of the sample in its writer
+     * @param time Time to count the sample in the rate window, its reception time if \c live
+     * @param window Length of the rate window
+     * @param source_time Source timestamp of the sample
+     * @param live Whether the sample is being received now, so its jitter is measured
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void add(
+            uint64_t sequence_number,
+            int64_t time,
+            int64_t window,
+            int64_t source_time,
+            bool live);
+
+    //! Copy of the counts, with the loss ratio of the rate window that ends at \c now
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    Snapshot snapshot(
+            int64_t now,
+            int64_t window) const;
+
+protected:
+
+    static constexpr std::size_t HISTORY_WORDS = HISTORY / 64;
+
+    static constexpr int64_t UNSET_TIME = std::numeric_limits<int64_t>::min();
+
+    //! Whether \c sequence_number is marked as received, it must be within the history
+    bool received_nts_(
+            uint64_t sequence_number) const noexcept;
+
+    //! Mark \c sequence_number as received, or not
+    void mark_nts_(
+            uint64_t sequence_number,
+            bool received) noexcept;
+
+    //! Guards every member but the windows and the jitter, so the samples of a writer are checked one at a time
+    mutable std::mutex mutex_;
+
+    //! Highest sequence number received, 0 before the first sample
+    uint64_t highest_ {0};
+
+    //! Received sequence numbers of the history, a bit each, by sequence number modulo \c HISTORY
+    std::array<uint64_t, HISTORY_WORDS> history_ {};
+
+    uint64_t received_ {0};
+
+    uint64_t lost_ {0};
+
+    uint64_t out_of_order_ {0};
+
+    uint64_t duplicates_ {0};
+
+    //! Reception and source time of the previous live sample
+    int64_t last_time_ {UNSET_TIME};
+    int64_t last_source_time_ {UNSET_TIME};
+
+    //! Samples sent, as told by the highest sequence number received
+    RateWindow sent_window_;
+
+    //! Samples received, without duplicates
+    RateWindow received_window_;
+
+    LatencyHistogram jitter_;
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
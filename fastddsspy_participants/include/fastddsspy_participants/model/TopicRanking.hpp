@@ -0,0 +1,93 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+//! Activity of a topic, to rank it among the others
+struct TopicActivity
+{
+    std::string topic_name;
+
+    //! Current data per second
+    float rate {0};
+
+    //! Current bytes per second
+    float bandwidth {0};
+
+    //! Active writers
+    uint32_t writers {0};
+};
+
+/**
+ * @brief Keeps the most active topics of those added
+ *
+ * Topics are ranked by one of the statistics of their activity, ties broken by topic name.
+ * Only the \c size topics ranked highest are kept, in a heap whose lowest is replaced when a higher one is added,
+ * so ranking \c N topics takes O(N log size).
+ */
+class TopicRanking
+{
+public:
+
+    //! Statistic the topics are ranked by
+    enum class Key
+    {
+        rate,
+        bandwidth,
+        writers,
+    };
+
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    TopicRanking(
+            std::size_t size,
+            Key key);
+
+    //! Rank \c activity among the topics added
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void add(
+            TopicActivity&& activity);
+
+    //! Topics kept, from the highest ranked, leaving the ranking empty
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::vector<TopicActivity> take();
+
+protected:
+
+    //! Whether \c lhs is ranked higher than \c rhs
+    bool higher_(
+            const TopicActivity& lhs,
+            const TopicActivity& rhs) const noexcept;
+
+    const std::size_t size_;
+
+    const Key key_;
+
+    //! Topics kept, in a heap with the lowest ranked at the front
+    std::vector<TopicActivity> heap_;
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
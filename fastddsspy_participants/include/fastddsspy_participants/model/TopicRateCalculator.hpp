@@ -14,14 +14,27 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <map>
+#include <memory>
+#include <shared_mutex>
 #include <tuple>
 
 #include <cpp_utils/types/Atomicable.hpp>
 
 #include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
 #include <ddspipe_core/types/dds/Payload.hpp>
 
 #include <fastddsspy_participants/library/library_dll.h>
+#include <fastddsspy_participants/model/LatencyHistogram.hpp>
+#include <fastddsspy_participants/model/PayloadSizeStats.hpp>
+#include <fastddsspy_participants/model/RateWindow.hpp>
+#include <fastddsspy_participants/model/SequenceTracker.hpp>
 #include <ddspipe_participants/participant/dynamic_types/ISchemaHandler.hpp>
 
 namespace eprosima {
@@ -29,7 +42,16 @@ namespace spy {
 namespace participants {
 
 /**
- * TODO comment
+ * @brief Statistics of the data received in each topic
+ *
+ * Counts the data of each topic to give its current rate, over a sliding window, and its average rate since the first
+ * data. Counts the bytes of the serialized payloads, per topic and per writer, to give their bandwidth and sizes.
+ * Measures the latency of every sample from its source timestamp to its reception, per topic and per writer.
+ * Latencies are only meaningful if the clocks of the writers and of the spy are synchronized.
+ * Checks the sequence numbers of the samples of each writer, to tell the samples lost, out of order or duplicated.
+ *
+ * Each thread adding data counts it in counters of its own, merged only when they are read, so threads receiving
+ * data at once do not contend for them.
  */
 class TopicRateCalculator : public ddspipe::participants::ISchemaHandler
 {
@@ -42,29 +64,244 @@ public:
 
     using RateType = float;
 
+    //! Default length of the window of the current rate
+    static constexpr uint32_t DEFAULT_RATE_WINDOW_MS = 5000;
+
+    /**
+     * @brief Current rate of \c topic in data per second, over the rate window
+     *
+     * Drops to 0 once a whole window passes without data.
+     * For data that is not live, the window ends at the latest data of the topic.
+     */
     FASTDDSSPY_PARTICIPANTS_DllAPI
     RateType get_topic_rate(
             const ddspipe::core::types::DdsTopic& topic) const noexcept;
 
+    /**
+     * @brief Average rate of \c topic in data per second, from its first to its latest data
+     *
+     * Infinite if all its data has the same source timestamp.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    RateType get_topic_average_rate(
+            const ddspipe::core::types::DdsTopic& topic) const noexcept;
+
+    /**
+     * @brief Set the length of the window of the current rate
+     *
+     * It must be set before any data is added.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void set_rate_window(
+            std::chrono::milliseconds window) noexcept;
+
+    //! Bytes received in a topic, in total and by writer
+    struct TopicTraffic
+    {
+        struct Traffic
+        {
+            //! Current bytes per second, over the rate window
+            RateType bandwidth {0};
+
+            PayloadSizeStats::Snapshot payload_size;
+        };
+
+        Traffic topic;
+
+        std::map<ddspipe::core::types::Guid, Traffic> writers;
+    };
+
+    /**
+     * @brief Bandwidth and payload sizes of the data received in \c topic
+     *
+     * Empty if no data has been received in the topic.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    TopicTraffic get_topic_traffic(
+            const ddspipe::core::types::DdsTopic& topic) const;
+
+    //! Latency of the data of a topic, in total and by writer
+    struct TopicLatency
+    {
+        LatencyHistogram::Snapshot topic;
+
+        std::map<ddspipe::core::types::Guid, LatencyHistogram::Snapshot> writers;
+    };
+
+    /**
+     * @brief Latency from the source timestamp to the reception of the data received in \c topic
+     *
+     * Empty if no data has been received in the topic, or the latency is not measured.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    TopicLatency get_topic_latency(
+            const ddspipe::core::types::DdsTopic& topic) const;
+
+    /**
+     * @brief Samples received from each writer of \c topic, checked against their sequence numbers
+     *
+     * Empty if no data has been received in the topic.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    std::map<ddspipe::core::types::Guid, SequenceTracker::Snapshot> get_topic_samples(
+            const ddspipe::core::types::DdsTopic& topic) const;
+
+    /**
+     * @brief Samples received from \c writer, checked against its sequence numbers
+     *
+     * Empty if no data has been received from the writer.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    SequenceTracker::Snapshot get_writer_samples(
+            const ddspipe::core::types::Guid& writer) const;
+
+    /**
+     * @brief Whether the data added from now on is being received now
+     *
+     * Live data is timed at its reception, so its latency is measured and its current rate follows the time passed.
+     * Data that is not live (e.g. read from a file) is timed by its source timestamp, and has no latency.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void set_live(
+            bool live) noexcept;
+
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool live() const noexcept;
+
 protected:
 
+    //! Shards of the counters of a topic or a writer, so that threads adding data at once rarely share them
+    static constexpr std::size_t SHARDS = 8;
+
+    //! Bytes received from a writer by the threads of one shard
+    struct WriterShard
+    {
+        RateWindow bytes_window;
+
+        PayloadSizeStats payload_size;
+
+        //! Keeps the counters of consecutive shards in different cache lines
+        char padding[64];
+    };
+
+    //! Data received in a topic from one of its writers
+    struct WriterDataInfo
+    {
+        explicit WriterDataInfo(
+                const ddspipe::core::types::Guid& guid)
+            : guid(guid)
+        {
+        }
+
+        const ddspipe::core::types::Guid guid;
+
+        std::array<WriterShard, SHARDS> shards;
+
+        //! Shared by the threads adding data of the writer, as they are usually one at a time
+        LatencyHistogram latency;
+
+        //! Shared by the threads adding data of the writer, as its data must be checked in a single sequence
+        SequenceTracker sequence;
+    };
+
+    /**
+     * @brief Data received in a topic by the threads of one shard
+     *
+     * Times are source timestamps in nanoseconds.
+     */
+    struct RateShard
+    {
+        static constexpr int64_t UNSET_TIME = std::numeric_limits<int64_t>::min();
+
+        std::atomic<int64_t> first_data_time {UNSET_TIME};
+        std::atomic<uint64_t> data_received {0};
+        std::atomic<int64_t> last_data_time {UNSET_TIME};
+
+        //! Data counted by the time it is added (if live) or by its source timestamp
+        RateWindow window;
+
+        //! Bytes of the payloads, counted as \c window
+        RateWindow bytes_window;
+
+        PayloadSizeStats payload_size;
+
+        //! Latency of the live data of the shard
+        LatencyHistogram latency;
+
+        //! Writer of the latest data of the shard, to find it again without locking
+        std::atomic<WriterDataInfo*> last_writer {nullptr};
+
+        //! Keeps the counters of consecutive shards in different cache lines
+        char padding[64];
+    };
+
+    /**
+     * @brief Data received in a topic
+     *
+     * Updated without locks on the topic, so that it can be shared with the objects that deliver the data of the topic.
+     * Each thread counts its data in a shard of its own (unless there are more threads than shards), and the shards
+     * are merged when the statistics are read. Only the latency and the sequence numbers of each writer are shared
+     * by the threads adding its data, the latter under the lock of its \c SequenceTracker.
+     */
     struct DataRateInfo
     {
-        ddspipe::core::types::DataTime first_data_time;
-        unsigned int data_received;
-        ddspipe::core::types::DataTime last_data_time;
+        std::array<RateShard, SHARDS> shards;
+
+        //! Data of each writer, never removed so that references remain valid, guarded by \c writers_mutex
+        std::map<ddspipe::core::types::Guid, std::unique_ptr<WriterDataInfo>> writers;
+
+        mutable std::shared_timed_mutex writers_mutex;
     };
 
-    bool get_data_rate_from_topic_nts_(
-            const ddspipe::core::types::DdsTopic& topic,
-            DataRateInfo& data) const noexcept;
+    //! Count \c data and its bytes in \c rate_data, and measure its latency if live
+    void add_data_(
+            DataRateInfo& rate_data,
+            const ddspipe::core::types::RtpsPayloadData& data);
+
+    //! Data info of \c writer in \c rate_data, created if it does not exist
+    static WriterDataInfo& get_or_create_writer_data_(
+            DataRateInfo& rate_data,
+            const ddspipe::core::types::Guid& writer);
+
+    //! Current rate of \c rate_data in data per second, over the rate window
+    RateType topic_rate_(
+            const DataRateInfo& rate_data) const noexcept;
 
+    //! Current bytes per second of \c rate_data, over the rate window
+    RateType topic_bandwidth_(
+            const DataRateInfo& rate_data) const noexcept;
+
+    //! Time \c data is counted at in the rate windows: now if live, its source timestamp otherwise
+    int64_t rate_time_(
+            const ddspipe::core::types::RtpsPayloadData& data) const noexcept;
+
+    //! Time that ends the rate window of \c rate_data now
+    int64_t rate_window_end_(
+            const DataRateInfo& rate_data) const noexcept;
+
+    //! Rate info of \c topic, null if no data has been received in it
+    const DataRateInfo* get_data_rate_from_topic_nts_(
+            const ddspipe::core::types::DdsTopic& topic) const noexcept;
+
+    DataRateInfo* get_data_rate_from_topic_nts_(
+            const ddspipe::core::types::DdsTopic& topic) noexcept;
+
+    /**
+     * @brief Rate info of \c topic, created if it does not exist
+     *
+     * @note The info is never removed, so the reference remains valid as long as this object.
+     */
     DataRateInfo& get_or_create_data_rate_from_topic_nts_(
             const ddspipe::core::types::DdsTopic& topic);
 
     using RateByTopicMapType = utils::SharedAtomicable<std::map<ddspipe::core::types::DdsTopic, DataRateInfo>>;
 
     mutable RateByTopicMapType data_by_topic_;
+
+    std::atomic<bool> live_ {true};
+
+    //! Length of the window of the current rate in nanoseconds
+    std::atomic<int64_t> rate_window_ {int64_t(DEFAULT_RATE_WINDOW_MS) * 1000000};
 };
 
 } /* namespace participants */
@@ -0,0 +1,164 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/type_representation/TypeObject.hpp>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <fastddsspy_participants/cdr/TypeLayout.hpp>
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Deserializes the samples of a discovered type
+ *
+ * Holds a single \c DynamicPubSubType for the type and a pool of \c DynamicData objects that are reused between
+ * samples, so decoding a sample does not build the type support nor allocate a new data object every time.
+ *
+ * It is safe to use from several threads at once.
+ *
+ * @warning Must be owned by a \c std::shared_ptr, as the loans keep their decoder alive.
+ */
+class TypeDecoder : public std::enable_shared_from_this<TypeDecoder>
+{
+public:
+
+    /**
+     * @brief \c DynamicData borrowed from the decoder pool
+     *
+     * The data is cleared and given back to the pool when the loan is destroyed.
+     */
+    class DataLoan
+    {
+    public:
+
+        DataLoan() = default;
+
+        FASTDDSSPY_PARTICIPANTS_DllAPI
+        DataLoan(
+                std::shared_ptr<TypeDecoder> decoder,
+                fastdds::dds::DynamicData::_ref_type data);
+
+        DataLoan(
+                DataLoan&& other) = default;
+
+        FASTDDSSPY_PARTICIPANTS_DllAPI
+        DataLoan& operator =(
+                DataLoan&& other);
+
+        FASTDDSSPY_PARTICIPANTS_DllAPI
+        ~DataLoan();
+
+        //! Borrowed data, null if the loan is empty
+        const fastdds::dds::DynamicData::_ref_type& get() const noexcept
+        {
+            return data_;
+        }
+
+        explicit operator bool () const noexcept
+        {
+            return static_cast<bool>(data_);
+        }
+
+    protected:
+
+        //! Give the data back to the decoder
+        void release_() noexcept;
+
+        std::shared_ptr<TypeDecoder> decoder_;
+
+        fastdds::dds::DynamicData::_ref_type data_;
+    };
+
+    //! Maximum number of idle \c DynamicData kept in the pool
+    static constexpr std::size_t MAX_POOLED_DATA = 16;
+
+    /**
+     * @param type_identifier Identifier the type was discovered with, if known
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    TypeDecoder(
+            const fastdds::dds::DynamicType::_ref_type& dyn_type,
+            const fastdds::dds::xtypes::TypeIdentifier& type_identifier = fastdds::dds::xtypes::TypeIdentifier());
+
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    const fastdds::dds::DynamicType::_ref_type& type() const noexcept;
+
+    /**
+     * @brief Identifier the type was discovered with
+     *
+     * Gives access to the type objects of the type in the type object registry.
+     * Its discriminator is \c TK_NONE if it is not known.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    const fastdds::dds::xtypes::TypeIdentifier& type_identifier() const noexcept;
+
+    /**
+     * @brief Serialization layout of the type
+     *
+     * @return Layout compiled when the decoder was created, or nullptr if the type is not supported by \c TypeLayout
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    const std::shared_ptr<const cdr::TypeLayout>& layout() const noexcept;
+
+    /**
+     * @brief Borrow an empty \c DynamicData of this type
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    DataLoan loan();
+
+    /**
+     * @brief Deserialize the payload of \c data
+     *
+     * @return Loan with the deserialized data, or an empty loan if the payload could not be deserialized.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    DataLoan deserialize(
+            const ddspipe::core::types::RtpsPayloadData& data);
+
+protected:
+
+    //! Give back a borrowed data to the pool
+    void return_data_(
+            fastdds::dds::DynamicData::_ref_type&& data) noexcept;
+
+    fastdds::dds::DynamicType::_ref_type dyn_type_;
+
+    fastdds::dds::xtypes::TypeIdentifier type_identifier_;
+
+    fastdds::dds::DynamicPubSubType pubsub_type_;
+
+    std::shared_ptr<const cdr::TypeLayout> layout_;
+
+    std::vector<fastdds::dds::DynamicData::_ref_type> pool_;
+
+    std::mutex pool_mutex_;
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
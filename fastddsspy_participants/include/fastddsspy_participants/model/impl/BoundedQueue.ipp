@@ -0,0 +1,149 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <utility>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+namespace detail {
+
+inline std::size_t next_power_of_two(
+        std::size_t value) noexcept
+{
+    std::size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+
+} /* namespace detail */
+
+template <typename T>
+BoundedQueue<T>::BoundedQueue(
+        std::size_t capacity)
+    : cells_(new Cell[detail::next_power_of_two(capacity < 2 ? 2 : capacity)])
+    , mask_(detail::next_power_of_two(capacity < 2 ? 2 : capacity) - 1)
+    , enqueue_position_(0)
+    , dequeue_position_(0)
+{
+    for (std::size_t i = 0; i <= mask_; ++i)
+    {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool BoundedQueue<T>::try_push(
+        T&& value) noexcept
+{
+    Cell* cell;
+    std::size_t position = enqueue_position_.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        cell = &cells_[position & mask_];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+        if (diff == 0)
+        {
+            // Cell is free: try to claim it
+            if (enqueue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Cell still holds an element from the previous lap: queue is full
+            return false;
+        }
+        else
+        {
+            // Another producer claimed this position
+            position = enqueue_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->value = std::move(value);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool BoundedQueue<T>::try_pop(
+        T& value) noexcept
+{
+    Cell* cell;
+    std::size_t position = dequeue_position_.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        cell = &cells_[position & mask_];
+        const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        const std::ptrdiff_t diff =
+                static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+        if (diff == 0)
+        {
+            // Cell is filled: try to claim it
+            if (dequeue_position_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // Cell not written yet: queue is empty
+            return false;
+        }
+        else
+        {
+            // Another consumer claimed this position
+            position = dequeue_position_.load(std::memory_order_relaxed);
+        }
+    }
+
+    value = std::move(cell->value);
+    // Release the resources held by the moved-from element now, not when the cell is reused
+    cell->value = T();
+    cell->sequence.store(position + mask_ + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+std::size_t BoundedQueue<T>::capacity() const noexcept
+{
+    return mask_ + 1;
+}
+
+template <typename T>
+std::size_t BoundedQueue<T>::size() const noexcept
+{
+    const std::size_t enqueued = enqueue_position_.load(std::memory_order_acquire);
+    const std::size_t dequeued = dequeue_position_.load(std::memory_order_acquire);
+    return enqueued > dequeued ? enqueued - dequeued : 0;
+}
+
+template <typename T>
+bool BoundedQueue<T>::empty() const noexcept
+{
+    return size() == 0;
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,127 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <thread>
+#include <utility>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+template <typename T>
+constexpr std::size_t RcuValue<T>::SHARDS_;
+
+template <typename T>
+RcuValue<T>::Reader::Reader(
+        std::atomic<uint32_t>& readers,
+        const T* value) noexcept
+    : readers_(&readers)
+    , value_(value)
+{
+}
+
+template <typename T>
+RcuValue<T>::Reader::Reader(
+        Reader&& other) noexcept
+    : readers_(other.readers_)
+    , value_(other.value_)
+{
+    other.readers_ = nullptr;
+}
+
+template <typename T>
+RcuValue<T>::Reader::~Reader()
+{
+    if (readers_)
+    {
+        readers_->fetch_sub(1, std::memory_order_release);
+    }
+}
+
+template <typename T>
+const T& RcuValue<T>::Reader::operator *() const noexcept
+{
+    return *value_;
+}
+
+template <typename T>
+const T* RcuValue<T>::Reader::operator ->() const noexcept
+{
+    return value_;
+}
+
+template <typename T>
+RcuValue<T>::RcuValue(
+        std::unique_ptr<const T>&& value)
+    : value_(value.release())
+{
+}
+
+template <typename T>
+RcuValue<T>::~RcuValue()
+{
+    delete value_.load();
+}
+
+template <typename T>
+typename RcuValue<T>::Reader RcuValue<T>::read() const noexcept
+{
+    // NOTE: announced before the value is loaded, so publish either waits for this reader or it loads the new value
+    auto& readers = shards_[shard_index_()].readers[epoch_.load() & 1];
+    readers.fetch_add(1);
+    return Reader(readers, value_.load());
+}
+
+template <typename T>
+void RcuValue<T>::publish(
+        std::unique_ptr<const T>&& value)
+{
+    const T* previous = value_.exchange(value.release());
+
+    // NOTE: a reader may have taken the parity of an epoch older than the previous flip, so one flip is not enough
+    for (int i = 0; i < 2; ++i)
+    {
+        wait_readers_(epoch_.fetch_add(1) & 1);
+    }
+
+    delete previous;
+}
+
+template <typename T>
+void RcuValue<T>::wait_readers_(
+        uint32_t parity) const noexcept
+{
+    for (const auto& shard : shards_)
+    {
+        while (shard.readers[parity].load() > 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+template <typename T>
+std::size_t RcuValue<T>::shard_index_() noexcept
+{
+    // NOTE: threads are numbered in turns, so that threads running at once get different shards
+    static std::atomic<std::size_t> next_thread_number {0};
+    thread_local const std::size_t thread_number = next_thread_number.fetch_add(1, std::memory_order_relaxed);
+    return thread_number % SHARDS_;
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
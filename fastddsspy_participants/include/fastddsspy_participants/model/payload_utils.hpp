@@ -0,0 +1,55 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Create a copy of \c data that can outlive the reception callback
+ *
+ * If the payload belongs to a payload pool, the copy shares the same buffer and only the pool reference count is
+ * increased. Otherwise the payload is copied.
+ *
+ * @param data Sample to retain
+ * @return Copy of the sample owning a reference to its payload
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+std::shared_ptr<ddspipe::core::types::RtpsPayloadData> retain_payload_data(
+        const ddspipe::core::types::RtpsPayloadData& data);
+
+/**
+ * @brief Fill \c retained with a copy of \c data that can outlive the reception callback
+ *
+ * Same as the overload above, without allocating the copy.
+ *
+ * @param data Sample to retain
+ * @param retained Sample just constructed, that takes a reference to the payload of \c data and its metadata
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+void retain_payload_data(
+        const ddspipe::core::types::RtpsPayloadData& data,
+        ddspipe::core::types::RtpsPayloadData& retained);
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -49,6 +49,10 @@ public:
 
 protected:
 
+    //! Writer that adds the data of \c topic to the model, with the handle of the topic resolved once
+    std::shared_ptr<ddspipe::core::IWriter> create_data_writer_(
+            const ddspipe::core::types::DdsTopic& topic);
+
     utils::ReturnCode new_participant_info_(
             const ddspipe::core::IRoutingData& data);
 
@@ -0,0 +1,116 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <fastddsspy_participants/library/library_dll.h>
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
+#include <fastddsspy_participants/recording/RecordWriter.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Records the samples received in a record file, without deserializing them
+ *
+ * The first sample of each topic writes the type and topic records it needs, so the file is self-describing.
+ *
+ * It is safe to use from several threads at once.
+ */
+class DataRecorder
+{
+public:
+
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    DataRecorder(
+            std::size_t segment_size = RecordWriter::DEFAULT_SEGMENT_SIZE);
+
+    /**
+     * @brief Create the record file \c file_name, replacing it if it exists
+     *
+     * @return false if the file could not be created.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool open(
+            const std::string& file_name);
+
+    //! Stop recording and close the file
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void close();
+
+    /**
+     * @brief Append \c data to the file
+     *
+     * Signature of \c DataStreamer::CallbackType, so it can be subscribed to the data of a \c DataStreamer.
+     * Data is dropped if the file is not open.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void record(
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<TypeDecoder>& decoder,
+            const ddspipe::core::types::RtpsPayloadData& data);
+
+    //! Number of samples recorded in the file
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    uint64_t samples() const noexcept;
+
+    //! Size of the file once closed
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    uint64_t size() const noexcept;
+
+protected:
+
+    /**
+     * @brief Id of \c topic in the file, writing its type and topic records if not written yet
+     *
+     * @return false if the records could not be written.
+     */
+    bool topic_id_nts_(
+            const ddspipe::core::types::DdsTopic& topic,
+            const TypeDecoder& decoder,
+            uint32_t& topic_id);
+
+    //! Write the type record of the type of \c decoder
+    bool write_type_nts_(
+            const TypeDecoder& decoder);
+
+    RecordWriter writer_;
+
+    //! Id of each topic recorded, by topic name and type name
+    std::map<std::pair<std::string, std::string>, uint32_t> topic_ids_;
+
+    //! Names of the types recorded
+    std::set<std::string> types_;
+
+    uint64_t samples_ {0};
+
+    mutable std::mutex mutex_;
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
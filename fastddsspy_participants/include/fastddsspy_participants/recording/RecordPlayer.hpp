@@ -0,0 +1,164 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/dds/Guid.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+#include <ddspipe_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include <fastddsspy_participants/library/library_dll.h>
+#include <fastddsspy_participants/model/DataStreamer.hpp>
+#include <fastddsspy_participants/model/SampleThrottle.hpp>
+#include <fastddsspy_participants/model/SpyModel.hpp>
+#include <fastddsspy_participants/recording/RecordReader.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Loads a record file in a \c SpyModel, as if its samples were being received
+ *
+ * The types and topics of the file are added to the model, along with an active writer for every writer of the
+ * samples. Then the samples are added to the model, so rates and instances are computed the same way they are
+ * for live data. The samples of each topic are added in the order they were recorded, and different topics are
+ * added in parallel.
+ *
+ * Once loaded, the samples can be passed again to a callback with \c replay, to echo them.
+ */
+class RecordPlayer
+{
+public:
+
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    RecordPlayer(
+            const std::shared_ptr<SpyModel>& model);
+
+    /**
+     * @brief Load the record file \c file_name in the model
+     *
+     * @param n_threads Maximum number of threads adding samples at once
+     *
+     * @return false if the file could not be read.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool load(
+            const std::string& file_name,
+            unsigned int n_threads = 1);
+
+    /**
+     * @brief Call \c callback with the samples of the topics matching \c filter, in the order they were recorded
+     *
+     * Samples of types not known by the model are skipped, as they are for live data.
+     *
+     * @param throttle If set, only samples accepted by it are passed to \c callback, at the time they were sent
+     *
+     * @return number of samples passed to \c callback.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    uint64_t replay(
+            const ddspipe::core::types::WildcardDdsFilterTopic& filter,
+            const DataStreamer::CallbackType& callback,
+            const std::shared_ptr<SampleThrottle>& throttle = nullptr) const;
+
+    //! Same as \c replay for the samples of every topic
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    uint64_t replay_all(
+            const DataStreamer::CallbackType& callback,
+            const std::shared_ptr<SampleThrottle>& throttle = nullptr) const;
+
+    //! Number of samples loaded
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    uint64_t samples() const noexcept;
+
+protected:
+
+    //! Topic of the file, with the samples recorded in it
+    struct RecordedTopic
+    {
+        //! Topic given to the model, which identifies it by its address
+        ddspipe::core::types::DdsTopic topic;
+
+        //! Position in \c samples_ of the samples of the topic
+        std::vector<std::size_t> samples;
+
+        //! Writers of the samples of the topic
+        std::set<ddspipe::core::types::Guid> writers;
+    };
+
+    //! Read every record of the file, adding the types to the model and indexing the samples by topic
+    void read_records_();
+
+    //! Add a type record to the model
+    void add_type_(
+            const RecordReader::Record& record);
+
+    //! Add a topic record to \c topics_
+    void add_topic_(
+            const RecordReader::Record& record);
+
+    //! Index a sample record in \c samples_ and in its topic
+    void add_sample_(
+            const RecordReader::Record& record);
+
+    //! Add an active writer to the model for every writer of the samples
+    void add_writers_();
+
+    //! Add the samples of every topic to the model, using up to \c n_threads threads
+    void add_samples_(
+            unsigned int n_threads);
+
+    //! Implementation of \c replay and \c replay_all, that passes the samples of every topic if \c all
+    uint64_t replay_(
+            bool all,
+            const ddspipe::core::types::WildcardDdsFilterTopic& filter,
+            const DataStreamer::CallbackType& callback,
+            const std::shared_ptr<SampleThrottle>& throttle) const;
+
+    /**
+     * @brief Fill \c data with the sample of \c record
+     *
+     * The payload is copied in the buffer of \c data, that is reused from one sample to the next.
+     */
+    static void fill_data_(
+            const RecordReader::SampleRecord& sample,
+            ddspipe::core::types::RtpsPayloadData& data);
+
+    std::shared_ptr<SpyModel> model_;
+
+    RecordReader reader_;
+
+    //! Topics of the file, never moved so their address identifies them in the model
+    std::vector<std::unique_ptr<RecordedTopic>> topics_;
+
+    //! Topics by their id in the file
+    std::map<uint32_t, RecordedTopic*> topics_by_id_;
+
+    //! Sample records, in the order they were recorded
+    std::vector<RecordReader::Record> samples_;
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
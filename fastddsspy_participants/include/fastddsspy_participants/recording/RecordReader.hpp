@@ -0,0 +1,141 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fastddsspy_participants/library/library_dll.h>
+#include <fastddsspy_participants/recording/record_format.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Reads the records of a record file
+ *
+ * The whole file is mapped in memory, and the records point to the mapping, so they are valid until the reader is
+ * closed.
+ */
+class RecordReader
+{
+public:
+
+    struct Record
+    {
+        RecordKind kind;
+        const char* body;
+        uint32_t size;
+    };
+
+    struct TypeRecord
+    {
+        std::string type_name;
+
+        //! Type objects, the one of the type itself last
+        std::vector<std::string> type_objects;
+    };
+
+    struct TopicRecord
+    {
+        uint32_t topic_id;
+        std::string topic_name;
+        std::string type_name;
+    };
+
+    struct SampleRecord
+    {
+        SampleRecordHeader header;
+        const char* payload;
+        uint32_t payload_size;
+    };
+
+    RecordReader() = default;
+
+    //! Close the file if open
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    ~RecordReader();
+
+    RecordReader(
+            const RecordReader&) = delete;
+
+    RecordReader& operator =(
+            const RecordReader&) = delete;
+
+    /**
+     * @brief Open the record file \c file_name and check its file header
+     *
+     * @return false if the file could not be read or is not a record file written in the byte order of the host.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool open(
+            const std::string& file_name);
+
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool is_open() const noexcept;
+
+    /**
+     * @brief Read the next record
+     *
+     * @return false once there are no more complete records.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool next(
+            Record& record) noexcept;
+
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void close();
+
+    //! Read the body of a \c RecordKind::type record
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static bool read_type(
+            const Record& record,
+            TypeRecord& type) noexcept;
+
+    //! Read the body of a \c RecordKind::topic record
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static bool read_topic(
+            const Record& record,
+            TopicRecord& topic) noexcept;
+
+    //! Read the body of a \c RecordKind::sample record
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static bool read_sample(
+            const Record& record,
+            SampleRecord& sample) noexcept;
+
+protected:
+
+    //! Contents of the file
+    const char* data_ {nullptr};
+
+    std::size_t size_ {0};
+
+    //! Offset of the next record
+    std::size_t position_ {0};
+
+#if defined(_WIN32)
+    std::vector<char> buffer_;
+#else
+    void* mapping_ {nullptr};
+#endif // if defined(_WIN32)
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,129 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <string>
+
+#include <fastddsspy_participants/library/library_dll.h>
+#include <fastddsspy_participants/recording/record_format.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Appends records to a record file
+ *
+ * The file is written through a memory mapping that advances over the file in segments, so appending a record is
+ * a copy into memory and the kernel writes it to disk in the background. The file grows one segment at a time, and
+ * it is truncated to the records written when closed.
+ *
+ * It is not thread safe.
+ */
+class RecordWriter
+{
+public:
+
+    //! Part of the body of a record
+    struct Part
+    {
+        const void* data;
+        std::size_t size;
+    };
+
+    //! Size of the file mapped at once
+    static constexpr std::size_t DEFAULT_SEGMENT_SIZE = 64 * 1024 * 1024;
+
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    RecordWriter(
+            std::size_t segment_size = DEFAULT_SEGMENT_SIZE);
+
+    //! Close the file if open
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    ~RecordWriter();
+
+    RecordWriter(
+            const RecordWriter&) = delete;
+
+    RecordWriter& operator =(
+            const RecordWriter&) = delete;
+
+    /**
+     * @brief Create the file \c file_name, replacing it if it exists, and write its file header
+     *
+     * @return false if the file could not be created.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool open(
+            const std::string& file_name);
+
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool is_open() const noexcept;
+
+    /**
+     * @brief Append a record whose body is the concatenation of \c parts
+     *
+     * @return false if the file is not open or could not be written, in which case it is closed.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool append(
+            RecordKind kind,
+            std::initializer_list<Part> parts);
+
+    //! Truncate the file to the records written and close it
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void close();
+
+    //! Size of the file once closed
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    uint64_t size() const noexcept;
+
+protected:
+
+    //! Write \c size bytes of \c data at the end of the file
+    bool write_(
+            const void* data,
+            std::size_t size);
+
+    //! Make room in the mapping for \c size more bytes
+    bool reserve_(
+            std::size_t size);
+
+    const std::size_t segment_size_;
+
+    //! Bytes written
+    uint64_t size_ {0};
+
+#if defined(_WIN32)
+    std::FILE* file_ {nullptr};
+#else
+    int fd_ {-1};
+
+    //! Mapping of the file from \c mapping_offset_
+    char* mapping_ {nullptr};
+
+    uint64_t mapping_offset_ {0};
+
+    std::size_t mapping_size_ {0};
+#endif // if defined(_WIN32)
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
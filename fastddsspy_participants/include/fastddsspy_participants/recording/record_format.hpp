@@ -0,0 +1,133 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @file record_format.hpp
+ *
+ * Layout of the files written by the \c record command.
+ *
+ * A record file is a \c RecordFileHeader followed by a sequence of records. Each record is a \c RecordHeader
+ * followed by \c RecordHeader::size bytes of body, padded with zeros up to a multiple of \c RECORD_ALIGNMENT.
+ * A record of kind \c RecordKind::end, or the end of the file, ends the sequence, so a file cut short by a crash
+ * can still be read up to its last complete record.
+ *
+ * Every integer is written in the byte order of the host, given by \c RecordFileHeader::little_endian.
+ * Strings are written as a \c uint32_t length followed by their characters, without terminator.
+ */
+
+//! First bytes of a record file
+constexpr char RECORD_FILE_MAGIC[8] = {'F', 'D', 'D', 'S', 'S', 'P', 'Y', 'R'};
+
+//! Version of the record file layout
+constexpr uint16_t RECORD_FILE_VERSION = 1;
+
+//! Records start at multiples of this size from the beginning of the file
+constexpr std::size_t RECORD_ALIGNMENT = 8;
+
+//! Size of \c size bytes once padded to \c RECORD_ALIGNMENT
+constexpr std::size_t record_aligned_size(
+        std::size_t size) noexcept
+{
+    return (size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1);
+}
+
+enum class RecordKind : uint32_t
+{
+    //! End of the records, also given by the zeros of the space reserved and not used
+    end = 0,
+
+    /**
+     * @brief Type of the topics recorded
+     *
+     * Body: type name string, \c uint32_t number of type objects, and each type object as a \c uint32_t size
+     * followed by the type object serialized in XCDR2 with its encapsulation. The type objects of the types it
+     * depends on come first, and the type object of the type itself comes last.
+     */
+    type = 1,
+
+    /**
+     * @brief Topic recorded
+     *
+     * Body: \c uint32_t topic id, topic name string and type name string. The type record of the topic is written
+     * before it.
+     */
+    topic = 2,
+
+    /**
+     * @brief Sample of a topic
+     *
+     * Body: \c SampleRecordHeader followed by the serialized payload of the sample, encapsulation included.
+     * The topic record of the sample is written before it.
+     */
+    sample = 3,
+};
+
+struct RecordFileHeader
+{
+    char magic[8];
+
+    uint16_t version;
+
+    //! 1 if the integers of the file are little endian, 0 if they are big endian
+    uint8_t little_endian;
+
+    uint8_t reserved[5];
+};
+
+struct RecordHeader
+{
+    RecordKind kind;
+
+    //! Size of the body of the record, without padding
+    uint32_t size;
+};
+
+struct SampleRecordHeader
+{
+    //! Id given to the topic in its topic record
+    uint32_t topic_id;
+
+    //! \c ChangeKind_t of the sample
+    uint8_t change_kind;
+
+    uint8_t reserved[3];
+
+    //! Guid prefix and entity id of the writer of the sample
+    uint8_t writer_guid[16];
+
+    uint8_t instance_handle[16];
+
+    //! Source timestamp in nanoseconds
+    int64_t source_timestamp;
+
+    //! Sequence number of the sample in its writer
+    uint64_t sequence_number;
+};
+
+static_assert(sizeof(RecordFileHeader) == 16, "Unexpected padding in RecordFileHeader");
+static_assert(sizeof(RecordHeader) == 8, "Unexpected padding in RecordHeader");
+static_assert(sizeof(SampleRecordHeader) == 56, "Unexpected padding in SampleRecordHeader");
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,62 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/type_representation/TypeObject.hpp>
+
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Serialize the type objects needed to build the type identified by \c type_identifier
+ *
+ * The type objects are taken from the type object registry of Fast DDS, and serialized in XCDR2 with their
+ * encapsulation. The ones of the types it depends on come first, and the one of the type itself comes last.
+ *
+ * @param type_identifier Identifier of the type, as given to \c ISchemaHandler::add_schema
+ * @param type_objects [out] Serialized type objects
+ *
+ * @return false if the registry does not hold every type object needed.
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+bool serialize_type_objects(
+        const fastdds::dds::xtypes::TypeIdentifier& type_identifier,
+        std::vector<std::string>& type_objects) noexcept;
+
+/**
+ * @brief Build the type whose type objects were serialized with \c serialize_type_objects
+ *
+ * Every type object is registered in the type object registry of Fast DDS, the type itself last.
+ *
+ * @param type_objects Serialized type objects, in any order except for the type itself, that must be the last one
+ * @param type_identifier [out] Identifier the type is registered with
+ *
+ * @return The type built, or nullptr if the type objects are not valid.
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+fastdds::dds::DynamicType::_ref_type deserialize_type_objects(
+        const std::vector<std::string>& type_objects,
+        fastdds::dds::xtypes::TypeIdentifier& type_identifier) noexcept;
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,181 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fastddsspy_participants/cdr/CdrReader.hpp>
+#include <fastddsspy_participants/cdr/FieldProjection.hpp>
+#include <fastddsspy_participants/cdr/TypeLayout.hpp>
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Writes the JSON of a serialized sample directly from its CDR payload
+ *
+ * Walks the payload once, guided by the \c TypeLayout of its type, and appends the JSON to an output string with
+ * no intermediate \c DynamicData nor JSON tree.
+ *
+ * The JSON written is the same a \c JsonFormatter gives for the \c json_serialize output of the sample:
+ * members sorted by name, arrays of primitives in a single line, enumerations as name and value.
+ *
+ * In compact mode the JSON is written in a single line with no whitespace, as \c nlohmann::json dump does with no
+ * indentation.
+ *
+ * @note Members are written in name order, but serialized in declaration order. When both differ, the members
+ * of the structure are located first and then written in name order.
+ */
+class CdrJsonSerializer
+{
+public:
+
+    //! Spaces added to the indentation in every nesting level
+    static constexpr std::size_t INDENT_STEP = 4;
+
+    //! Write the JSON in a single line with no whitespace from now on, or indented if \c compact is false
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void set_compact(
+            bool compact) noexcept;
+
+    /**
+     * @brief Append the JSON of a sample to \c output
+     *
+     * @param layout Layout of the sample type, must be a structure
+     * @param data Serialized payload, starting with the encapsulation header
+     * @param size Size of the payload
+     * @param output String to append the JSON to
+     *
+     * @return false if the payload cannot be written by this serializer (unsupported encapsulation, malformed data,
+     * non ASCII strings or unknown enumeration values). \c output is left unchanged in that case.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool serialize(
+            const cdr::TypeLayout& layout,
+            const uint8_t* data,
+            std::size_t size,
+            std::string& output);
+
+    /**
+     * @brief Append the JSON of the members of a sample selected by \c projection to \c output
+     *
+     * Members not selected are skipped in the payload without being written, and the members after the last one
+     * selected are not even read.
+     *
+     * @param layout Layout of the sample type, must be a structure
+     * @param projection Members to write, compiled for \c layout
+     * @param data Serialized payload, starting with the encapsulation header
+     * @param size Size of the payload
+     * @param output String to append the JSON to
+     *
+     * @return false in the same cases as \c serialize, leaving \c output unchanged.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool serialize(
+            const cdr::TypeLayout& layout,
+            const cdr::FieldProjection& projection,
+            const uint8_t* data,
+            std::size_t size,
+            std::string& output);
+
+protected:
+
+    bool write_value_(
+            const cdr::TypeLayout& layout,
+            std::size_t indent);
+
+    bool write_structure_(
+            const cdr::TypeLayout& layout,
+            std::size_t indent);
+
+    bool write_member_(
+            const cdr::TypeLayout::Member& member,
+            std::size_t indent);
+
+    /**
+     * @brief Write the members of a structure selected by \c projection
+     *
+     * @param root Whether nothing is read after the structure, so the members after the last one selected are not
+     * skipped
+     */
+    bool write_projected_structure_(
+            const cdr::TypeLayout& layout,
+            const cdr::FieldProjection& projection,
+            std::size_t indent,
+            bool root);
+
+    bool write_projected_member_(
+            const cdr::TypeLayout::Member& member,
+            const cdr::FieldProjection& projection,
+            std::size_t indent);
+
+    bool write_collection_(
+            const cdr::TypeLayout& element,
+            uint32_t count,
+            std::size_t indent);
+
+    bool write_enumeration_(
+            const cdr::TypeLayout& layout,
+            std::size_t indent);
+
+    template <typename T>
+    bool write_integer_();
+
+    bool write_float_(
+            double value);
+
+    bool write_string_(
+            const char* chars,
+            std::size_t length);
+
+    //! Write the quoted name of a member and the colon that follows it
+    void write_name_(
+            const std::string& name,
+            std::size_t indent);
+
+    //! Write the opening \c bracket of an object or array
+    void open_(
+            char bracket);
+
+    //! Write the comma between two members or elements
+    void separate_();
+
+    //! Write the closing \c bracket of an object or array indented \c indent spaces
+    void close_(
+            char bracket,
+            std::size_t indent);
+
+    void write_indent_(
+            std::size_t indent);
+
+    cdr::CdrReader reader_;
+
+    //! Whether the JSON is written in a single line
+    bool compact_ {false};
+
+    std::string* output_ {nullptr};
+
+    //! Stack of member positions, reused between samples
+    std::vector<std::size_t> member_positions_;
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
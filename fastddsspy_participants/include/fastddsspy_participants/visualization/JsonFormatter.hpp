@@ -0,0 +1,183 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Re-formats a JSON document in a single pass, with no JSON tree
+ *
+ * Objects are written with one member per line, indented \c indent_step spaces per nesting level, and with their
+ * members sorted by name. Arrays whose elements are all primitives (not objects nor arrays) are written in a single
+ * line, any other array with one element per line.
+ *
+ * The text written is the same that parsing the document with \c nlohmann::json and printing it that way gives:
+ * strings are re-escaped, numbers re-written in their shortest form and, for repeated member names, only the last
+ * member is kept.
+ *
+ * @note Members and arrays are written as they are read. Only when an object turns out to be unsorted, or an array
+ * to hold objects or arrays, its output is discarded and the object or array read again.
+ *
+ * @warning Not thread safe: every thread must use its own formatter.
+ */
+class JsonFormatter
+{
+public:
+
+    //! Default spaces added to the indentation in every nesting level
+    static constexpr std::size_t DEFAULT_INDENT_STEP = 4;
+
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    JsonFormatter(
+            std::size_t indent_step = DEFAULT_INDENT_STEP);
+
+    /**
+     * @brief Append the formatted JSON of a document to \c output
+     *
+     * @param json Text of the JSON document
+     * @param size Size of the text
+     * @param output String to append the JSON to
+     *
+     * @return false if \c json is not a valid JSON document. \c output is left unchanged in that case.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool format(
+            const char* json,
+            std::size_t size,
+            std::string& output);
+
+    //! Same as \c format for a whole string
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool format(
+            const std::string& json,
+            std::string& output);
+
+protected:
+
+    //! Member located while sorting an object
+    struct MemberSpan
+    {
+        //! Opening quote of the name
+        const char* name;
+
+        //! First character of the value
+        const char* value;
+    };
+
+    bool write_value_(
+            std::size_t indent);
+
+    bool write_object_(
+            std::size_t indent);
+
+    //! Write the object at \c cursor_ with its members sorted
+    bool write_sorted_object_(
+            std::size_t indent);
+
+    bool write_array_(
+            std::size_t indent);
+
+    //! Write the array at \c cursor_ with one element per line
+    bool write_multiline_array_(
+            std::size_t indent);
+
+    bool write_string_();
+
+    bool write_number_();
+
+    bool write_literal_(
+            const char* literal,
+            std::size_t length);
+
+    //! Move \c cursor_ past the value it points to
+    bool skip_value_();
+
+    /**
+     * @brief Move \c cursor_ past the number it points to
+     *
+     * @param integer Whether the number has no fraction nor exponent
+     */
+    bool skip_number_(
+            bool& integer) noexcept;
+
+    /**
+     * @brief Move \c cursor_ past the string it points to, checking it is valid
+     *
+     * @param decoded String to append the decoded characters to, if not null
+     * @param plain Whether the string has no escape sequences, so its text is already the one to write
+     */
+    bool read_string_(
+            std::string* decoded,
+            bool& plain);
+
+    //! Move \c cursor_ past the escape sequence it points to, appending the character to \c decoded if not null
+    bool read_escape_(
+            std::string* decoded);
+
+    //! Read the 4 hexadecimal digits of a \\u escape sequence
+    bool read_code_unit_(
+            uint32_t& code_unit) noexcept;
+
+    //! Move \c cursor_ past the UTF-8 multi-byte character it points to, checking it is valid
+    bool skip_utf8_() noexcept;
+
+    void skip_whitespace_() noexcept;
+
+    //! Read the character \c c, after any whitespace
+    bool consume_(
+            char c) noexcept;
+
+    /**
+     * @brief Whether the name of \c lhs is lower than the name of \c rhs
+     *
+     * Names are compared once decoded, as \c std::string does.
+     *
+     * @pre Both names have already been read and are valid.
+     */
+    bool name_less_(
+            const char* lhs,
+            const char* rhs);
+
+    void write_indent_(
+            std::size_t indent);
+
+    std::size_t indent_step_;
+
+    const char* cursor_ {nullptr};
+
+    const char* end_ {nullptr};
+
+    std::string* output_ {nullptr};
+
+    //! Stack of the members of the objects being sorted, reused between documents
+    std::vector<MemberSpan> members_;
+
+    //! Decoded strings, reused between documents
+    std::string decoded_;
+    std::string other_decoded_;
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
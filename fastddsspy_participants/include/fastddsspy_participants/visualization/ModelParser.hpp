@@ -76,6 +76,11 @@ struct ModelParser
             const SpyModel& model,
             const ddspipe::core::types::DdsTopic& topic) noexcept;
 
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static TopicLatencyData topic_latency_data(
+            const SpyModel& model,
+            const ddspipe::core::types::DdsTopic& topic) noexcept;
+
     FASTDDSSPY_PARTICIPANTS_DllAPI
     static std::vector<SimpleTopicData> topics(
             const SpyModel& model,
@@ -85,6 +90,15 @@ struct ModelParser
             const SpyModel& model,
             const ddspipe::core::types::WildcardDdsFilterTopic& filter_topic) noexcept;
     FASTDDSSPY_PARTICIPANTS_DllAPI
+    static std::vector<TopicLatencyData> topics_latency(
+            const SpyModel& model,
+            const ddspipe::core::types::WildcardDdsFilterTopic& filter_topic) noexcept;
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static std::vector<TopTopicData> top_topics(
+            const SpyModel& model,
+            std::size_t size,
+            TopicRanking::Key key) noexcept;
+    FASTDDSSPY_PARTICIPANTS_DllAPI
     static std::string topics_type_idl(
             const SpyModel& model,
             const ddspipe::core::types::WildcardDdsFilterTopic& filter_topic) noexcept;
@@ -96,6 +110,10 @@ struct ModelParser
     static std::vector<TopicKeysData> topics_keys(
             SpyModel& model,
             const ddspipe::core::types::WildcardDdsFilterTopic& filter_topic) noexcept;
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    static std::vector<TopicInstancesData> topics_instances(
+            SpyModel& model,
+            const ddspipe::core::types::WildcardDdsFilterTopic& filter_topic) noexcept;
 };
 
 } /* namespace participants */
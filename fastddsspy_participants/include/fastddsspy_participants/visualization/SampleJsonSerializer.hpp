@@ -0,0 +1,134 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+
+#include <fastddsspy_participants/library/library_dll.h>
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
+#include <fastddsspy_participants/visualization/CdrJsonSerializer.hpp>
+#include <fastddsspy_participants/visualization/JsonFormatter.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Writes the JSON shown by the echo command for a sample
+ *
+ * Samples whose type has a \c TypeLayout are written straight from the CDR payload by a \c CdrJsonSerializer.
+ * Any other sample (unsupported type or encapsulation, non ASCII strings, etc.) is deserialized by its
+ * \c TypeDecoder, serialized with Fast DDS \c json_serialize and re-formatted by a \c JsonFormatter.
+ * Both ways give the same text.
+ *
+ * The members written can be limited with \c select_fields. Then only samples whose type has a \c TypeLayout can
+ * be written, and the members not selected are skipped in the payload without being deserialized.
+ *
+ * The JSON is indented unless \c set_compact writes it in a single line, as the compact echo formats need.
+ *
+ * @warning Not thread safe: every thread must use its own serializer.
+ */
+class SampleJsonSerializer
+{
+public:
+
+    /**
+     * @brief Append the JSON of a sample to \c output
+     *
+     * @param decoder Decoder of the sample type
+     * @param data Sample to write
+     * @param output String to append the JSON to
+     *
+     * @return false if the sample could not be written, leaving \c output unchanged.
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool serialize(
+            TypeDecoder& decoder,
+            const ddspipe::core::types::RtpsPayloadData& data,
+            std::string& output);
+
+    /**
+     * @brief Write only the members in \c fields from now on
+     *
+     * @param fields Paths of the members to write (see \c cdr::build_field_projection), empty to write all of them
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void select_fields(
+            const std::vector<std::string>& fields);
+
+    //! Write the JSON in a single line with no whitespace from now on, or indented if \c compact is false
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    void set_compact(
+            bool compact);
+
+    /**
+     * @brief Whether the samples of the type of \c decoder can be written with the fields selected
+     *
+     * @param error Set to the reason they cannot be written
+     */
+    FASTDDSSPY_PARTICIPANTS_DllAPI
+    bool can_serialize(
+            const TypeDecoder& decoder,
+            std::string& error);
+
+protected:
+
+    /**
+     * @brief Projection of the fields selected for the type of \c decoder, compiled once per type
+     *
+     * @return nullptr if the type has no \c TypeLayout or the fields are not members of the type.
+     */
+    std::shared_ptr<const cdr::FieldProjection> projection_(
+            const TypeDecoder& decoder,
+            std::string& error);
+
+    //! Write the sample through \c DynamicData and Fast DDS JSON serialization
+    bool serialize_dynamic_data_(
+            TypeDecoder& decoder,
+            const ddspipe::core::types::RtpsPayloadData& data,
+            std::string& output);
+
+    CdrJsonSerializer cdr_serializer_;
+
+    JsonFormatter json_formatter_ {CdrJsonSerializer::INDENT_STEP};
+
+    //! Whether the JSON is written in a single line
+    bool compact_ {false};
+
+    //! Indented JSON of the generic path before being compacted, kept to reuse its memory
+    std::string formatted_json_;
+
+    //! Paths of the members to write, empty to write all of them
+    std::vector<std::string> fields_;
+
+    //! Projection of \c fields_ compiled for a type, or why it could not be compiled
+    struct CompiledProjection
+    {
+        std::shared_ptr<const cdr::FieldProjection> projection;
+        std::string error;
+    };
+
+    //! Projection of \c fields_ for each type layout
+    std::map<std::shared_ptr<const cdr::TypeLayout>, CompiledProjection> projections_;
+};
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
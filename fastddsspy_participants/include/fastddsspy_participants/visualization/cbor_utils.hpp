@@ -0,0 +1,69 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Append the head of a CBOR map of \c size pairs, which must follow it as key and value items
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+void append_cbor_map(
+        std::size_t size,
+        std::string& output);
+
+/**
+ * @brief Append a CBOR text string with the text of \c chars
+ *
+ * @pre \c chars is valid UTF-8
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+void append_cbor_text(
+        const char* chars,
+        std::size_t length,
+        std::string& output);
+
+//! Append a CBOR integer, in its shortest encoding
+FASTDDSSPY_PARTICIPANTS_DllAPI
+void append_cbor_integer(
+        int64_t value,
+        std::string& output);
+
+/**
+ * @brief Append the CBOR item of a JSON document, with no JSON tree
+ *
+ * Objects and arrays are written as maps and arrays of indefinite length, so they are written as they are read.
+ * Integers are written as CBOR integers and any other number as a single precision float if that keeps its value,
+ * or as a double precision float otherwise.
+ *
+ * @return false if \c json is not a valid JSON document. \c output is left unchanged in that case.
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+bool append_cbor_json(
+        const char* json,
+        std::size_t size,
+        std::string& output);
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,76 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <string>
+
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
+
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Machine readable formats of the echo command, with one record per sample
+ *
+ * Every record holds the topic name, the type name, the GUID of the writer, the source timestamp in nanoseconds and
+ * the data of the sample, in this order.
+ */
+enum class CompactFormat
+{
+    //! A JSON object per line
+    ndjson,
+
+    //! A line of comma separated values per sample, after a header line with the column names
+    csv,
+
+    //! A CBOR map per sample, written back to back with no separator
+    cbor,
+};
+
+/**
+ * @brief Text written once before the records of \c format
+ *
+ * @return The header line of \c csv, empty for the other formats.
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+std::string compact_format_header(
+        CompactFormat format);
+
+/**
+ * @brief Append the record of a sample in \c format to \c output
+ *
+ * @param format Format of the record
+ * @param topic Topic of the sample
+ * @param data Sample, for its metadata
+ * @param json Data of the sample as compact JSON (see \c SampleJsonSerializer::set_compact)
+ * @param output String to append the record to
+ *
+ * @return false if \c json is not a valid JSON document, leaving \c output unchanged.
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+bool append_compact_record(
+        CompactFormat format,
+        const ddspipe::core::types::DdsTopic& topic,
+        const ddspipe::core::types::RtpsPayloadData& data,
+        const std::string& json,
+        std::string& output);
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
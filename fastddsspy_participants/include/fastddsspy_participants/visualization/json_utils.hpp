@@ -0,0 +1,65 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <fastddsspy_participants/library/library_dll.h>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+/**
+ * @brief Append a JSON string with the text of \c chars, quoted and escaped as \c nlohmann::json dump does
+ *
+ * Quotes, backslashes and control characters are escaped. Any other byte is copied as is.
+ *
+ * @pre \c chars is valid UTF-8
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+void append_json_string(
+        const char* chars,
+        std::size_t length,
+        std::string& output);
+
+/**
+ * @brief Append a JSON floating point number as \c nlohmann::json dump does
+ *
+ * Uses the shortest representation that reads back to the same value, and \c null for non finite values.
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+void append_json_float(
+        double value,
+        std::string& output);
+
+/**
+ * @brief Append a JSON document with all the whitespace outside its strings removed
+ *
+ * Gives the single line text that \c nlohmann::json dump with no indentation gives for a document already written
+ * that way with indentation.
+ *
+ * @pre \c json is a valid JSON document
+ */
+FASTDDSSPY_PARTICIPANTS_DllAPI
+void append_compact_json(
+        const char* json,
+        std::size_t size,
+        std::string& output);
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -59,6 +59,33 @@ struct SimpleEndpointData
     Topic topic;
 };
 
+struct LatencyData
+{
+    uint64_t samples;
+    double mean;
+    double p50;
+    double p90;
+    double p99;
+    double p999;
+    double max;
+    std::string unit;
+};
+
+//! Samples of a writer checked against their sequence numbers, none received if there are no samples to check
+struct SamplesData
+{
+    uint64_t received {0};
+    uint64_t lost {0};
+    uint64_t out_of_order {0};
+    uint64_t duplicates {0};
+
+    //! Share of the samples lost in the rate window
+    double loss {0};
+    std::string loss_unit;
+
+    LatencyData jitter;
+};
+
 struct ComplexEndpointData
 {
     struct ExtendedTopic
@@ -78,6 +105,23 @@ struct ComplexEndpointData
     std::string participant_name;
     ExtendedTopic topic;
     QoS qos;
+    SamplesData samples;
+};
+
+struct PayloadSizeData
+{
+    struct Bucket
+    {
+        uint64_t lower_bound;
+        uint64_t upper_bound;
+        uint64_t count;
+    };
+
+    uint32_t min;
+    double mean;
+    uint32_t max;
+    std::string unit;
+    std::vector<Bucket> histogram;
 };
 
 struct SimpleTopicData
@@ -93,6 +137,9 @@ struct SimpleTopicData
     int datawriters;
     int datareaders;
     Rate rate;
+    Rate average_rate;
+    Rate bandwidth;
+    PayloadSizeData payload_size;
 };
 
 struct ComplexTopicData
@@ -103,12 +150,46 @@ struct ComplexTopicData
         std::string partition;
     };
 
+    struct WriterTraffic
+    {
+        ddspipe::core::types::Guid guid;
+        SimpleTopicData::Rate bandwidth;
+        PayloadSizeData payload_size;
+        SamplesData samples;
+    };
+
     std::string name;
     std::string type;
     std::vector<Endpoint> datawriters;
     std::vector<Endpoint> datareaders;
     SimpleTopicData::Rate rate;
+    SimpleTopicData::Rate average_rate;
     bool discovered;
+    SimpleTopicData::Rate bandwidth;
+    PayloadSizeData payload_size;
+    std::vector<WriterTraffic> datawriters_traffic;
+};
+
+struct TopicLatencyData
+{
+    struct Writer
+    {
+        ddspipe::core::types::Guid guid;
+        LatencyData latency;
+    };
+
+    std::string name;
+    std::string type;
+    LatencyData latency;
+    std::vector<Writer> datawriters;
+};
+
+struct TopTopicData
+{
+    std::string name;
+    int datawriters;
+    SimpleTopicData::Rate rate;
+    SimpleTopicData::Rate bandwidth;
 };
 
 struct DdsDataData
@@ -121,10 +202,42 @@ struct DdsDataData
 
 struct TopicKeysData
 {
+    //! Instances evicted to make room for newer ones, by the limit that was reached
+    struct Evictions
+    {
+        uint64_t per_topic_limit {0};
+        uint64_t total_limit {0};
+        uint64_t memory_limit {0};
+    };
+
     std::string topic_name;
     std::vector<std::string> key_fields;
     std::vector<std::string> instances;
     size_t instance_count;
+    Evictions evictions;
+};
+
+struct InstanceData
+{
+    //! JSON representation of the key fields
+    std::string key;
+    std::string state;
+    int writers;
+    uint64_t samples;
+    SimpleTopicData::Rate rate;
+
+    //! Mean size of the payloads
+    SimpleTopicData::Rate payload_size;
+};
+
+struct TopicInstancesData
+{
+    std::string topic_name;
+    std::vector<std::string> key_fields;
+
+    //! Instances with the highest rate first
+    std::vector<InstanceData> instances;
+    TopicKeysData::Evictions evictions;
 };
 
 } /* namespace participants */
@@ -0,0 +1,243 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastddsspy_participants/cdr/CdrReader.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+namespace cdr {
+
+namespace {
+
+// Encapsulation identifiers (RTPS 2.5, 10.5)
+constexpr uint16_t CDR_BE = 0x0000;
+constexpr uint16_t CDR_LE = 0x0001;
+constexpr uint16_t CDR2_BE = 0x0006;
+constexpr uint16_t CDR2_LE = 0x0007;
+constexpr uint16_t D_CDR2_BE = 0x0008;
+constexpr uint16_t D_CDR2_LE = 0x0009;
+
+bool host_is_little_endian() noexcept
+{
+    const uint16_t probe = 1;
+    return *reinterpret_cast<const uint8_t*>(&probe) == 1;
+}
+
+} /* namespace */
+
+constexpr std::size_t CdrReader::ENCAPSULATION_SIZE;
+
+bool CdrReader::reset(
+        const uint8_t* data,
+        std::size_t size) noexcept
+{
+    if (data == nullptr || size < ENCAPSULATION_SIZE)
+    {
+        return false;
+    }
+
+    const uint16_t encapsulation = static_cast<uint16_t>((data[0] << 8) | data[1]);
+    switch (encapsulation)
+    {
+        case CDR_BE:
+        case CDR_LE:
+            xcdr2_ = false;
+            max_alignment_ = 8;
+            break;
+
+        case CDR2_BE:
+        case CDR2_LE:
+        case D_CDR2_BE:
+        case D_CDR2_LE:
+            xcdr2_ = true;
+            max_alignment_ = 4;
+            break;
+
+        default:
+            // Parameter lists (mutable types) are not supported
+            return false;
+    }
+
+    const bool little_endian = (encapsulation & 0x0001) != 0;
+    swap_ = (little_endian != host_is_little_endian());
+
+    data_ = data;
+    size_ = size;
+    position_ = ENCAPSULATION_SIZE;
+    return true;
+}
+
+bool CdrReader::read_string(
+        const char*& chars,
+        uint32_t& length) noexcept
+{
+    uint32_t serialized_length;
+    if (!read(serialized_length) || serialized_length > size_ - position_)
+    {
+        return false;
+    }
+
+    chars = reinterpret_cast<const char*>(data_ + position_);
+    position_ += serialized_length;
+
+    // Serialized length counts the null terminator
+    length = serialized_length;
+    if (length > 0 && chars[length - 1] == '\0')
+    {
+        --length;
+    }
+    return true;
+}
+
+bool CdrReader::skip(
+        std::size_t element_size,
+        std::size_t count) noexcept
+{
+    if (count == 0)
+    {
+        return true;
+    }
+
+    if (!align(element_size) || count > (size_ - position_) / element_size)
+    {
+        return false;
+    }
+    position_ += element_size * count;
+    return true;
+}
+
+bool CdrReader::skip_value(
+        const TypeLayout& layout) noexcept
+{
+    if (layout.is_primitive())
+    {
+        return skip(layout.primitive_size, 1);
+    }
+
+    switch (layout.kind)
+    {
+        case TypeLayoutKind::string:
+        {
+            const char* chars;
+            uint32_t length;
+            return read_string(chars, length);
+        }
+
+        case TypeLayoutKind::structure:
+        {
+            std::size_t end;
+            if (!read_delimiter(layout.appendable, end))
+            {
+                return false;
+            }
+            if (end > 0)
+            {
+                return close_delimiter(end);
+            }
+            for (const auto& member : layout.members)
+            {
+                if (!skip_value(*member.layout))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        case TypeLayoutKind::sequence:
+        case TypeLayoutKind::array:
+        {
+            const TypeLayout& element = *layout.element;
+            std::size_t end;
+            if (!read_delimiter(!element.is_primitive(), end))
+            {
+                return false;
+            }
+            if (end > 0)
+            {
+                return close_delimiter(end);
+            }
+
+            uint32_t count = layout.bound;
+            if (layout.kind == TypeLayoutKind::sequence && !read(count))
+            {
+                return false;
+            }
+
+            if (element.is_primitive())
+            {
+                return skip(element.primitive_size, count);
+            }
+
+            if (count > size_ - position_ &&
+                    !(element.kind == TypeLayoutKind::structure && element.members.empty()))
+            {
+                return false;
+            }
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                if (!skip_value(element))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+bool CdrReader::read_delimiter(
+        bool delimited,
+        std::size_t& end) noexcept
+{
+    end = 0;
+    if (!delimited || !xcdr2_)
+    {
+        return true;
+    }
+
+    uint32_t size;
+    if (!read(size) || size > size_ - position_)
+    {
+        return false;
+    }
+    end = position_ + size;
+    return true;
+}
+
+bool CdrReader::close_delimiter(
+        std::size_t end) noexcept
+{
+    if (end == 0)
+    {
+        return true;
+    }
+
+    // Skip members unknown to this type (appendable types may grow)
+    if (position_ > end)
+    {
+        return false;
+    }
+    position_ = end;
+    return true;
+}
+
+} /* namespace cdr */
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,1317 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#include <fastddsspy_participants/cdr/ContentFilter.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+namespace cdr {
+
+namespace {
+
+using Node = FilterExpression::Node;
+
+//! Maximum nesting of parentheses and NOT, so that no expression can exhaust the stack
+constexpr std::size_t MAX_NESTING = 64;
+
+struct Token
+{
+    enum class Kind : uint8_t
+    {
+        end,
+        identifier,
+        integer,
+        real,
+        string,
+        comparison,
+        open,
+        close,
+        keyword_and,
+        keyword_or,
+        keyword_not,
+        keyword_between,
+        keyword_like,
+        keyword_true,
+        keyword_false,
+    };
+
+    Kind kind {Kind::end};
+
+    //! Identifier or string
+    std::string text;
+
+    //! Operator of comparisons
+    Node::Kind comparison {Node::Kind::equal};
+
+    int64_t integer {0};
+
+    double real {0};
+};
+
+//! Whether \c word is \c keyword, ignoring case
+bool is_keyword(
+        const std::string& word,
+        const char* keyword) noexcept
+{
+    const std::size_t length = std::strlen(keyword);
+    if (word.size() != length)
+    {
+        return false;
+    }
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        if (std::toupper(static_cast<unsigned char>(word[i])) != keyword[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool is_identifier_start(
+        char c) noexcept
+{
+    return std::isalpha(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool is_identifier_char(
+        char c) noexcept
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+}
+
+bool is_digit(
+        char c) noexcept
+{
+    return std::isdigit(static_cast<unsigned char>(c));
+}
+
+/**
+ * @brief Recursive descent parser of DDS-SQL filter expressions
+ *
+ * OR binds weaker than AND, which binds weaker than NOT. Chains of AND and OR are parsed into a single node.
+ */
+class Parser
+{
+public:
+
+    Parser(
+            const std::string& text)
+        : text_(text)
+    {
+        // Do nothing
+    }
+
+    std::unique_ptr<Node> parse(
+            std::string& error)
+    {
+        if (!next_(error))
+        {
+            return nullptr;
+        }
+
+        auto root = parse_or_(0, error);
+        if (root && token_.kind != Token::Kind::end)
+        {
+            unexpected_(error);
+            return nullptr;
+        }
+        return root;
+    }
+
+protected:
+
+    //! Read the next token
+    bool next_(
+            std::string& error)
+    {
+        while (position_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[position_])))
+        {
+            ++position_;
+        }
+
+        token_start_ = position_;
+        token_ = Token();
+        if (position_ == text_.size())
+        {
+            return true;
+        }
+
+        const char c = text_[position_];
+        const char following = position_ + 1 < text_.size() ? text_[position_ + 1] : '\0';
+
+        if (is_identifier_start(c))
+        {
+            return next_identifier_(error);
+        }
+
+        if (is_digit(c) || ((c == '-' || c == '+' || c == '.') && (is_digit(following) || following == '.')))
+        {
+            return next_number_(error);
+        }
+
+        ++position_;
+        switch (c)
+        {
+            case '\'':
+            {
+                const std::size_t end = text_.find('\'', position_);
+                if (end == std::string::npos)
+                {
+                    error = "String starting at position " + std::to_string(token_start_) + " is not terminated.";
+                    return false;
+                }
+                token_.kind = Token::Kind::string;
+                token_.text = text_.substr(position_, end - position_);
+                position_ = end + 1;
+                return true;
+            }
+
+            case '(':
+                token_.kind = Token::Kind::open;
+                return true;
+
+            case ')':
+                token_.kind = Token::Kind::close;
+                return true;
+
+            case '=':
+                return comparison_(Node::Kind::equal);
+
+            case '<':
+                if (following == '=')
+                {
+                    ++position_;
+                    return comparison_(Node::Kind::less_equal);
+                }
+                if (following == '>')
+                {
+                    ++position_;
+                    return comparison_(Node::Kind::not_equal);
+                }
+                return comparison_(Node::Kind::less);
+
+            case '>':
+                if (following == '=')
+                {
+                    ++position_;
+                    return comparison_(Node::Kind::greater_equal);
+                }
+                return comparison_(Node::Kind::greater);
+
+            case '!':
+                if (following == '=')
+                {
+                    ++position_;
+                    return comparison_(Node::Kind::not_equal);
+                }
+                break;
+
+            case '%':
+                error = "Parameters (%0, %1...) are not supported.";
+                return false;
+
+            default:
+                break;
+        }
+
+        error = "Unexpected character <" + std::string(1, c) + "> at position " + std::to_string(token_start_) + ".";
+        return false;
+    }
+
+    bool comparison_(
+            Node::Kind kind) noexcept
+    {
+        token_.kind = Token::Kind::comparison;
+        token_.comparison = kind;
+        return true;
+    }
+
+    bool next_identifier_(
+            std::string& error)
+    {
+        // Member paths are identifiers separated by dots
+        while (position_ < text_.size() && is_identifier_char(text_[position_]))
+        {
+            ++position_;
+            if (position_ + 1 < text_.size() && text_[position_] == '.')
+            {
+                if (!is_identifier_start(text_[position_ + 1]))
+                {
+                    error = "Field <" + text_.substr(token_start_, position_ + 1 - token_start_) +
+                            "> is not a valid member path.";
+                    return false;
+                }
+                ++position_;
+            }
+        }
+
+        token_.text = text_.substr(token_start_, position_ - token_start_);
+        token_.kind = Token::Kind::identifier;
+        if (is_keyword(token_.text, "AND"))
+        {
+            token_.kind = Token::Kind::keyword_and;
+        }
+        else if (is_keyword(token_.text, "OR"))
+        {
+            token_.kind = Token::Kind::keyword_or;
+        }
+        else if (is_keyword(token_.text, "NOT"))
+        {
+            token_.kind = Token::Kind::keyword_not;
+        }
+        else if (is_keyword(token_.text, "BETWEEN"))
+        {
+            token_.kind = Token::Kind::keyword_between;
+        }
+        else if (is_keyword(token_.text, "LIKE"))
+        {
+            token_.kind = Token::Kind::keyword_like;
+        }
+        else if (is_keyword(token_.text, "TRUE"))
+        {
+            token_.kind = Token::Kind::keyword_true;
+        }
+        else if (is_keyword(token_.text, "FALSE"))
+        {
+            token_.kind = Token::Kind::keyword_false;
+        }
+        return true;
+    }
+
+    bool next_number_(
+            std::string& error)
+    {
+        const char* begin = text_.c_str() + token_start_;
+        char* end = nullptr;
+
+        bool real = false;
+        std::size_t digits = token_start_;
+        if (text_[digits] == '-' || text_[digits] == '+')
+        {
+            ++digits;
+        }
+        const bool hexadecimal = text_.compare(digits, 2, "0x") == 0 || text_.compare(digits, 2, "0X") == 0;
+        if (!hexadecimal)
+        {
+            for (std::size_t i = digits; i < text_.size() && (is_identifier_char(text_[i]) || text_[i] == '.'); ++i)
+            {
+                real = real || text_[i] == '.' || text_[i] == 'e' || text_[i] == 'E';
+            }
+        }
+
+        errno = 0;
+        if (!real)
+        {
+            token_.kind = Token::Kind::integer;
+            token_.integer = std::strtoll(begin, &end, hexadecimal ? 16 : 10);
+            // Integers too large for int64 (e.g. big uint64 values) are compared as reals
+            real = errno == ERANGE;
+        }
+        if (real)
+        {
+            errno = 0;
+            token_.kind = Token::Kind::real;
+            token_.real = std::strtod(begin, &end);
+        }
+
+        position_ = static_cast<std::size_t>(end - text_.c_str());
+        if (end == begin || errno == ERANGE ||
+                (position_ < text_.size() && (is_identifier_char(text_[position_]) || text_[position_] == '.')))
+        {
+            error = "Number at position " + std::to_string(token_start_) + " is not valid.";
+            return false;
+        }
+        return true;
+    }
+
+    void unexpected_(
+            std::string& error) const
+    {
+        if (token_.kind == Token::Kind::end)
+        {
+            error = "Unexpected end of the expression.";
+        }
+        else
+        {
+            error = "Unexpected <" + text_.substr(token_start_, position_ - token_start_) + "> at position " +
+                    std::to_string(token_start_) + ".";
+        }
+    }
+
+    std::unique_ptr<Node> parse_or_(
+            std::size_t nesting,
+            std::string& error)
+    {
+        return parse_chain_(Token::Kind::keyword_or, Node::Kind::logical_or, nesting, error);
+    }
+
+    //! Parse conditions separated by \c separator, joined in a single \c kind node if there are several
+    std::unique_ptr<Node> parse_chain_(
+            Token::Kind separator,
+            Node::Kind kind,
+            std::size_t nesting,
+            std::string& error)
+    {
+        auto first = kind == Node::Kind::logical_or ?
+                parse_chain_(Token::Kind::keyword_and, Node::Kind::logical_and, nesting, error) :
+                parse_not_(nesting, error);
+        if (!first || token_.kind != separator)
+        {
+            return first;
+        }
+
+        std::unique_ptr<Node> chain(new Node());
+        chain->kind = kind;
+        chain->children.push_back(std::move(first));
+        while (token_.kind == separator)
+        {
+            if (!next_(error))
+            {
+                return nullptr;
+            }
+            auto condition = kind == Node::Kind::logical_or ?
+                    parse_chain_(Token::Kind::keyword_and, Node::Kind::logical_and, nesting, error) :
+                    parse_not_(nesting, error);
+            if (!condition)
+            {
+                return nullptr;
+            }
+            chain->children.push_back(std::move(condition));
+        }
+        return chain;
+    }
+
+    std::unique_ptr<Node> parse_not_(
+            std::size_t nesting,
+            std::string& error)
+    {
+        if (nesting >= MAX_NESTING)
+        {
+            error = "Expression is nested too deeply.";
+            return nullptr;
+        }
+
+        if (token_.kind == Token::Kind::keyword_not)
+        {
+            if (!next_(error))
+            {
+                return nullptr;
+            }
+            auto condition = parse_not_(nesting + 1, error);
+            if (!condition)
+            {
+                return nullptr;
+            }
+            std::unique_ptr<Node> negation(new Node());
+            negation->kind = Node::Kind::logical_not;
+            negation->children.push_back(std::move(condition));
+            return negation;
+        }
+
+        if (token_.kind == Token::Kind::open)
+        {
+            if (!next_(error))
+            {
+                return nullptr;
+            }
+            auto condition = parse_or_(nesting + 1, error);
+            if (!condition)
+            {
+                return nullptr;
+            }
+            if (token_.kind != Token::Kind::close)
+            {
+                unexpected_(error);
+                return nullptr;
+            }
+            if (!next_(error))
+            {
+                return nullptr;
+            }
+            return condition;
+        }
+
+        return parse_predicate_(error);
+    }
+
+    std::unique_ptr<Node> parse_predicate_(
+            std::string& error)
+    {
+        std::unique_ptr<Node> predicate(new Node());
+        auto operand = parse_operand_(error);
+        if (!operand)
+        {
+            return nullptr;
+        }
+        predicate->children.push_back(std::move(operand));
+
+        bool negated = false;
+        switch (token_.kind)
+        {
+            case Token::Kind::comparison:
+                predicate->kind = token_.comparison;
+                break;
+
+            case Token::Kind::keyword_like:
+                predicate->kind = Node::Kind::like;
+                break;
+
+            case Token::Kind::keyword_not:
+                if (!next_(error))
+                {
+                    return nullptr;
+                }
+                if (token_.kind != Token::Kind::keyword_between)
+                {
+                    unexpected_(error);
+                    return nullptr;
+                }
+                negated = true;
+                predicate->kind = Node::Kind::between;
+                break;
+
+            case Token::Kind::keyword_between:
+                predicate->kind = Node::Kind::between;
+                break;
+
+            default:
+                unexpected_(error);
+                return nullptr;
+        }
+
+        if (!next_(error) || !(operand = parse_operand_(error)))
+        {
+            return nullptr;
+        }
+        predicate->children.push_back(std::move(operand));
+
+        if (predicate->kind == Node::Kind::between)
+        {
+            if (token_.kind != Token::Kind::keyword_and)
+            {
+                unexpected_(error);
+                return nullptr;
+            }
+            if (!next_(error) || !(operand = parse_operand_(error)))
+            {
+                return nullptr;
+            }
+            predicate->children.push_back(std::move(operand));
+        }
+
+        if (!negated)
+        {
+            return predicate;
+        }
+
+        std::unique_ptr<Node> negation(new Node());
+        negation->kind = Node::Kind::logical_not;
+        negation->children.push_back(std::move(predicate));
+        return negation;
+    }
+
+    std::unique_ptr<Node> parse_operand_(
+            std::string& error)
+    {
+        std::unique_ptr<Node> operand(new Node());
+        switch (token_.kind)
+        {
+            case Token::Kind::identifier:
+                operand->kind = Node::Kind::field;
+                operand->text = std::move(token_.text);
+                break;
+
+            case Token::Kind::string:
+                operand->kind = Node::Kind::string;
+                operand->text = std::move(token_.text);
+                break;
+
+            case Token::Kind::integer:
+                operand->kind = Node::Kind::integer;
+                operand->integer = token_.integer;
+                break;
+
+            case Token::Kind::real:
+                operand->kind = Node::Kind::real;
+                operand->real = token_.real;
+                break;
+
+            case Token::Kind::keyword_true:
+            case Token::Kind::keyword_false:
+                operand->kind = Node::Kind::boolean;
+                operand->integer = token_.kind == Token::Kind::keyword_true ? 1 : 0;
+                break;
+
+            default:
+                unexpected_(error);
+                return nullptr;
+        }
+
+        if (!next_(error))
+        {
+            return nullptr;
+        }
+        return operand;
+    }
+
+    const std::string& text_;
+
+    std::size_t position_ {0};
+
+    //! Position of the first character of the current token
+    std::size_t token_start_ {0};
+
+    Token token_;
+};
+
+//! Text of an operand for error messages
+std::string describe(
+        const Node& node)
+{
+    switch (node.kind)
+    {
+        case Node::Kind::field:
+            return node.text;
+
+        case Node::Kind::string:
+            return "'" + node.text + "'";
+
+        case Node::Kind::integer:
+            return std::to_string(node.integer);
+
+        case Node::Kind::real:
+            return std::to_string(node.real);
+
+        default:
+            return node.integer ? "TRUE" : "FALSE";
+    }
+}
+
+template <typename T>
+bool read_integer(
+        CdrReader& reader,
+        int64_t& value) noexcept
+{
+    T read_value;
+    if (!reader.read(read_value))
+    {
+        return false;
+    }
+    value = read_value;
+    return true;
+}
+
+} /* namespace */
+
+std::shared_ptr<const FilterExpression> FilterExpression::parse(
+        const std::string& expression,
+        std::string& error)
+{
+    auto filter_expression = std::make_shared<FilterExpression>();
+    filter_expression->text_ = expression;
+    filter_expression->root_ = Parser(filter_expression->text_).parse(error);
+    if (!filter_expression->root_)
+    {
+        return nullptr;
+    }
+    return filter_expression;
+}
+
+std::shared_ptr<const ContentFilter> ContentFilter::compile(
+        const FilterExpression& expression,
+        const std::shared_ptr<const TypeLayout>& layout,
+        std::string& error)
+{
+    if (layout->kind != TypeLayoutKind::structure)
+    {
+        error = "Type is not a structure.";
+        return nullptr;
+    }
+
+    auto filter = std::make_shared<ContentFilter>();
+    filter->layout_ = layout;
+    filter->plan_.members.resize(layout->members.size());
+    if (!filter->compile_condition_(expression.root(), error))
+    {
+        return nullptr;
+    }
+    return filter;
+}
+
+bool ContentFilter::evaluate(
+        const uint8_t* data,
+        std::size_t size) const
+{
+    static const Value false_value {};
+    static const Value true_value {Value::Kind::integer, 1};
+
+    // Scratch space of the thread, so that evaluating a sample does not allocate
+    thread_local std::vector<Value> values;
+    thread_local std::vector<const Value*> stack;
+    values.resize(slot_count_);
+    stack.resize(stack_size_);
+
+    if (slot_count_ > 0)
+    {
+        CdrReader reader;
+        if (!reader.reset(data, size) || !read_structure_(reader, *layout_, plan_, true, values.data()))
+        {
+            return false;
+        }
+    }
+
+    std::size_t top = 0;
+    std::size_t counter = 0;
+    while (counter < program_.size())
+    {
+        const Instruction& instruction = program_[counter++];
+        switch (instruction.code)
+        {
+            case OpCode::push_field:
+                stack[top++] = &values[instruction.argument];
+                break;
+
+            case OpCode::push_constant:
+                stack[top++] = &constants_[instruction.argument];
+                break;
+
+            case OpCode::like:
+            {
+                const Value* pattern = stack[--top];
+                stack[top - 1] = like_(*stack[top - 1], *pattern) ? &true_value : &false_value;
+                break;
+            }
+
+            case OpCode::between:
+            {
+                const Value* high = stack[--top];
+                const Value* low = stack[--top];
+                const Value* value = stack[top - 1];
+                stack[top - 1] = compare_(OpCode::greater_equal, *value, *low) &&
+                        compare_(OpCode::less_equal, *value, *high) ? &true_value : &false_value;
+                break;
+            }
+
+            case OpCode::logical_not:
+                stack[top - 1] = stack[top - 1]->integer ? &false_value : &true_value;
+                break;
+
+            case OpCode::jump_if_false:
+            case OpCode::jump_if_true:
+                if ((stack[top - 1]->integer != 0) == (instruction.code == OpCode::jump_if_true))
+                {
+                    counter = instruction.argument;
+                }
+                else
+                {
+                    --top;
+                }
+                break;
+
+            default:
+            {
+                const Value* right = stack[--top];
+                stack[top - 1] = compare_(instruction.code, *stack[top - 1], *right) ? &true_value : &false_value;
+                break;
+            }
+        }
+    }
+
+    return top > 0 && stack[top - 1]->integer != 0;
+}
+
+void ContentFilter::emit_(
+        OpCode code,
+        uint32_t argument,
+        int32_t depth_change)
+{
+    program_.push_back({code, argument});
+    depth_ = static_cast<uint32_t>(static_cast<int32_t>(depth_) + depth_change);
+    stack_size_ = std::max(stack_size_, depth_);
+}
+
+bool ContentFilter::compile_field_(
+        const std::string& path,
+        uint32_t& slot,
+        const TypeLayout*& field,
+        std::string& error)
+{
+    const TypeLayout* layout = layout_.get();
+    ReadPlan* plan = &plan_;
+    std::size_t begin = 0;
+    while (true)
+    {
+        if (layout->kind != TypeLayoutKind::structure)
+        {
+            error = "Field <" + path + "> goes through a member that is not a structure.";
+            return false;
+        }
+
+        const std::size_t end = std::min(path.find('.', begin), path.size());
+        const uint32_t index = layout->member_index(path.substr(begin, end - begin));
+        if (index == layout->members.size())
+        {
+            error = "Field <" + path + "> is not a member of the type.";
+            return false;
+        }
+
+        plan->last_member = std::max(plan->last_member, index);
+        auto& member = plan->members[index];
+        layout = layout->members[index].layout.get();
+
+        if (end == path.size())
+        {
+            if (layout->kind == TypeLayoutKind::structure ||
+                    layout->kind == TypeLayoutKind::sequence ||
+                    layout->kind == TypeLayoutKind::array)
+            {
+                error = "Field <" + path + "> is not a primitive, string or enumeration member.";
+                return false;
+            }
+
+            // Fields used several times are read once
+            if (member.slot < 0)
+            {
+                member.slot = static_cast<int32_t>(slot_count_++);
+            }
+            slot = static_cast<uint32_t>(member.slot);
+            field = layout;
+            return true;
+        }
+
+        if (!member.nested && layout->kind == TypeLayoutKind::structure)
+        {
+            member.nested.reset(new ReadPlan());
+            member.nested->members.resize(layout->members.size());
+        }
+        plan = member.nested.get();
+        begin = end + 1;
+    }
+}
+
+bool ContentFilter::operand_kind_(
+        const FilterExpression::Node& node,
+        OperandKind& kind,
+        const TypeLayout*& field,
+        std::string& error)
+{
+    field = nullptr;
+    switch (node.kind)
+    {
+        case Node::Kind::field:
+        {
+            uint32_t slot;
+            if (!compile_field_(node.text, slot, field, error))
+            {
+                return false;
+            }
+            switch (field->kind)
+            {
+                case TypeLayoutKind::boolean:
+                    kind = OperandKind::boolean;
+                    break;
+
+                case TypeLayoutKind::char8:
+                case TypeLayoutKind::string:
+                    kind = OperandKind::string;
+                    break;
+
+                case TypeLayoutKind::enumeration:
+                    kind = OperandKind::enumeration;
+                    break;
+
+                default:
+                    kind = OperandKind::number;
+                    break;
+            }
+            return true;
+        }
+
+        case Node::Kind::string:
+            kind = OperandKind::string;
+            return true;
+
+        case Node::Kind::boolean:
+            kind = OperandKind::boolean;
+            return true;
+
+        default:
+            kind = OperandKind::number;
+            return true;
+    }
+}
+
+bool ContentFilter::compile_operand_(
+        const FilterExpression::Node& node,
+        const TypeLayout* enumeration,
+        std::string& error)
+{
+    Value constant;
+    switch (node.kind)
+    {
+        case Node::Kind::field:
+        {
+            uint32_t slot;
+            const TypeLayout* field;
+            if (!compile_field_(node.text, slot, field, error))
+            {
+                return false;
+            }
+            emit_(OpCode::push_field, slot, 1);
+            return true;
+        }
+
+        case Node::Kind::string:
+            if (enumeration)
+            {
+                // Enumerations are compared by value, so their literals are resolved once here
+                const auto literal = std::find_if(enumeration->literals.begin(), enumeration->literals.end(),
+                                [&node](const TypeLayout::EnumLiteral& enum_literal)
+                                {
+                                    return enum_literal.name == node.text;
+                                });
+                if (literal == enumeration->literals.end())
+                {
+                    error = "<" + node.text + "> is not a literal of the enumeration.";
+                    return false;
+                }
+                constant.integer = literal->value;
+                break;
+            }
+            texts_.push_back(node.text);
+            constant.kind = Value::Kind::string;
+            constant.chars = texts_.back().c_str();
+            constant.length = static_cast<uint32_t>(texts_.back().size());
+            break;
+
+        case Node::Kind::real:
+            constant.kind = Value::Kind::real;
+            constant.real = node.real;
+            break;
+
+        default:
+            constant.integer = node.integer;
+            break;
+    }
+
+    constants_.push_back(constant);
+    emit_(OpCode::push_constant, static_cast<uint32_t>(constants_.size() - 1), 1);
+    return true;
+}
+
+bool ContentFilter::compile_condition_(
+        const FilterExpression::Node& node,
+        std::string& error)
+{
+    switch (node.kind)
+    {
+        case Node::Kind::logical_and:
+        case Node::Kind::logical_or:
+        {
+            // Short circuit: the first condition that decides the result jumps to the end keeping it
+            const OpCode jump = node.kind == Node::Kind::logical_and ? OpCode::jump_if_false : OpCode::jump_if_true;
+            std::vector<std::size_t> jumps;
+            for (std::size_t i = 0; i < node.children.size(); ++i)
+            {
+                if (!compile_condition_(*node.children[i], error))
+                {
+                    return false;
+                }
+                if (i + 1 < node.children.size())
+                {
+                    jumps.push_back(program_.size());
+                    emit_(jump, 0, -1);
+                }
+            }
+            for (const auto index : jumps)
+            {
+                program_[index].argument = static_cast<uint32_t>(program_.size());
+            }
+            return true;
+        }
+
+        case Node::Kind::logical_not:
+            if (!compile_condition_(*node.children.front(), error))
+            {
+                return false;
+            }
+            emit_(OpCode::logical_not, 0, 0);
+            return true;
+
+        default:
+            break;
+    }
+
+    if (node.is_operand())
+    {
+        error = "<" + describe(node) + "> is not a condition.";
+        return false;
+    }
+
+    std::vector<OperandKind> kinds(node.children.size());
+    const TypeLayout* enumeration = nullptr;
+    for (std::size_t i = 0; i < node.children.size(); ++i)
+    {
+        const TypeLayout* field;
+        if (!operand_kind_(*node.children[i], kinds[i], field, error))
+        {
+            return false;
+        }
+        if (kinds[i] == OperandKind::enumeration)
+        {
+            enumeration = field;
+        }
+    }
+
+    for (std::size_t i = 1; i < node.children.size(); ++i)
+    {
+        const Node& left = *node.children.front();
+        const Node& right = *node.children[i];
+        OperandKind left_kind = kinds.front();
+        OperandKind right_kind = kinds[i];
+
+        bool comparable;
+        if (node.kind == Node::Kind::like)
+        {
+            comparable = left_kind == OperandKind::string && right_kind == OperandKind::string;
+        }
+        else if (left_kind == right_kind)
+        {
+            comparable = true;
+        }
+        else if (left_kind == OperandKind::enumeration || right_kind == OperandKind::enumeration)
+        {
+            // Enumerations compare with numbers and with the names of their literals
+            const Node& other = left_kind == OperandKind::enumeration ? right : left;
+            const OperandKind other_kind = left_kind == OperandKind::enumeration ? right_kind : left_kind;
+            comparable = other_kind == OperandKind::number ||
+                    (other_kind == OperandKind::string && other.kind == Node::Kind::string);
+        }
+        else
+        {
+            comparable = false;
+        }
+
+        if (!comparable)
+        {
+            error = "Cannot compare <" + describe(left) + "> with <" + describe(right) + ">.";
+            return false;
+        }
+    }
+
+    for (const auto& child : node.children)
+    {
+        if (!compile_operand_(*child, enumeration, error))
+        {
+            return false;
+        }
+    }
+
+    const int32_t depth_change = 1 - static_cast<int32_t>(node.children.size());
+    switch (node.kind)
+    {
+        case Node::Kind::equal:
+            emit_(OpCode::equal, 0, depth_change);
+            break;
+
+        case Node::Kind::not_equal:
+            emit_(OpCode::not_equal, 0, depth_change);
+            break;
+
+        case Node::Kind::less:
+            emit_(OpCode::less, 0, depth_change);
+            break;
+
+        case Node::Kind::less_equal:
+            emit_(OpCode::less_equal, 0, depth_change);
+            break;
+
+        case Node::Kind::greater:
+            emit_(OpCode::greater, 0, depth_change);
+            break;
+
+        case Node::Kind::greater_equal:
+            emit_(OpCode::greater_equal, 0, depth_change);
+            break;
+
+        case Node::Kind::like:
+            emit_(OpCode::like, 0, depth_change);
+            break;
+
+        default:
+            emit_(OpCode::between, 0, depth_change);
+            break;
+    }
+    return true;
+}
+
+bool ContentFilter::compare_(
+        OpCode code,
+        const Value& left,
+        const Value& right) noexcept
+{
+    int order;
+    if (left.kind == Value::Kind::string)
+    {
+        const uint32_t length = std::min(left.length, right.length);
+        order = length > 0 ? std::memcmp(left.chars, right.chars, length) : 0;
+        if (order == 0)
+        {
+            order = left.length < right.length ? -1 : (left.length > right.length ? 1 : 0);
+        }
+    }
+    else if (left.kind == Value::Kind::integer && right.kind == Value::Kind::integer)
+    {
+        order = left.integer < right.integer ? -1 : (left.integer > right.integer ? 1 : 0);
+    }
+    else
+    {
+        const double left_real = left.kind == Value::Kind::real ? left.real : static_cast<double>(left.integer);
+        const double right_real = right.kind == Value::Kind::real ? right.real : static_cast<double>(right.integer);
+        if (std::isnan(left_real) || std::isnan(right_real))
+        {
+            // NaN is not ordered, it is only different from everything
+            return code == OpCode::not_equal;
+        }
+        order = left_real < right_real ? -1 : (left_real > right_real ? 1 : 0);
+    }
+
+    switch (code)
+    {
+        case OpCode::equal:
+            return order == 0;
+
+        case OpCode::not_equal:
+            return order != 0;
+
+        case OpCode::less:
+            return order < 0;
+
+        case OpCode::less_equal:
+            return order <= 0;
+
+        case OpCode::greater:
+            return order > 0;
+
+        default:
+            return order >= 0;
+    }
+}
+
+bool ContentFilter::like_(
+        const Value& text,
+        const Value& pattern) noexcept
+{
+    // Greedy match that backtracks to the last % when the rest of the pattern does not match
+    std::size_t t = 0;
+    std::size_t p = 0;
+    std::size_t wildcard = std::numeric_limits<std::size_t>::max();
+    std::size_t resume = 0;
+    while (t < text.length)
+    {
+        if (p < pattern.length && pattern.chars[p] == '%')
+        {
+            wildcard = p++;
+            resume = t;
+        }
+        else if (p < pattern.length && (pattern.chars[p] == '_' || pattern.chars[p] == text.chars[t]))
+        {
+            ++p;
+            ++t;
+        }
+        else if (wildcard != std::numeric_limits<std::size_t>::max())
+        {
+            p = wildcard + 1;
+            t = ++resume;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    while (p < pattern.length && pattern.chars[p] == '%')
+    {
+        ++p;
+    }
+    return p == pattern.length;
+}
+
+bool ContentFilter::read_structure_(
+        CdrReader& reader,
+        const TypeLayout& layout,
+        const ReadPlan& plan,
+        bool root,
+        Value* values) const noexcept
+{
+    std::size_t end;
+    if (!reader.read_delimiter(layout.appendable, end))
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i <= plan.last_member; ++i)
+    {
+        const auto& member = plan.members[i];
+        const TypeLayout& member_layout = *layout.members[i].layout;
+
+        bool read;
+        if (member.nested)
+        {
+            read = read_structure_(reader, member_layout, *member.nested, false, values);
+        }
+        else if (member.slot >= 0)
+        {
+            read = read_value_(reader, member_layout, values[member.slot]);
+        }
+        else
+        {
+            read = reader.skip_value(member_layout);
+        }
+
+        if (!read)
+        {
+            return false;
+        }
+    }
+
+    if (end > 0)
+    {
+        return reader.close_delimiter(end);
+    }
+    if (root)
+    {
+        return true;
+    }
+
+    // The member that follows starts after the members not used
+    for (std::size_t i = plan.last_member + 1; i < layout.members.size(); ++i)
+    {
+        if (!reader.skip_value(*layout.members[i].layout))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ContentFilter::read_value_(
+        CdrReader& reader,
+        const TypeLayout& layout,
+        Value& value) noexcept
+{
+    value.kind = Value::Kind::integer;
+    switch (layout.kind)
+    {
+        case TypeLayoutKind::boolean:
+            return read_integer<bool>(reader, value.integer);
+
+        case TypeLayoutKind::int8:
+            return read_integer<int8_t>(reader, value.integer);
+
+        case TypeLayoutKind::uint8:
+            return read_integer<uint8_t>(reader, value.integer);
+
+        case TypeLayoutKind::int16:
+            return read_integer<int16_t>(reader, value.integer);
+
+        case TypeLayoutKind::uint16:
+            return read_integer<uint16_t>(reader, value.integer);
+
+        case TypeLayoutKind::int32:
+            return read_integer<int32_t>(reader, value.integer);
+
+        case TypeLayoutKind::uint32:
+            return read_integer<uint32_t>(reader, value.integer);
+
+        case TypeLayoutKind::int64:
+            return read_integer<int64_t>(reader, value.integer);
+
+        case TypeLayoutKind::uint64:
+        {
+            uint64_t read_value;
+            if (!reader.read(read_value))
+            {
+                return false;
+            }
+            if (read_value > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+            {
+                value.kind = Value::Kind::real;
+                value.real = static_cast<double>(read_value);
+            }
+            else
+            {
+                value.integer = static_cast<int64_t>(read_value);
+            }
+            return true;
+        }
+
+        case TypeLayoutKind::float32:
+        {
+            float read_value;
+            if (!reader.read(read_value))
+            {
+                return false;
+            }
+            value.kind = Value::Kind::real;
+            value.real = read_value;
+            return true;
+        }
+
+        case TypeLayoutKind::float64:
+            value.kind = Value::Kind::real;
+            return reader.read(value.real);
+
+        case TypeLayoutKind::char8:
+            value.kind = Value::Kind::string;
+            value.chars = &value.character;
+            value.length = 1;
+            return reader.read(value.character);
+
+        case TypeLayoutKind::string:
+            value.kind = Value::Kind::string;
+            return reader.read_string(value.chars, value.length) && (layout.bound == 0 || value.length <= layout.bound);
+
+        case TypeLayoutKind::enumeration:
+            switch (layout.primitive_size)
+            {
+                case 1:
+                    return read_integer<int8_t>(reader, value.integer);
+
+                case 2:
+                    return read_integer<int16_t>(reader, value.integer);
+
+                default:
+                    return read_integer<int32_t>(reader, value.integer);
+            }
+
+        default:
+            return false;
+    }
+}
+
+} /* namespace cdr */
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,144 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+
+#include <fastddsspy_participants/cdr/FieldProjection.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+namespace cdr {
+
+namespace {
+
+//! Path of a member, split in the names of the members it goes through
+struct MemberPath
+{
+    const std::string* text;
+    std::vector<std::string> names;
+};
+
+//! Projection of \c layout that selects the rest of \c paths after their first \c depth names
+std::shared_ptr<const FieldProjection> build_structure(
+        const TypeLayout& layout,
+        const std::vector<const MemberPath*>& paths,
+        std::size_t depth,
+        std::string& error)
+{
+    if (layout.kind != TypeLayoutKind::structure)
+    {
+        error = "Field <" + *paths.front()->text + "> goes through a member that is not a structure.";
+        return nullptr;
+    }
+
+    std::vector<bool> whole(layout.members.size(), false);
+    std::vector<std::vector<const MemberPath*>> nested(layout.members.size());
+    for (const auto* path : paths)
+    {
+        const uint32_t index = layout.member_index(path->names[depth]);
+        if (index == layout.members.size())
+        {
+            error = "Field <" + *path->text + "> is not a member of the type.";
+            return nullptr;
+        }
+
+        if (depth + 1 == path->names.size())
+        {
+            whole[index] = true;
+        }
+        else
+        {
+            nested[index].push_back(path);
+        }
+    }
+
+    static const auto all = std::make_shared<const FieldProjection>();
+
+    auto projection = std::make_shared<FieldProjection>();
+    projection->members.resize(layout.members.size());
+    for (uint32_t i = 0; i < layout.members.size(); ++i)
+    {
+        if (whole[i])
+        {
+            projection->members[i] = all;
+        }
+        else if (!nested[i].empty())
+        {
+            projection->members[i] = build_structure(*layout.members[i].layout, nested[i], depth + 1, error);
+            if (!projection->members[i])
+            {
+                return nullptr;
+            }
+        }
+        else
+        {
+            continue;
+        }
+        projection->last_member = i;
+    }
+
+    return projection;
+}
+
+} /* namespace */
+
+std::shared_ptr<const FieldProjection> build_field_projection(
+        const TypeLayout& layout,
+        const std::vector<std::string>& paths,
+        std::string& error)
+{
+    if (paths.empty())
+    {
+        error = "No fields selected.";
+        return nullptr;
+    }
+
+    std::vector<MemberPath> member_paths;
+    member_paths.reserve(paths.size());
+    for (const auto& path : paths)
+    {
+        MemberPath member_path {&path, {}};
+        std::size_t begin = 0;
+        while (true)
+        {
+            const std::size_t end = std::min(path.find('.', begin), path.size());
+            if (end == begin)
+            {
+                error = "Field <" + path + "> is not a valid member path.";
+                return nullptr;
+            }
+            member_path.names.push_back(path.substr(begin, end - begin));
+            if (end == path.size())
+            {
+                break;
+            }
+            begin = end + 1;
+        }
+        member_paths.push_back(std::move(member_path));
+    }
+
+    std::vector<const MemberPath*> top_paths;
+    for (const auto& member_path : member_paths)
+    {
+        top_paths.push_back(&member_path);
+    }
+
+    return build_structure(layout, top_paths, 0, error);
+}
+
+} /* namespace cdr */
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
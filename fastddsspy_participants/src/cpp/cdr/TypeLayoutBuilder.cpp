@@ -0,0 +1,303 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <string>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeMember.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/MemberDescriptor.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/TypeDescriptor.hpp>
+
+#include <cpp_utils/Log.hpp>
+
+#include <fastddsspy_participants/cdr/TypeLayoutBuilder.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+namespace cdr {
+
+namespace {
+
+std::shared_ptr<TypeLayout> primitive_layout(
+        TypeLayoutKind kind,
+        uint32_t size)
+{
+    auto layout = std::make_shared<TypeLayout>();
+    layout->kind = kind;
+    layout->primitive_size = size;
+    return layout;
+}
+
+fastdds::dds::TypeDescriptor::_ref_type get_descriptor(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type)
+{
+    auto descriptor = fastdds::dds::traits<fastdds::dds::TypeDescriptor>::make_shared();
+    if (!dyn_type || fastdds::dds::RETCODE_OK != dyn_type->get_descriptor(descriptor))
+    {
+        return nullptr;
+    }
+    return descriptor;
+}
+
+} /* namespace */
+
+constexpr unsigned int TypeLayoutBuilder::MAX_DEPTH;
+
+std::shared_ptr<const TypeLayout> TypeLayoutBuilder::build(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type) noexcept
+{
+    try
+    {
+        auto layout = build_type_(dyn_type, 0);
+        if (layout && layout->kind == TypeLayoutKind::structure)
+        {
+            return layout;
+        }
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_TYPELAYOUT,
+                "Exception compiling the layout of a type: " << e.what());
+    }
+
+    return nullptr;
+}
+
+std::shared_ptr<const TypeLayout> TypeLayoutBuilder::build_type_(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        unsigned int depth)
+{
+    if (depth > MAX_DEPTH)
+    {
+        return nullptr;
+    }
+
+    auto descriptor = get_descriptor(dyn_type);
+    if (!descriptor)
+    {
+        return nullptr;
+    }
+
+    switch (descriptor->kind())
+    {
+        case fastdds::dds::TK_BOOLEAN:
+            return primitive_layout(TypeLayoutKind::boolean, 1);
+
+        case fastdds::dds::TK_INT8:
+            return primitive_layout(TypeLayoutKind::int8, 1);
+
+        case fastdds::dds::TK_BYTE:
+        case fastdds::dds::TK_UINT8:
+            return primitive_layout(TypeLayoutKind::uint8, 1);
+
+        case fastdds::dds::TK_INT16:
+            return primitive_layout(TypeLayoutKind::int16, 2);
+
+        case fastdds::dds::TK_UINT16:
+            return primitive_layout(TypeLayoutKind::uint16, 2);
+
+        case fastdds::dds::TK_INT32:
+            return primitive_layout(TypeLayoutKind::int32, 4);
+
+        case fastdds::dds::TK_UINT32:
+            return primitive_layout(TypeLayoutKind::uint32, 4);
+
+        case fastdds::dds::TK_INT64:
+            return primitive_layout(TypeLayoutKind::int64, 8);
+
+        case fastdds::dds::TK_UINT64:
+            return primitive_layout(TypeLayoutKind::uint64, 8);
+
+        case fastdds::dds::TK_FLOAT32:
+            return primitive_layout(TypeLayoutKind::float32, 4);
+
+        case fastdds::dds::TK_FLOAT64:
+            return primitive_layout(TypeLayoutKind::float64, 8);
+
+        case fastdds::dds::TK_CHAR8:
+            return primitive_layout(TypeLayoutKind::char8, 1);
+
+        case fastdds::dds::TK_STRING8:
+        {
+            auto layout = std::make_shared<TypeLayout>();
+            layout->kind = TypeLayoutKind::string;
+            return layout;
+        }
+
+        case fastdds::dds::TK_ALIAS:
+            return build_type_(descriptor->base_type(), depth + 1);
+
+        case fastdds::dds::TK_ENUM:
+            return build_enumeration_(dyn_type);
+
+        case fastdds::dds::TK_STRUCTURE:
+            return build_structure_(dyn_type, descriptor, depth);
+
+        case fastdds::dds::TK_SEQUENCE:
+        case fastdds::dds::TK_ARRAY:
+            return build_collection_(descriptor, depth);
+
+        default:
+            // Unions, maps, bitsets, bitmasks, wide characters and strings, long doubles
+            return nullptr;
+    }
+}
+
+std::shared_ptr<const TypeLayout> TypeLayoutBuilder::build_structure_(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        const fastdds::dds::TypeDescriptor::_ref_type& descriptor,
+        unsigned int depth)
+{
+    // Mutable types are serialized as parameter lists, and inherited members would need to be merged
+    if (descriptor->extensibility_kind() == fastdds::dds::ExtensibilityKind::MUTABLE || descriptor->base_type())
+    {
+        return nullptr;
+    }
+
+    auto layout = std::make_shared<TypeLayout>();
+    layout->kind = TypeLayoutKind::structure;
+    layout->appendable = (descriptor->extensibility_kind() == fastdds::dds::ExtensibilityKind::APPENDABLE);
+
+    const uint32_t member_count = dyn_type->get_member_count();
+    for (uint32_t i = 0; i < member_count; ++i)
+    {
+        fastdds::dds::DynamicTypeMember::_ref_type member;
+        auto member_descriptor = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
+        if (fastdds::dds::RETCODE_OK != dyn_type->get_member_by_index(member, i) ||
+                fastdds::dds::RETCODE_OK != member->get_descriptor(member_descriptor) ||
+                member_descriptor->is_optional())
+        {
+            return nullptr;
+        }
+
+        auto member_layout = build_type_(member_descriptor->type(), depth + 1);
+        if (!member_layout)
+        {
+            return nullptr;
+        }
+
+        layout->members.push_back({member->get_name().to_string(), member_layout});
+    }
+
+    for (uint32_t i = 0; i < layout->members.size(); ++i)
+    {
+        layout->members_by_name.push_back(i);
+    }
+    std::stable_sort(layout->members_by_name.begin(), layout->members_by_name.end(),
+            [&layout](uint32_t lhs, uint32_t rhs)
+            {
+                return layout->members[lhs].name < layout->members[rhs].name;
+            });
+    layout->members_sorted = std::is_sorted(layout->members_by_name.begin(), layout->members_by_name.end());
+
+    return layout;
+}
+
+std::shared_ptr<const TypeLayout> TypeLayoutBuilder::build_enumeration_(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type)
+{
+    auto layout = primitive_layout(TypeLayoutKind::enumeration, 4);
+
+    int32_t next_value = 0;
+    const uint32_t literal_count = dyn_type->get_member_count();
+    for (uint32_t i = 0; i < literal_count; ++i)
+    {
+        fastdds::dds::DynamicTypeMember::_ref_type literal;
+        auto literal_descriptor = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
+        if (fastdds::dds::RETCODE_OK != dyn_type->get_member_by_index(literal, i) ||
+                fastdds::dds::RETCODE_OK != literal->get_descriptor(literal_descriptor))
+        {
+            return nullptr;
+        }
+
+        // The type of the literals sets the serialized size of the enumeration
+        if (i == 0 && literal_descriptor->type())
+        {
+            switch (literal_descriptor->type()->get_kind())
+            {
+                case fastdds::dds::TK_INT8:
+                case fastdds::dds::TK_UINT8:
+                    layout->primitive_size = 1;
+                    break;
+
+                case fastdds::dds::TK_INT16:
+                case fastdds::dds::TK_UINT16:
+                    layout->primitive_size = 2;
+                    break;
+
+                default:
+                    layout->primitive_size = 4;
+                    break;
+            }
+        }
+
+        // Literals without explicit value follow the previous one
+        int32_t value = next_value;
+        if (!literal_descriptor->default_value().empty())
+        {
+            value = static_cast<int32_t>(std::stol(literal_descriptor->default_value()));
+        }
+        next_value = value + 1;
+
+        layout->literals.push_back({value, literal->get_name().to_string()});
+    }
+
+    std::stable_sort(layout->literals.begin(), layout->literals.end(),
+            [](const TypeLayout::EnumLiteral& lhs, const TypeLayout::EnumLiteral& rhs)
+            {
+                return lhs.value < rhs.value;
+            });
+
+    return layout;
+}
+
+std::shared_ptr<const TypeLayout> TypeLayoutBuilder::build_collection_(
+        const fastdds::dds::TypeDescriptor::_ref_type& descriptor,
+        unsigned int depth)
+{
+    auto layout = std::make_shared<TypeLayout>();
+
+    if (descriptor->kind() == fastdds::dds::TK_ARRAY)
+    {
+        // Multidimensional arrays are written as nested JSON arrays
+        if (descriptor->bound().size() != 1)
+        {
+            return nullptr;
+        }
+        layout->kind = TypeLayoutKind::array;
+        layout->bound = descriptor->bound()[0];
+    }
+    else
+    {
+        layout->kind = TypeLayoutKind::sequence;
+    }
+
+    layout->element = build_type_(descriptor->element_type(), depth + 1);
+
+    // The JSON of collections of characters and enumerations is left to the generic serializer
+    if (!layout->element ||
+            layout->element->kind == TypeLayoutKind::char8 ||
+            layout->element->kind == TypeLayoutKind::enumeration)
+    {
+        return nullptr;
+    }
+
+    return layout;
+}
+
+} /* namespace cdr */
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,448 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <functional>
+#include <new>
+
+#include <cpp_utils/Log.hpp>
+
+#include <fastddsspy_participants/model/DataDispatcher.hpp>
+#include <fastddsspy_participants/model/payload_utils.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+constexpr std::size_t DataDispatcher::DEFAULT_QUEUE_SIZE;
+constexpr std::size_t DataDispatcher::DEFAULT_THREADS;
+constexpr std::chrono::milliseconds DataDispatcher::IDLE_WAIT_;
+constexpr std::size_t DataDispatcher::IN_FLIGHT_SLOTS_;
+
+DataDispatcher::Worker::Worker(
+        std::size_t queue_size)
+    : queue(queue_size)
+    , slots(new DataSlot[queue.capacity() + IN_FLIGHT_SLOTS_])
+    , free_slots(queue.capacity() + IN_FLIGHT_SLOTS_)
+{
+    for (std::size_t i = 0; i < queue.capacity() + IN_FLIGHT_SLOTS_; ++i)
+    {
+        DataSlot* slot = &slots[i];
+        free_slots.try_push(std::move(slot));
+    }
+}
+
+DataDispatcher::DataDispatcher(
+        std::size_t queue_size /* = DEFAULT_QUEUE_SIZE */,
+        DropPolicy drop_policy /* = DropPolicy::drop_oldest */,
+        std::size_t threads /* = 1 */)
+    : drop_policy_(drop_policy)
+{
+    for (std::size_t i = 0; i < std::max<std::size_t>(threads, 1); ++i)
+    {
+        workers_.push_back(std::make_unique<Worker>(queue_size));
+    }
+}
+
+DataDispatcher::~DataDispatcher()
+{
+    stop();
+
+    // NOTE: samples may be left from a push that raced with the last stop, and their payloads must be released
+    wait_producers_();
+    clear_queues_();
+}
+
+bool DataDispatcher::start(
+        const std::shared_ptr<DataStreamer::CallbackType>& callback)
+{
+    return start(std::vector<std::shared_ptr<DataStreamer::CallbackType>>(workers_.size(), callback));
+}
+
+bool DataDispatcher::start(
+        const std::vector<std::shared_ptr<DataStreamer::CallbackType>>& callbacks)
+{
+    if (running_.load() || callbacks.size() != workers_.size())
+    {
+        return false;
+    }
+
+    // Samples pushed after the last stop must not be shown in this run
+    clear_queues_();
+
+    {
+        std::lock_guard<std::mutex> _(topic_entries_mutex_);
+        for (const auto& topic_entries : topic_entries_)
+        {
+            for (const auto& entry : topic_entries.second)
+            {
+                entry->dropped.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    running_.store(true);
+    for (std::size_t i = 0; i < workers_.size(); ++i)
+    {
+        Worker& worker = *workers_[i];
+        worker.dropped.store(0, std::memory_order_relaxed);
+        worker.callback = callbacks[i];
+        worker.thread = std::thread(&DataDispatcher::run_, this, std::ref(worker));
+    }
+
+    return true;
+}
+
+void DataDispatcher::stop()
+{
+    if (!running_.exchange(false))
+    {
+        return;
+    }
+
+    for (const auto& worker : workers_)
+    {
+        // NOTE: taking the mutexes ensures the threads are either waiting or see running_ before they wait
+        {
+            std::lock_guard<std::mutex> _(worker->wake_mutex);
+        }
+        worker->wake_cv.notify_all();
+
+        {
+            std::lock_guard<std::mutex> _(worker->room_mutex);
+        }
+        worker->room_cv.notify_all();
+    }
+
+    for (const auto& worker : workers_)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+        worker->callback.reset();
+    }
+
+    // A push that saw the dispatcher running may still be queuing its sample
+    wait_producers_();
+    clear_queues_();
+}
+
+std::size_t DataDispatcher::threads() const noexcept
+{
+    return workers_.size();
+}
+
+void DataDispatcher::push(
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<TypeDecoder>& decoder,
+        const ddspipe::core::types::RtpsPayloadData& data)
+{
+    push_(topic_entry_(topic, decoder), data);
+}
+
+std::shared_ptr<DataStreamer::CallbackType> DataDispatcher::topic_callback(
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<TypeDecoder>& decoder)
+{
+    TopicEntry* entry = &topic_entry_(topic, decoder);
+    return std::make_shared<DataStreamer::CallbackType>(
+        [this, entry](
+            const ddspipe::core::types::DdsTopic&,
+            const std::shared_ptr<TypeDecoder>&,
+            const ddspipe::core::types::RtpsPayloadData& data)
+        {
+            push_(*entry, data);
+        });
+}
+
+std::map<std::string, uint64_t> DataDispatcher::dropped_samples() const
+{
+    std::lock_guard<std::mutex> _(topic_entries_mutex_);
+
+    std::map<std::string, uint64_t> dropped_samples;
+    for (const auto& topic_entries : topic_entries_)
+    {
+        for (const auto& entry : topic_entries.second)
+        {
+            const uint64_t dropped = entry->dropped.load(std::memory_order_relaxed);
+            if (dropped > 0)
+            {
+                dropped_samples[topic_entries.first] += dropped;
+            }
+        }
+    }
+    return dropped_samples;
+}
+
+void DataDispatcher::push_(
+        TopicEntry& entry,
+        const ddspipe::core::types::RtpsPayloadData& data)
+{
+    // NOTE: counted before running_ is checked, so that stop either sees the producer or the producer sees it stopped
+    producers_.fetch_add(1);
+    try
+    {
+        if (running_.load())
+        {
+            enqueue_(entry, data);
+        }
+    }
+    catch (...)
+    {
+        producers_.fetch_sub(1);
+        throw;
+    }
+    producers_.fetch_sub(1);
+}
+
+void DataDispatcher::enqueue_(
+        TopicEntry& entry,
+        const ddspipe::core::types::RtpsPayloadData& data)
+{
+    Worker& worker = *entry.worker;
+
+    DataSlot* slot = acquire_slot_(worker);
+    if (!slot)
+    {
+        // NOTE: a blocked producer only gives up when the dispatcher stops, so the sample is not dropped
+        if (drop_policy_ != DropPolicy::block)
+        {
+            count_dropped_(entry);
+        }
+        return;
+    }
+
+    Sample sample;
+    sample.topic = &entry;
+    sample.data = new (slot) ddspipe::core::types::RtpsPayloadData();
+    retain_payload_data(data, *sample.data);
+
+    while (!worker.queue.try_push(std::move(sample)))
+    {
+        switch (drop_policy_)
+        {
+            case DropPolicy::drop_oldest:
+            {
+                Sample oldest;
+                if (worker.queue.try_pop(oldest))
+                {
+                    count_dropped_(*oldest.topic);
+                    release_data_(worker, oldest.data);
+                }
+                break;
+            }
+
+            case DropPolicy::drop_newest:
+                count_dropped_(entry);
+                release_data_(worker, sample.data);
+                return;
+
+            case DropPolicy::block:
+                if (!wait_room_(worker, [&worker]()
+                        {
+                            return worker.queue.size() < worker.queue.capacity();
+                        }))
+                {
+                    release_data_(worker, sample.data);
+                    return;
+                }
+                break;
+        }
+    }
+
+    // NOTE: notify without holding the mutex, a missed wake up only delays the sample until IDLE_WAIT_
+    worker.wake_cv.notify_one();
+}
+
+void DataDispatcher::run_(
+        Worker& worker)
+{
+    uint64_t dropped_reported = 0;
+
+    Sample sample;
+    while (running_.load())
+    {
+        if (worker.queue.try_pop(sample))
+        {
+            notify_room_(worker);
+
+            (*worker.callback)(sample.topic->topic, sample.topic->decoder, *sample.data);
+
+            // Give the payload back to the pool as soon as possible
+            release_data_(worker, sample.data);
+            continue;
+        }
+
+        // NOTE: drops are logged here, so that the reception threads only count them
+        const uint64_t dropped = worker.dropped.load(std::memory_order_relaxed);
+        if (dropped != dropped_reported)
+        {
+            EPROSIMA_LOG_INFO(FASTDDSSPY_DATADISPATCHER,
+                    dropped - dropped_reported << " samples dropped: queue is full.");
+            dropped_reported = dropped;
+        }
+
+        std::unique_lock<std::mutex> lock(worker.wake_mutex);
+        worker.wake_cv.wait_for(lock, IDLE_WAIT_, [this, &worker]()
+                {
+                    return !running_.load() || !worker.queue.empty();
+                });
+    }
+}
+
+DataDispatcher::Worker& DataDispatcher::worker_(
+        const std::string& topic_name) noexcept
+{
+    if (workers_.size() == 1)
+    {
+        return *workers_.front();
+    }
+    return *workers_[std::hash<std::string>()(topic_name) % workers_.size()];
+}
+
+DataDispatcher::TopicEntry& DataDispatcher::topic_entry_(
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<TypeDecoder>& decoder)
+{
+    std::lock_guard<std::mutex> _(topic_entries_mutex_);
+
+    auto& entries = topic_entries_[topic.m_topic_name];
+    for (const auto& entry : entries)
+    {
+        if (entry->decoder == decoder && entry->topic.type_name == topic.type_name)
+        {
+            return *entry;
+        }
+    }
+
+    entries.push_back(std::make_unique<TopicEntry>());
+    TopicEntry& entry = *entries.back();
+    entry.topic = topic;
+    entry.decoder = decoder;
+    entry.worker = &worker_(topic.m_topic_name);
+    return entry;
+}
+
+DataDispatcher::DataSlot* DataDispatcher::acquire_slot_(
+        Worker& worker)
+{
+    DataSlot* slot = nullptr;
+    while (!worker.free_slots.try_pop(slot))
+    {
+        // Every slot is in use, so the queue is full or other threads are pushing at the same time
+        switch (drop_policy_)
+        {
+            case DropPolicy::drop_oldest:
+            {
+                Sample oldest;
+                if (!worker.queue.try_pop(oldest))
+                {
+                    return nullptr;
+                }
+                count_dropped_(*oldest.topic);
+                oldest.data->~RtpsPayloadData();
+                return reinterpret_cast<DataSlot*>(oldest.data);
+            }
+
+            case DropPolicy::drop_newest:
+                return nullptr;
+
+            case DropPolicy::block:
+                if (!wait_room_(worker, [&worker]()
+                        {
+                            return !worker.free_slots.empty();
+                        }))
+                {
+                    return nullptr;
+                }
+                break;
+        }
+    }
+    return slot;
+}
+
+void DataDispatcher::release_data_(
+        Worker& worker,
+        ddspipe::core::types::RtpsPayloadData* data)
+{
+    data->~RtpsPayloadData();
+
+    DataSlot* slot = reinterpret_cast<DataSlot*>(data);
+    worker.free_slots.try_push(std::move(slot));
+
+    notify_room_(worker);
+}
+
+bool DataDispatcher::wait_room_(
+        Worker& worker,
+        const std::function<bool()>& has_room)
+{
+    std::unique_lock<std::mutex> lock(worker.room_mutex);
+
+    // NOTE: room made just before the counter is increased is not notified, so the wait is bounded by IDLE_WAIT_
+    worker.blocked_producers.fetch_add(1);
+    worker.room_cv.wait_for(lock, IDLE_WAIT_, [this, &has_room]()
+            {
+                return !running_.load() || has_room();
+            });
+    worker.blocked_producers.fetch_sub(1);
+
+    return running_.load();
+}
+
+void DataDispatcher::notify_room_(
+        Worker& worker)
+{
+    if (worker.blocked_producers.load() == 0)
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> _(worker.room_mutex);
+    }
+    worker.room_cv.notify_all();
+}
+
+void DataDispatcher::wait_producers_() const noexcept
+{
+    while (producers_.load() > 0)
+    {
+        std::this_thread::yield();
+    }
+}
+
+void DataDispatcher::clear_queues_()
+{
+    Sample sample;
+    for (const auto& worker : workers_)
+    {
+        while (worker->queue.try_pop(sample))
+        {
+            release_data_(*worker, sample.data);
+        }
+    }
+}
+
+void DataDispatcher::count_dropped_(
+        TopicEntry& topic) noexcept
+{
+    topic.dropped.fetch_add(1, std::memory_order_relaxed);
+    topic.worker->dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
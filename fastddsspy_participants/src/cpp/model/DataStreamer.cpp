@@ -12,12 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License\.
 
+#include <algorithm>
+#include <functional>
 #include <mutex>
+#include <utility>
 
 #include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
-#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
-#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
-#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
 
 #include <cpp_utils/utils.hpp>
 
@@ -28,96 +28,342 @@ namespace spy {
 namespace participants {
 
 
+constexpr DataStreamer::SubscriptionHandle DataStreamer::INVALID_SUBSCRIPTION;
+
+DataStreamer::SubscriptionHandle DataStreamer::subscribe_all(
+        const std::shared_ptr<CallbackType>& callback,
+        const std::shared_ptr<SampleThrottle>& throttle /* = nullptr */)
+{
+    return subscribe_all_bound(bind_all_(callback), throttle);
+}
+
+DataStreamer::SubscriptionHandle DataStreamer::subscribe_all_bound(
+        const std::shared_ptr<TopicBinderType>& binder,
+        const std::shared_ptr<SampleThrottle>& throttle /* = nullptr */)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+    return add_subscription_nts_(true, ddspipe::core::types::WildcardDdsFilterTopic(), binder, throttle);
+}
+
+DataStreamer::SubscriptionHandle DataStreamer::subscribe(
+        const ddspipe::core::types::WildcardDdsFilterTopic& filter,
+        const std::shared_ptr<CallbackType>& callback,
+        const std::shared_ptr<SampleThrottle>& throttle /* = nullptr */)
+{
+    return subscribe_bound(filter, bind_all_(callback), throttle);
+}
+
+DataStreamer::SubscriptionHandle DataStreamer::subscribe_bound(
+        const ddspipe::core::types::WildcardDdsFilterTopic& filter,
+        const std::shared_ptr<TopicBinderType>& binder,
+        const std::shared_ptr<SampleThrottle>& throttle /* = nullptr */)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+    return add_subscription_nts_(false, filter, binder, throttle);
+}
+
+bool DataStreamer::unsubscribe(
+        SubscriptionHandle handle)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+    return remove_subscription_nts_(handle);
+}
+
 bool DataStreamer::activate_all(
-        const std::shared_ptr<CallbackType>& callback)
+        const std::shared_ptr<CallbackType>& callback,
+        const std::shared_ptr<SampleThrottle>& throttle /* = nullptr */)
 {
     std::unique_lock<std::shared_timed_mutex> _(mutex_);
 
-    // If type exist, this is the new topic to activate
-    activated_ = true;
-    activated_all_ = true;
-    callback_ = callback;
+    remove_subscription_nts_(activated_handle_);
+    activated_handle_ = add_subscription_nts_(
+        true, ddspipe::core::types::WildcardDdsFilterTopic(), bind_all_(callback), throttle);
 
-    return true;
+    return activated_handle_ != INVALID_SUBSCRIPTION;
 }
 
 bool DataStreamer::activate(
         const ddspipe::core::types::WildcardDdsFilterTopic& topic_to_activate,
-        const std::shared_ptr<CallbackType>& callback)
+        const std::shared_ptr<CallbackType>& callback,
+        const std::shared_ptr<SampleThrottle>& throttle /* = nullptr */)
 {
     std::unique_lock<std::shared_timed_mutex> _(mutex_);
 
-    // If type exist, this is the new topic to activate
-    activated_ = true;
-    activated_topic_ = topic_to_activate;
-    activated_all_ = false;
-    callback_ = callback;
+    remove_subscription_nts_(activated_handle_);
+    activated_handle_ = add_subscription_nts_(false, topic_to_activate, bind_all_(callback), throttle);
 
-    return true;
+    return activated_handle_ != INVALID_SUBSCRIPTION;
 }
 
 void DataStreamer::deactivate()
 {
     std::unique_lock<std::shared_timed_mutex> _(mutex_);
-    activated_ = false;
-    callback_.reset();
+
+    remove_subscription_nts_(activated_handle_);
+    activated_handle_ = INVALID_SUBSCRIPTION;
 }
 
 void DataStreamer::add_schema(
         const fastdds::dds::DynamicType::_ref_type& dynamic_type,
         const fastdds::dds::xtypes::TypeIdentifier& type_identifier)
 {
-    static_cast<void>(type_identifier);
-
     std::unique_lock<std::shared_timed_mutex> _(mutex_);
 
     // Add type to map if not yet
-    // NOTE: it does not matter if it is already in set
+    // NOTE: an already known type keeps its decoder, so the data pooled for it is not lost
     auto const type_name = dynamic_type->get_name().to_string();
-    types_discovered_[type_name] = dynamic_type;
+    auto& decoder = types_discovered_[type_name];
+    if (!decoder || !decoder->type()->equals(dynamic_type) ||
+            (decoder->type_identifier()._d() == fastdds::dds::xtypes::TK_NONE &&
+            type_identifier._d() != fastdds::dds::xtypes::TK_NONE))
+    {
+        decoder = std::make_shared<TypeDecoder>(dynamic_type, type_identifier);
+
+        // Topics already resolved may use this type
+        update_topic_states_nts_([&type_name](const TopicHandle& handle)
+                {
+                    return handle.topic.type_name == type_name;
+                });
+    }
 
     EPROSIMA_LOG_INFO(FASTDDSSPY_DATASTREAMER, "\nAdding schema with name " << type_name << ".");
 }
 
+std::shared_ptr<DataStreamer::TopicHandle> DataStreamer::acquire_topic_handle(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    auto handle = get_or_create_topic_handle_nts_(topic);
+    handle->writers++;
+    return handle;
+}
+
+void DataStreamer::release_topic_handle(
+        const std::shared_ptr<TopicHandle>& handle)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    if (handle->writers == 0 || --handle->writers > 0)
+    {
+        return;
+    }
+
+    // The topic is gone with its last writer
+    auto it = topic_handles_.find(handle->topic.m_topic_name);
+    if (it == topic_handles_.end())
+    {
+        return;
+    }
+
+    auto type_it = it->second.find(handle->topic.type_name);
+    if (type_it != it->second.end() && type_it->second == handle)
+    {
+        it->second.erase(type_it);
+        if (it->second.empty())
+        {
+            topic_handles_.erase(it);
+        }
+    }
+}
+
 void DataStreamer::add_data(
         const ddspipe::core::types::DdsTopic& topic,
         ddspipe::core::types::RtpsPayloadData& data)
 {
-    TopicRateCalculator::add_data(topic, data);
+    std::shared_ptr<TopicHandle> handle;
+    {
+        std::shared_lock<std::shared_timed_mutex> _(mutex_);
 
-    fastdds::dds::DynamicType::_ref_type dyn_type;
-    bool should_call_callback = false;
+        auto it = topic_handles_.find(topic.m_topic_name);
+        if (it != topic_handles_.end())
+        {
+            auto type_it = it->second.find(topic.type_name);
+            if (type_it != it->second.end())
+            {
+                handle = type_it->second;
+            }
+        }
+    }
 
+    // Only the first data of a topic needs an exclusive lock
+    if (!handle)
     {
-        std::shared_lock<std::shared_timed_mutex> _(mutex_);
+        std::unique_lock<std::shared_timed_mutex> _(mutex_);
+        handle = get_or_create_topic_handle_nts_(topic);
+    }
 
-        auto it = types_discovered_.find(topic.type_name);
-        if (it == types_discovered_.end())
+    add_data(*handle, data);
+}
+
+void DataStreamer::add_data(
+        TopicHandle& handle,
+        ddspipe::core::types::RtpsPayloadData& data)
+{
+    // NOTE: the state is kept until this data is added, even if the handle is resolved again meanwhile
+    const auto state = handle.state.read();
+    const auto& topic = handle.topic;
+
+    // NOTE: filtered out samples are dropped before anything else, as a DDS reader with a content filter would
+    if (state->filter && !state->filter->evaluate(data.payload.data, data.payload.length))
+    {
+        return;
+    }
+
+    add_data_(*handle.rate_data, data);
+
+    // NOTE: kept even before its type is discovered, it is only needed when the history is read
+    if (state->topic_history)
+    {
+        state->history->add(*state->topic_history, data);
+    }
+
+    const auto& decoder = state->decoder;
+    if (!decoder)
+    {
+        EPROSIMA_LOG_WARNING(
+            FASTDDSSPY_DATASTREAMER,
+            "Data received on topic <" << topic << "> while its type has not been registered.");
+        return;
+    }
+
+    if (state->instances)
+    {
+        instance_cache_.add_or_update_instance(*state->instances, topic, decoder, data, rate_time_(data),
+                rate_window_.load(std::memory_order_relaxed));
+    }
+
+    for (const auto& subscription : state->subscriptions)
+    {
+        // NOTE: samples left out by the throttle are only counted, they are never deserialized
+        if (subscription.throttle && !subscription.throttle->accept(*subscription.throttle_state))
+        {
+            continue;
+        }
+
+        EPROSIMA_LOG_INFO(
+            FASTDDSSPY_DATASTREAMER,
+            "Adding data in topic " << topic);
+        (*subscription.callback)(topic, decoder, data);
+    }
+}
+
+std::shared_ptr<DataStreamer::TopicHandle> DataStreamer::get_or_create_topic_handle_nts_(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    auto& handle = topic_handles_[topic.m_topic_name][topic.type_name];
+    if (handle)
+    {
+        return handle;
+    }
+
+    handle = std::make_shared<TopicHandle>();
+    handle->topic = topic;
+
+    bool new_rate_data = false;
+    {
+        std::unique_lock<RateByTopicMapType> lock(data_by_topic_);
+        new_rate_data = get_data_rate_from_topic_nts_(topic) == nullptr;
+        handle->rate_data = &get_or_create_data_rate_from_topic_nts_(topic);
+    }
+
+    // The topic is ranked with the rate info of each of its types
+    if (new_rate_data)
+    {
+        std::lock_guard<std::mutex> _(topic_activity_mutex_);
+        topic_activity_[topic.m_topic_name].rate_data.push_back(handle->rate_data);
+    }
+
+    handle->state.publish(resolve_topic_state_nts_(topic));
+
+    return handle;
+}
+
+std::unique_ptr<const DataStreamer::TopicHandle::State> DataStreamer::resolve_topic_state_nts_(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    std::unique_ptr<TopicHandle::State> state(new TopicHandle::State());
+
+    auto it = types_discovered_.find(topic.type_name);
+    if (it != types_discovered_.end())
+    {
+        state->decoder = it->second;
+    }
+
+    if (history_)
+    {
+        state->history = history_;
+        state->topic_history = &history_->topic_history(topic);
+    }
+
+    auto filter_it = content_filters_.find(topic.m_topic_name);
+    if (filter_it != content_filters_.end() && state->decoder)
+    {
+        const auto& layout = state->decoder->layout();
+        std::string error;
+        if (layout)
+        {
+            state->filter = cdr::ContentFilter::compile(*filter_it->second, layout, error);
+        }
+        else
+        {
+            error = "its type is not supported";
+        }
+
+        if (!state->filter)
         {
             EPROSIMA_LOG_WARNING(
                 FASTDDSSPY_DATASTREAMER,
-                "Data received on topic <" << topic << "> while its type has not been registered.");
-            return;
+                "Topic <" << topic << "> is not filtered by <" << filter_it->second->text() << ">: " << error);
         }
-        dyn_type = it->second;
+    }
+
+    // NOTE: data is only delivered with its decoder, so the instances and the subscriptions are resolved once it is
+    // known
+    if (state->decoder)
+    {
+        state->instances = instance_cache_.topic_instances(topic, state->decoder);
 
-        if (activated_)
+        for (const auto& subscription : subscriptions_)
         {
-            if (activated_all_ || activated_topic_.matches(topic))
+            if (!subscription.all && !subscription.filter.matches(topic))
+            {
+                continue;
+            }
+
+            TopicHandle::State::TopicSubscription topic_subscription;
+            topic_subscription.callback = (*subscription.binder)(topic, state->decoder);
+            if (!topic_subscription.callback)
             {
-                should_call_callback = true;
+                continue;
             }
+
+            if (subscription.throttle && subscription.throttle->limited())
+            {
+                topic_subscription.throttle = subscription.throttle;
+                topic_subscription.throttle_state = &subscription.throttle->topic_state(topic.m_topic_name);
+            }
+
+            state->subscriptions.push_back(std::move(topic_subscription));
         }
     }
 
-    instance_cache_.add_or_update_instance(topic, dyn_type, data);
+    return std::unique_ptr<const TopicHandle::State>(std::move(state));
+}
 
-    if (should_call_callback)
+void DataStreamer::update_topic_states_nts_(
+        const std::function<bool(const TopicHandle&)>& affected)
+{
+    for (const auto& topic_handles : topic_handles_)
     {
-        EPROSIMA_LOG_INFO(
-            FASTDDSSPY_DATASTREAMER,
-            "Adding data in topic " << topic);
-        (*callback_)(topic, dyn_type, data);
+        for (const auto& handle : topic_handles.second)
+        {
+            if (affected(*handle.second))
+            {
+                // NOTE: the data being added with the previous state keeps it until it is done
+                handle.second->state.publish(resolve_topic_state_nts_(handle.second->topic));
+            }
+        }
     }
 }
 
@@ -156,6 +402,91 @@ bool DataStreamer::is_any_topic_type_discovered_nts_(
     return false;
 }
 
+std::shared_ptr<TypeDecoder> DataStreamer::get_type_decoder(
+        const std::string& type_name) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    auto it = types_discovered_.find(type_name);
+    if (it == types_discovered_.end())
+    {
+        return nullptr;
+    }
+    return it->second;
+}
+
+void DataStreamer::enable_history(
+        std::size_t depth,
+        std::size_t max_memory /* = SampleHistory::DEFAULT_MAX_MEMORY */)
+{
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    history_ = std::make_shared<SampleHistory>(depth, max_memory);
+
+    // Topics already resolved must keep their samples in the new history
+    update_topic_states_nts_([](const TopicHandle&)
+            {
+                return true;
+            });
+}
+
+std::size_t DataStreamer::history_depth() const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+    return history_ ? history_->depth() : 0;
+}
+
+std::vector<std::shared_ptr<const ddspipe::core::types::RtpsPayloadData>> DataStreamer::get_topic_history(
+        const ddspipe::core::types::DdsTopic& topic,
+        std::size_t n) const
+{
+    std::shared_ptr<SampleHistory> history;
+    {
+        std::shared_lock<std::shared_timed_mutex> _(mutex_);
+        history = history_;
+    }
+
+    if (!history)
+    {
+        return {};
+    }
+    return history->last(topic, n);
+}
+
+bool DataStreamer::set_content_filter(
+        const std::string& topic_name,
+        const std::string& expression,
+        std::string& error)
+{
+    std::shared_ptr<const cdr::FilterExpression> filter_expression;
+    if (!expression.empty())
+    {
+        filter_expression = cdr::FilterExpression::parse(expression, error);
+        if (!filter_expression)
+        {
+            return false;
+        }
+    }
+
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    if (filter_expression)
+    {
+        content_filters_[topic_name] = filter_expression;
+    }
+    else
+    {
+        content_filters_.erase(topic_name);
+    }
+
+    // Topics already resolved must compile the new filter
+    update_topic_states_nts_([&topic_name](const TopicHandle& handle)
+            {
+                return handle.topic.m_topic_name == topic_name;
+            });
+    return true;
+}
+
 std::set<std::string> DataStreamer::get_topic_instances(
         const std::string& topic_name) const noexcept
 {
@@ -168,12 +499,156 @@ std::vector<std::string> DataStreamer::get_topic_key_fields(
     return instance_cache_.get_key_fields(topic_name);
 }
 
+std::vector<InstanceCache::InstanceStats> DataStreamer::get_topic_instance_stats(
+        const ddspipe::core::types::DdsTopic& topic) const noexcept
+{
+    int64_t now = 0;
+    int64_t window = 0;
+    {
+        std::shared_lock<RateByTopicMapType> _(data_by_topic_);
+
+        // NOTE: without data in the topic there is no rate to measure
+        const DataRateInfo* rate_data = get_data_rate_from_topic_nts_(topic);
+        if (rate_data)
+        {
+            now = rate_window_end_(*rate_data);
+            window = rate_window_.load(std::memory_order_relaxed);
+        }
+    }
+
+    return instance_cache_.get_instance_stats(topic.m_topic_name, now, window);
+}
+
+InstanceCache::EvictionStats DataStreamer::get_topic_instance_evictions(
+        const std::string& topic_name) const noexcept
+{
+    return instance_cache_.get_eviction_stats(topic_name);
+}
+
+void DataStreamer::set_instance_limits(
+        std::size_t max_instances_per_topic,
+        std::size_t max_instances,
+        std::size_t max_memory) noexcept
+{
+    instance_cache_.set_limits(max_instances_per_topic, max_instances, max_memory);
+}
+
 void DataStreamer::on_writer_discovered(
         const ddspipe::core::types::Guid& writer_guid,
         const std::string& topic_name,
         bool active) noexcept
 {
     instance_cache_.on_writer_changed(writer_guid, topic_name, active);
+
+    std::lock_guard<std::mutex> _(topic_activity_mutex_);
+    if (active)
+    {
+        topic_activity_[topic_name].writers.insert(writer_guid);
+    }
+    else
+    {
+        auto it = topic_activity_.find(topic_name);
+        if (it != topic_activity_.end())
+        {
+            it->second.writers.erase(writer_guid);
+
+            // A topic with no data is not ranked once its writers are gone
+            if (it->second.writers.empty() && it->second.rate_data.empty())
+            {
+                topic_activity_.erase(it);
+            }
+        }
+    }
+}
+
+std::vector<TopicActivity> DataStreamer::get_top_topics(
+        std::size_t size,
+        TopicRanking::Key key) const
+{
+    TopicRanking ranking(size, key);
+
+    std::lock_guard<std::mutex> _(topic_activity_mutex_);
+    for (const auto& topic_activity : topic_activity_)
+    {
+        TopicActivity activity;
+        activity.topic_name = topic_activity.first;
+        activity.writers = static_cast<uint32_t>(topic_activity.second.writers.size());
+        for (const auto* rate_data : topic_activity.second.rate_data)
+        {
+            activity.rate += topic_rate_(*rate_data);
+            activity.bandwidth += topic_bandwidth_(*rate_data);
+        }
+        ranking.add(std::move(activity));
+    }
+    return ranking.take();
+}
+
+DataStreamer::SubscriptionHandle DataStreamer::add_subscription_nts_(
+        bool all,
+        const ddspipe::core::types::WildcardDdsFilterTopic& filter,
+        const std::shared_ptr<TopicBinderType>& binder,
+        const std::shared_ptr<SampleThrottle>& throttle)
+{
+    if (!binder || !*binder)
+    {
+        return INVALID_SUBSCRIPTION;
+    }
+
+    Subscription subscription;
+    subscription.handle = ++last_handle_;
+    subscription.all = all;
+    subscription.filter = filter;
+    subscription.binder = binder;
+    subscription.throttle = throttle;
+    subscriptions_.push_back(std::move(subscription));
+
+    // Topics already resolved that match the subscription deliver their data to it from now on
+    update_topic_states_nts_([&all, &filter](const TopicHandle& handle)
+            {
+                return all || filter.matches(handle.topic);
+            });
+
+    return last_handle_;
+}
+
+bool DataStreamer::remove_subscription_nts_(
+        SubscriptionHandle handle)
+{
+    auto it = std::find_if(subscriptions_.begin(), subscriptions_.end(), [handle](const Subscription& subscription)
+                    {
+                        return subscription.handle == handle;
+                    });
+    if (it == subscriptions_.end())
+    {
+        return false;
+    }
+
+    const bool all = it->all;
+    const auto filter = it->filter;
+    subscriptions_.erase(it);
+
+    update_topic_states_nts_([&all, &filter](const TopicHandle& topic_handle)
+            {
+                return all || filter.matches(topic_handle.topic);
+            });
+    return true;
+}
+
+std::shared_ptr<DataStreamer::TopicBinderType> DataStreamer::bind_all_(
+        const std::shared_ptr<CallbackType>& callback)
+{
+    if (!callback)
+    {
+        return nullptr;
+    }
+
+    return std::make_shared<TopicBinderType>(
+        [callback](
+            const ddspipe::core::types::DdsTopic&,
+            const std::shared_ptr<TypeDecoder>&)
+        {
+            return callback;
+        });
 }
 
 } /* namespace participants */
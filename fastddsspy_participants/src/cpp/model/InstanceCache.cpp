@@ -14,6 +14,8 @@
 
 #include <fastddsspy_participants/model/InstanceCache.hpp>
 
+#include <algorithm>
+#include <mutex>
 #include <sstream>
 #include <fastdds/dds/xtypes/dynamic_types/MemberDescriptor.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
@@ -22,33 +24,123 @@
 #include <fastdds/dds/xtypes/utils.hpp>
 #include <fastdds/dds/log/Log.hpp>
 
+#include <fastddsspy_participants/visualization/CdrJsonSerializer.hpp>
+
 namespace eprosima {
 namespace spy {
 namespace participants {
 
+constexpr std::size_t InstanceCache::DEFAULT_MAX_INSTANCES_PER_TOPIC;
+constexpr std::size_t InstanceCache::DEFAULT_MAX_INSTANCES;
+constexpr std::size_t InstanceCache::DEFAULT_MAX_MEMORY;
+
 bool InstanceCache::add_or_update_instance(
         const ddspipe::core::types::DdsTopic& topic,
         const fastdds::dds::DynamicType::_ref_type& dyn_type,
-        const ddspipe::core::types::RtpsPayloadData& data) noexcept
+        const ddspipe::core::types::RtpsPayloadData& data,
+        int64_t time /* = 0 */,
+        int64_t window /* = 0 */) noexcept
+{
+    try
+    {
+        return add_or_update_instance(
+            topic,
+            dyn_type ? std::make_shared<TypeDecoder>(dyn_type) : nullptr,
+            data,
+            time,
+            window);
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_INSTANCECACHE,
+                "Exception in add_or_update_instance: " << e.what());
+        return false;
+    }
+}
+
+bool InstanceCache::add_or_update_instance(
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<TypeDecoder>& decoder,
+        const ddspipe::core::types::RtpsPayloadData& data,
+        int64_t time /* = 0 */,
+        int64_t window /* = 0 */) noexcept
+{
+    try
+    {
+        TopicInstances* topic_instances = nullptr;
+        {
+            std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+            auto topic_it = instances_by_topic_.find(topic.m_topic_name);
+            if (topic_it != instances_by_topic_.end())
+            {
+                topic_instances = topic_it->second.get();
+            }
+        }
+
+        if (!topic_instances)
+        {
+            std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+            topic_instances = &topic_instances_nts_(topic.m_topic_name);
+        }
+
+        return add_or_update_instance(*topic_instances, topic, decoder, data, time, window);
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_INSTANCECACHE,
+                "Exception in add_or_update_instance: " << e.what());
+        return false;
+    }
+}
+
+bool InstanceCache::add_or_update_instance(
+        TopicInstances& topic_instances,
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<TypeDecoder>& decoder,
+        const ddspipe::core::types::RtpsPayloadData& data,
+        int64_t time /* = 0 */,
+        int64_t window /* = 0 */) noexcept
 {
     try
     {
-        if (!dyn_type)
+        if (!decoder || !decoder->type())
         {
             EPROSIMA_LOG_WARNING(FASTDDSSPY_INSTANCECACHE,
                     "Null type provided for topic: " << topic.m_topic_name);
             return false;
         }
 
-        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-
         auto writer_guid = data.source_guid;
         auto instance_handle = data.instanceHandle;
 
-        extract_key_field_names_(topic.m_topic_name, dyn_type);
+        // Fast path: data of an alive instance already published by its writer, only counted
+        if (data.kind == fastdds::rtps::ALIVE)
+        {
+            std::shared_lock<std::shared_timed_mutex> topic_lock(topic_instances.mutex);
+
+            auto instance_it = topic_instances.instances.find(instance_handle);
+            if (instance_it != topic_instances.instances.end())
+            {
+                CachedInstance& instance = instance_it->second;
+                const auto& active_writers = instance.info.active_writers;
+                if (instance.info.state == InstanceState::alive &&
+                        std::find(active_writers.begin(), active_writers.end(), writer_guid) !=
+                        active_writers.end())
+                {
+                    count_sample_(instance, data, time, window);
+                    if (!instance.seen.load(std::memory_order_relaxed))
+                    {
+                        instance.seen.store(true, std::memory_order_relaxed);
+                    }
+                    return true;
+                }
+            }
+        }
+
+        std::unique_lock<std::shared_timed_mutex> lock(mutex_);
 
-        auto key_fields_it = key_fields_cache_.find(topic.m_topic_name);
-        if (key_fields_it == key_fields_cache_.end() || key_fields_it->second.empty())
+        const std::shared_ptr<const KeyExtractor> extractor = key_extractor_(topic.m_topic_name, *decoder);
+        if (!extractor || extractor->key_member_ids.empty())
         {
             if (no_key_metadata_warned_topics_.insert(topic.m_topic_name).second)
             {
@@ -59,45 +151,65 @@ bool InstanceCache::add_or_update_instance(
             return false;
         }
 
-        auto& topic_instances = instances_by_topic_[topic.m_topic_name];
-
-        auto instance_it = topic_instances.find(instance_handle);
-        bool instance_already_cached = (instance_it != topic_instances.end() &&
-                !instance_it->second.key_representation.empty());
+        // Instance already cached, with a new writer or a new state
+        {
+            std::unique_lock<std::shared_timed_mutex> topic_lock(topic_instances.mutex);
+            auto instance_it = topic_instances.instances.find(instance_handle);
+            if (instance_it != topic_instances.instances.end())
+            {
+                update_instance_(topic_instances, instance_handle, instance_it->second, data, time, window);
+                return true;
+            }
+        }
 
-        // Fast path: instance already cached
-        if (instance_already_cached)
+        // NOTE: dispose and unregister samples may carry only the key, so they cannot add an instance
+        if (data.kind != fastdds::rtps::ALIVE)
         {
-            instance_it->second.active_writers.insert(writer_guid);
-            instance_it->second.last_seen = std::chrono::system_clock::now();
-            return true;
+            return false;
         }
 
-        // Check instance limit
-        if (topic_instances.size() >= MAX_INSTANCES_PER_TOPIC &&
-                instance_it == topic_instances.end())
+        // No instance is kept with a limit of 0, evicting the others would not make room for it
+        if (max_instances_per_topic_ == 0 || max_instances_ == 0)
         {
-            EPROSIMA_LOG_WARNING(FASTDDSSPY_INSTANCECACHE,
-                    "Maximum instances reached for topic: " << topic.m_topic_name);
             return false;
         }
 
         lock.unlock();
 
         // Slow path: serialize key fields for new instance
-        std::string key_json = serialize_key_to_json_(dyn_type, data);
+        std::string key_json = serialize_key_to_json_(*extractor, *decoder, data);
 
         if (key_json.empty())
         {
             return false;
         }
 
-        // Store the new instance
+        // Store the new instance, looked up again as the cache may have changed while unlocked
         lock.lock();
-        auto& instance_info = topic_instances[instance_handle];
-        instance_info.key_representation = key_json;
-        instance_info.active_writers.insert(writer_guid);
-        instance_info.last_seen = std::chrono::system_clock::now();
+        std::unique_lock<std::shared_timed_mutex> topic_lock(topic_instances.mutex);
+        auto instance_it = topic_instances.instances.find(instance_handle);
+        if (instance_it != topic_instances.instances.end())
+        {
+            update_instance_(topic_instances, instance_handle, instance_it->second, data, time, window);
+            return true;
+        }
+
+        if (key_json.size() > max_memory_)
+        {
+            EPROSIMA_LOG_WARNING(FASTDDSSPY_INSTANCECACHE,
+                    "Key of instance larger than maximum memory for topic: " << topic.m_topic_name);
+            return false;
+        }
+
+        // Make room evicting the instances least recently seen
+        evict_(topic_instances, 1, key_json.size());
+
+        CachedInstance& instance = topic_instances.instances[instance_handle];
+        instance.topic_lru = topic_instances.lru.insert(topic_instances.lru.end(), instance_handle);
+        instance.lru = lru_.insert(lru_.end(), LruEntry{&topic_instances, instance_handle});
+        instance.info.key_representation = std::move(key_json);
+        memory_ += instance.info.key_representation.size();
+        update_instance_(topic_instances, instance_handle, instance, data, time, window);
 
         return true;
     }
@@ -115,6 +227,32 @@ bool InstanceCache::add_or_update_instance(
     }
 }
 
+InstanceCache::TopicInstances* InstanceCache::topic_instances(
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<TypeDecoder>& decoder) noexcept
+{
+    if (!decoder || !decoder->type())
+    {
+        return nullptr;
+    }
+
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+    const std::shared_ptr<const KeyExtractor> extractor = key_extractor_(topic.m_topic_name, *decoder);
+    if (!extractor || extractor->key_member_ids.empty())
+    {
+        if (no_key_metadata_warned_topics_.insert(topic.m_topic_name).second)
+        {
+            EPROSIMA_LOG_WARNING(FASTDDSSPY_INSTANCECACHE,
+                    "No key metadata discovered for topic: " << topic.m_topic_name
+                                                             << ". Skipping key instance caching.");
+        }
+        return nullptr;
+    }
+
+    return &topic_instances_nts_(topic.m_topic_name);
+}
+
 std::set<std::string> InstanceCache::get_active_instances(
         const std::string& topic_name) const noexcept
 {
@@ -127,10 +265,10 @@ std::set<std::string> InstanceCache::get_active_instances(
     }
 
     std::set<std::string> result;
-    for (const auto& instance_pair : it->second)
+    for (const auto& instance_pair : it->second->instances)
     {
-        const InstanceInfo& info = instance_pair.second;
-        if (!info.active_writers.empty())
+        const InstanceInfo& info = instance_pair.second.info;
+        if (info.state == InstanceState::alive)
         {
             result.insert(info.key_representation);
         }
@@ -139,6 +277,38 @@ std::set<std::string> InstanceCache::get_active_instances(
     return result;
 }
 
+std::vector<InstanceCache::InstanceStats> InstanceCache::get_instance_stats(
+        const std::string& topic_name,
+        int64_t now,
+        int64_t window) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = instances_by_topic_.find(topic_name);
+    if (it == instances_by_topic_.end())
+    {
+        return {};
+    }
+
+    std::vector<InstanceStats> result;
+    result.reserve(it->second->instances.size());
+    for (const auto& instance_pair : it->second->instances)
+    {
+        const CachedInstance& instance = instance_pair.second;
+
+        InstanceStats stats;
+        stats.key_representation = instance.info.key_representation;
+        stats.state = instance.info.state;
+        stats.writers = instance.info.active_writers.size();
+        stats.samples = instance.samples.load(std::memory_order_relaxed);
+        stats.bytes = instance.bytes.load(std::memory_order_relaxed);
+        stats.rate = window > 0 ? instance.rate.rate(now, window) : 0;
+        result.push_back(std::move(stats));
+    }
+
+    return result;
+}
+
 std::vector<std::string> InstanceCache::get_key_fields(
         const std::string& topic_name) const noexcept
 {
@@ -153,6 +323,38 @@ std::vector<std::string> InstanceCache::get_key_fields(
     return {};
 }
 
+InstanceCache::EvictionStats InstanceCache::get_eviction_stats(
+        const std::string& topic_name) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = instances_by_topic_.find(topic_name);
+    if (it != instances_by_topic_.end())
+    {
+        return it->second->evictions;
+    }
+
+    return {};
+}
+
+void InstanceCache::set_limits(
+        std::size_t max_instances_per_topic,
+        std::size_t max_instances,
+        std::size_t max_memory) noexcept
+{
+    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+
+    max_instances_per_topic_ = max_instances_per_topic;
+    max_instances_ = max_instances;
+    max_memory_ = max_memory;
+
+    for (auto& topic_pair : instances_by_topic_)
+    {
+        std::unique_lock<std::shared_timed_mutex> topic_lock(topic_pair.second->mutex);
+        evict_(*topic_pair.second, 0, 0);
+    }
+}
+
 void InstanceCache::on_writer_changed(
         const ddspipe::core::types::Guid& writer_guid,
         const std::string& topic_name,
@@ -171,22 +373,39 @@ void InstanceCache::on_writer_changed(
         return;
     }
 
-    auto& topic_instances = topic_it->second;
-    for (auto it = topic_instances.begin(); it != topic_instances.end();)
+    TopicInstances& topic_instances = *topic_it->second;
+    std::unique_lock<std::shared_timed_mutex> topic_lock(topic_instances.mutex);
+
+    auto writer_it = topic_instances.writer_instances.find(writer_guid);
+    if (writer_it == topic_instances.writer_instances.end())
     {
-        it->second.active_writers.erase(writer_guid);
+        return;
+    }
+
+    // Only the instances of the writer are visited
+    const std::set<ddspipe::core::types::InstanceHandle> writer_handles = std::move(writer_it->second);
+    topic_instances.writer_instances.erase(writer_it);
 
-        // Remove instance if no more active writers
-        if (it->second.active_writers.empty())
+    for (const auto& handle : writer_handles)
+    {
+        auto instance_it = topic_instances.instances.find(handle);
+        if (instance_it == topic_instances.instances.end())
         {
-            EPROSIMA_LOG_INFO(FASTDDSSPY_INSTANCECACHE,
-                    "Removing instance on topic " << topic_name
-                                                  << " - no more active writers");
-            it = topic_instances.erase(it);
+            continue;
         }
-        else
+
+        // The writer is already out of the index, so it is only removed from the instance
+        InstanceInfo& info = instance_it->second.info;
+        info.active_writers.erase(std::remove(info.active_writers.begin(), info.active_writers.end(), writer_guid),
+                info.active_writers.end());
+
+        // Kept until evicted, so its state and statistics can still be shown
+        if (info.active_writers.empty() && info.state == InstanceState::alive)
         {
-            ++it;
+            EPROSIMA_LOG_INFO(FASTDDSSPY_INSTANCECACHE,
+                    "Instance on topic " << topic_name
+                                         << " has no more active writers");
+            info.state = InstanceState::no_writers;
         }
     }
 }
@@ -194,64 +413,341 @@ void InstanceCache::on_writer_changed(
 void InstanceCache::clear() noexcept
 {
     std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-    instances_by_topic_.clear();
+
+    // NOTE: the instances of each topic are emptied but kept, as they may be resolved already
+    for (auto& topic_pair : instances_by_topic_)
+    {
+        TopicInstances& topic_instances = *topic_pair.second;
+        std::unique_lock<std::shared_timed_mutex> topic_lock(topic_instances.mutex);
+        topic_instances.instances.clear();
+        topic_instances.lru.clear();
+        topic_instances.writer_instances.clear();
+        topic_instances.evictions = EvictionStats();
+    }
+    lru_.clear();
+    memory_ = 0;
     key_fields_cache_.clear();
+    key_extractors_.clear();
     no_key_metadata_warned_topics_.clear();
 }
 
 // Private methods
 
-void InstanceCache::extract_key_field_names_(
-        const std::string& topic_name,
-        const fastdds::dds::DynamicType::_ref_type& dyn_type) noexcept
+std::size_t InstanceCache::InstanceHandleHash::operator ()(
+        const ddspipe::core::types::InstanceHandle& handle) const noexcept
+{
+    // FNV-1a over the bytes of the key hash, which may be the key itself padded with zeros
+    std::size_t hash = 14695981039346656037ull;
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        hash ^= handle.value[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+InstanceCache::TopicInstances& InstanceCache::topic_instances_nts_(
+        const std::string& topic_name)
+{
+    auto& topic_instances = instances_by_topic_[topic_name];
+    if (!topic_instances)
+    {
+        topic_instances.reset(new TopicInstances());
+    }
+    return *topic_instances;
+}
+
+void InstanceCache::update_instance_(
+        TopicInstances& topic,
+        const ddspipe::core::types::InstanceHandle& handle,
+        CachedInstance& instance,
+        const ddspipe::core::types::RtpsPayloadData& data,
+        int64_t time,
+        int64_t window) noexcept
 {
-    // Recompute only if key metadata has not been discovered yet
-    auto cached_keys_it = key_fields_cache_.find(topic_name);
-    if (cached_keys_it != key_fields_cache_.end() && !cached_keys_it->second.empty())
+    switch (data.kind)
+    {
+        case fastdds::rtps::ALIVE:
+            add_writer_(topic, handle, instance, data.source_guid);
+            instance.info.state = InstanceState::alive;
+            count_sample_(instance, data, time, window);
+            break;
+
+        case fastdds::rtps::NOT_ALIVE_DISPOSED:
+            add_writer_(topic, handle, instance, data.source_guid);
+            instance.info.state = InstanceState::disposed;
+            break;
+
+        case fastdds::rtps::NOT_ALIVE_DISPOSED_UNREGISTERED:
+            remove_writer_(topic, handle, instance, data.source_guid);
+            instance.info.state = InstanceState::disposed;
+            break;
+
+        case fastdds::rtps::NOT_ALIVE_UNREGISTERED:
+            remove_writer_(topic, handle, instance, data.source_guid);
+
+            // NOTE: a disposed instance remains disposed until new data is received
+            if (instance.info.active_writers.empty() && instance.info.state == InstanceState::alive)
+            {
+                instance.info.state = InstanceState::no_writers;
+            }
+            break;
+
+        default:
+            break;
+    }
+
+    touch_instance_(topic, instance);
+}
+
+void InstanceCache::count_sample_(
+        CachedInstance& instance,
+        const ddspipe::core::types::RtpsPayloadData& data,
+        int64_t time,
+        int64_t window) noexcept
+{
+    instance.samples.fetch_add(1, std::memory_order_relaxed);
+    instance.bytes.fetch_add(data.payload.length, std::memory_order_relaxed);
+    if (window > 0)
+    {
+        instance.rate.add(time, window);
+    }
+}
+
+void InstanceCache::evict_(
+        TopicInstances& topic,
+        std::size_t new_instances,
+        std::size_t new_memory) noexcept
+{
+    // Least recently seen instances of the topic
+    while (!topic.lru.empty() && topic.instances.size() + new_instances > max_instances_per_topic_)
+    {
+        if (evictable_(topic, topic.lru.front()))
+        {
+            erase_instance_(topic, topic.instances.find(topic.lru.front()));
+            ++topic.evictions.per_topic_limit;
+        }
+    }
+
+    // Least recently seen instances of any topic
+    while (!lru_.empty())
+    {
+        const LruEntry oldest = lru_.front();
+        if (lru_.size() + new_instances <= max_instances_ && memory_ + new_memory <= max_memory_)
+        {
+            break;
+        }
+
+        if (!evictable_(*oldest.topic, oldest.handle))
+        {
+            continue;
+        }
+
+        if (lru_.size() + new_instances > max_instances_)
+        {
+            ++oldest.topic->evictions.total_limit;
+        }
+        else
+        {
+            ++oldest.topic->evictions.memory_limit;
+        }
+
+        // NOTE: only this thread holds the lock of another topic while holding the lock of a topic
+        std::unique_lock<std::shared_timed_mutex> topic_lock(oldest.topic->mutex, std::defer_lock);
+        if (oldest.topic != &topic)
+        {
+            topic_lock.lock();
+        }
+        erase_instance_(*oldest.topic, oldest.topic->instances.find(oldest.handle));
+    }
+}
+
+void InstanceCache::add_writer_(
+        TopicInstances& topic,
+        const ddspipe::core::types::InstanceHandle& handle,
+        CachedInstance& instance,
+        const ddspipe::core::types::Guid& writer_guid) noexcept
+{
+    // NOTE: instances are published by a few writers, so a linear search is faster than a lookup
+    auto& active_writers = instance.info.active_writers;
+    if (std::find(active_writers.begin(), active_writers.end(), writer_guid) == active_writers.end())
+    {
+        active_writers.push_back(writer_guid);
+        topic.writer_instances[writer_guid].insert(handle);
+    }
+}
+
+void InstanceCache::remove_writer_(
+        TopicInstances& topic,
+        const ddspipe::core::types::InstanceHandle& handle,
+        CachedInstance& instance,
+        const ddspipe::core::types::Guid& writer_guid) noexcept
+{
+    auto& active_writers = instance.info.active_writers;
+    auto writer_it = std::find(active_writers.begin(), active_writers.end(), writer_guid);
+    if (writer_it == active_writers.end())
     {
         return;
     }
+    active_writers.erase(writer_it);
+
+    auto index_it = topic.writer_instances.find(writer_guid);
+    if (index_it != topic.writer_instances.end())
+    {
+        index_it->second.erase(handle);
+        if (index_it->second.empty())
+        {
+            topic.writer_instances.erase(index_it);
+        }
+    }
+}
+
+void InstanceCache::erase_instance_(
+        TopicInstances& topic,
+        Instances::iterator instance_it) noexcept
+{
+    for (const auto& writer_guid : instance_it->second.info.active_writers)
+    {
+        auto writer_it = topic.writer_instances.find(writer_guid);
+        if (writer_it != topic.writer_instances.end())
+        {
+            writer_it->second.erase(instance_it->first);
+            if (writer_it->second.empty())
+            {
+                topic.writer_instances.erase(writer_it);
+            }
+        }
+    }
+
+    memory_ -= instance_it->second.info.key_representation.size();
+    topic.lru.erase(instance_it->second.topic_lru);
+    lru_.erase(instance_it->second.lru);
+    topic.instances.erase(instance_it);
+}
+
+bool InstanceCache::evictable_(
+        TopicInstances& topic,
+        const ddspipe::core::types::InstanceHandle& handle) noexcept
+{
+    CachedInstance& instance = topic.instances.find(handle)->second;
+    if (!instance.seen.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+
+    touch_instance_(topic, instance);
+    return false;
+}
+
+void InstanceCache::touch_instance_(
+        TopicInstances& topic,
+        CachedInstance& instance) noexcept
+{
+    instance.seen.store(false, std::memory_order_relaxed);
+    topic.lru.splice(topic.lru.end(), topic.lru, instance.topic_lru);
+    lru_.splice(lru_.end(), lru_, instance.lru);
+}
+
+std::shared_ptr<const InstanceCache::KeyExtractor> InstanceCache::key_extractor_(
+        const std::string& topic_name,
+        const TypeDecoder& decoder) noexcept
+{
+    // Compile only the first time the type of the topic is seen
+    auto& extractor = key_extractors_[topic_name];
+    if (extractor && extractor->type == decoder.type())
+    {
+        return extractor;
+    }
 
     try
     {
-        std::vector<std::string> key_names;
+        auto new_extractor = std::make_shared<KeyExtractor>();
+        new_extractor->type = decoder.type();
+
         fastdds::dds::DynamicTypeMembersById members;
+        if (fastdds::dds::RETCODE_OK != decoder.type()->get_all_members(members))
+        {
+            return nullptr;
+        }
+
+        // Key-only type, built once for the samples that cannot be read from their payload
+        auto type_factory = fastdds::dds::DynamicTypeBuilderFactory::get_instance();
+        auto key_type_desc = fastdds::dds::traits<fastdds::dds::TypeDescriptor>::make_shared();
+        key_type_desc->kind(fastdds::dds::TK_STRUCTURE);
+        key_type_desc->name(decoder.type()->get_name().to_string() + "_KeysOnly");
+        auto key_type_builder = type_factory->create_type(key_type_desc);
 
-        if (fastdds::dds::RETCODE_OK == dyn_type->get_all_members(members))
+        std::vector<std::string> key_names;
+        for (const auto& member_pair : members)
         {
-            for (const auto& member_pair : members)
+            const auto& member = member_pair.second;
+            auto member_desc = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
+            if (fastdds::dds::RETCODE_OK != member->get_descriptor(member_desc) || !member_desc->is_key())
             {
-                const auto& member = member_pair.second;
-                auto descriptor = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
-                if (fastdds::dds::RETCODE_OK == member->get_descriptor(descriptor) &&
-                        descriptor->is_key())
-                {
-                    key_names.push_back(member->get_name().to_string());
-                }
+                continue;
+            }
+
+            key_names.push_back(member->get_name().to_string());
+            new_extractor->key_member_ids.push_back(member->get_id());
+
+            auto key_member_desc = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
+            key_member_desc->name(member_desc->name());
+            key_member_desc->type(member_desc->type());
+            key_member_desc->id(member_desc->id());
+            key_type_builder->add_member(key_member_desc);
+        }
+
+        if (!key_names.empty())
+        {
+            new_extractor->key_only_type = key_type_builder->build();
+
+            if (decoder.layout())
+            {
+                // NOTE: the key members are read in serialization order, and the members after the last key are
+                // never read
+                std::string error;
+                new_extractor->projection = cdr::build_field_projection(*decoder.layout(), key_names, error);
             }
         }
 
-        key_fields_cache_[topic_name] = key_names;
+        key_fields_cache_[topic_name] = std::move(key_names);
+        extractor = std::move(new_extractor);
+        return extractor;
     }
     catch (const std::exception& e)
     {
         EPROSIMA_LOG_WARNING(FASTDDSSPY_INSTANCECACHE,
                 "Exception extracting key fields: " << e.what());
+        return nullptr;
     }
 }
 
 std::string InstanceCache::serialize_key_to_json_(
-        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        const KeyExtractor& extractor,
+        TypeDecoder& decoder,
         const ddspipe::core::types::RtpsPayloadData& data) noexcept
 {
     try
     {
-        // Deserialize payload to DynamicData
-        auto& data_no_const = const_cast<ddspipe::core::types::RtpsPayloadData&>(data);
-        fastdds::dds::DynamicPubSubType pubsub_type(dyn_type);
-        auto dyn_data = fastdds::dds::DynamicDataFactory::get_instance()->create_data(dyn_type);
+        // Read only the key members from the payload
+        if (extractor.projection)
+        {
+            // NOTE: every thread keeps its own serializer, as the slow path runs without holding the lock
+            thread_local CdrJsonSerializer key_serializer;
+            key_serializer.set_compact(true);
 
-        if (!pubsub_type.deserialize(data_no_const.payload, &dyn_data))
+            std::string key_json;
+            if (key_serializer.serialize(*decoder.layout(), *extractor.projection, data.payload.data,
+                    data.payload.length, key_json))
+            {
+                return key_json;
+            }
+        }
+
+        // Deserialize payload to DynamicData borrowed from the decoder
+        auto dyn_data = decoder.deserialize(data);
+
+        if (!dyn_data)
         {
             EPROSIMA_LOG_WARNING(FASTDDSSPY_INSTANCECACHE,
                     "Failed to deserialize payload");
@@ -259,7 +755,7 @@ std::string InstanceCache::serialize_key_to_json_(
         }
 
         // Create key-only DynamicData
-        auto key_data = create_key_only_dynamic_data_(dyn_type, dyn_data);
+        auto key_data = create_key_only_dynamic_data_(extractor, dyn_data.get());
         if (!key_data)
         {
             EPROSIMA_LOG_WARNING(FASTDDSSPY_INSTANCECACHE,
@@ -290,73 +786,24 @@ std::string InstanceCache::serialize_key_to_json_(
 }
 
 fastdds::dds::DynamicData::_ref_type InstanceCache::create_key_only_dynamic_data_(
-        const fastdds::dds::DynamicType::_ref_type& original_type,
+        const KeyExtractor& extractor,
         const fastdds::dds::DynamicData::_ref_type& original_data) noexcept
 {
     try
     {
-        fastdds::dds::DynamicTypeMembersById members;
-        if (fastdds::dds::RETCODE_OK != original_type->get_all_members(members))
-        {
-            return nullptr;
-        }
-
-        // Build key-only type
-        auto type_factory = fastdds::dds::DynamicTypeBuilderFactory::get_instance();
-        auto key_type_desc = fastdds::dds::traits<fastdds::dds::TypeDescriptor>::make_shared();
-        key_type_desc->kind(fastdds::dds::TK_STRUCTURE);
-        key_type_desc->name(original_type->get_name().to_string() + "_KeysOnly");
-
-        auto key_type_builder = type_factory->create_type(key_type_desc);
-
-        bool has_keys = false;
-        for (const auto& member_pair : members)
-        {
-            const auto& member = member_pair.second;
-            auto member_desc = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
-
-            if (fastdds::dds::RETCODE_OK != member->get_descriptor(member_desc))
-            {
-                continue;
-            }
-
-            if (member_desc->is_key())
-            {
-                has_keys = true;
-
-                auto new_member_desc = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
-                new_member_desc->name(member_desc->name());
-                new_member_desc->type(member_desc->type());
-                new_member_desc->id(member_desc->id());
-
-                key_type_builder->add_member(new_member_desc);
-            }
-        }
-
-        if (!has_keys)
+        auto key_data = fastdds::dds::DynamicDataFactory::get_instance()->create_data(extractor.key_only_type);
+        if (!key_data)
         {
             return nullptr;
         }
 
-        auto key_type = key_type_builder->build();
-        auto key_data = fastdds::dds::DynamicDataFactory::get_instance()->create_data(key_type);
-
         // Copy key values
-        for (const auto& member_pair : members)
+        for (const fastdds::dds::MemberId id : extractor.key_member_ids)
         {
-            const auto& member = member_pair.second;
-            auto member_desc = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
-
-            if (fastdds::dds::RETCODE_OK != member->get_descriptor(member_desc) ||
-                    !member_desc->is_key())
-            {
-                continue;
-            }
-
-            auto loaned_value = original_data->loan_value(member->get_id());
+            auto loaned_value = original_data->loan_value(id);
             if (loaned_value)
             {
-                key_data->set_complex_value(member->get_id(), loaned_value);
+                key_data->set_complex_value(id, loaned_value);
                 original_data->return_loaned_value(loaned_value);
             }
         }
@@ -0,0 +1,155 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+
+#include <fastddsspy_participants/model/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+constexpr uint32_t LatencyHistogram::SUB_BUCKET_BITS;
+constexpr uint32_t LatencyHistogram::SUB_BUCKETS;
+constexpr uint32_t LatencyHistogram::MAX_LATENCY_BITS;
+constexpr int64_t LatencyHistogram::MAX_LATENCY;
+constexpr std::size_t LatencyHistogram::BUCKETS;
+
+double LatencyHistogram::Snapshot::mean() const noexcept
+{
+    return count == 0 ? 0 : static_cast<double>(sum) / static_cast<double>(count);
+}
+
+int64_t LatencyHistogram::Snapshot::percentile(
+        double quantile) const noexcept
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    // Rank of the latency, the lowest one is rank 1
+    const double rank = std::ceil(std::min(std::max(quantile, 0.0), 1.0) * static_cast<double>(count));
+    const uint64_t target = std::max<uint64_t>(static_cast<uint64_t>(rank), 1);
+
+    uint64_t counted = 0;
+    for (std::size_t i = 0; i < buckets.size(); ++i)
+    {
+        counted += buckets[i];
+        if (counted >= target)
+        {
+            return std::min(bucket_upper_bound(i), max);
+        }
+    }
+
+    // Latencies added while the snapshot was taken may be in the count but not in the buckets
+    return max;
+}
+
+void LatencyHistogram::Snapshot::merge(
+        const Snapshot& other)
+{
+    if (other.count == 0)
+    {
+        return;
+    }
+
+    max = count == 0 ? other.max : std::max(max, other.max);
+    count += other.count;
+    sum += other.sum;
+
+    if (buckets.size() < other.buckets.size())
+    {
+        buckets.resize(other.buckets.size(), 0);
+    }
+    for (std::size_t i = 0; i < other.buckets.size(); ++i)
+    {
+        buckets[i] += other.buckets[i];
+    }
+}
+
+void LatencyHistogram::add(
+        int64_t latency) noexcept
+{
+    latency = std::max<int64_t>(latency, 0);
+
+    buckets_[bucket_index(latency)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(latency, std::memory_order_relaxed);
+
+    int64_t max = max_.load(std::memory_order_relaxed);
+    while (latency > max && !max_.compare_exchange_weak(max, latency, std::memory_order_relaxed))
+    {
+        // max updated with the current value, try again
+    }
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::snapshot() const
+{
+    Snapshot snapshot;
+    snapshot.buckets.reserve(BUCKETS);
+    for (const auto& bucket : buckets_)
+    {
+        snapshot.buckets.push_back(bucket.load(std::memory_order_relaxed));
+    }
+    snapshot.count = count_.load(std::memory_order_relaxed);
+    snapshot.sum = sum_.load(std::memory_order_relaxed);
+    snapshot.max = max_.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+std::size_t LatencyHistogram::bucket_index(
+        int64_t latency) noexcept
+{
+    if (latency < static_cast<int64_t>(SUB_BUCKETS))
+    {
+        return static_cast<std::size_t>(std::max<int64_t>(latency, 0));
+    }
+    if (latency >= MAX_LATENCY)
+    {
+        return BUCKETS - 1;
+    }
+
+    // Power of two of the latency over the first SUB_BUCKETS, whose bits below the top ones are dropped
+    const uint64_t value = static_cast<uint64_t>(latency);
+    uint32_t shift = 0;
+    for (uint64_t rest = value >> (SUB_BUCKET_BITS + 1); rest != 0; rest >>= 1)
+    {
+        ++shift;
+    }
+
+    return (shift + 1) * SUB_BUCKETS + static_cast<std::size_t>((value >> shift) & (SUB_BUCKETS - 1));
+}
+
+int64_t LatencyHistogram::bucket_upper_bound(
+        std::size_t index) noexcept
+{
+    if (index < SUB_BUCKETS)
+    {
+        return static_cast<int64_t>(index);
+    }
+    if (index >= BUCKETS - 1)
+    {
+        return MAX_LATENCY;
+    }
+
+    const uint32_t shift = static_cast<uint32_t>(index / SUB_BUCKETS - 1);
+    const uint64_t lower_bound = (SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+    return static_cast<int64_t>(lower_bound + (uint64_t(1) << shift) - 1);
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,115 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+
+#include <fastddsspy_participants/model/PayloadSizeStats.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+constexpr std::size_t PayloadSizeStats::BUCKETS;
+
+double PayloadSizeStats::Snapshot::mean() const noexcept
+{
+    return count == 0 ? 0 : static_cast<double>(sum) / static_cast<double>(count);
+}
+
+void PayloadSizeStats::Snapshot::merge(
+        const Snapshot& other)
+{
+    if (other.count == 0)
+    {
+        return;
+    }
+
+    min = count == 0 ? other.min : std::min(min, other.min);
+    max = std::max(max, other.max);
+    count += other.count;
+    sum += other.sum;
+
+    if (buckets.size() < other.buckets.size())
+    {
+        buckets.resize(other.buckets.size(), 0);
+    }
+    for (std::size_t i = 0; i < other.buckets.size(); ++i)
+    {
+        buckets[i] += other.buckets[i];
+    }
+}
+
+void PayloadSizeStats::add(
+        uint32_t size) noexcept
+{
+    buckets_[bucket_index(size)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(size, std::memory_order_relaxed);
+
+    uint32_t min = min_.load(std::memory_order_relaxed);
+    while (size < min && !min_.compare_exchange_weak(min, size, std::memory_order_relaxed))
+    {
+        // min updated with the current value, try again
+    }
+
+    uint32_t max = max_.load(std::memory_order_relaxed);
+    while (size > max && !max_.compare_exchange_weak(max, size, std::memory_order_relaxed))
+    {
+        // max updated with the current value, try again
+    }
+}
+
+PayloadSizeStats::Snapshot PayloadSizeStats::snapshot() const
+{
+    Snapshot snapshot;
+    snapshot.buckets.reserve(BUCKETS);
+    for (const auto& bucket : buckets_)
+    {
+        snapshot.buckets.push_back(bucket.load(std::memory_order_relaxed));
+    }
+    snapshot.count = count_.load(std::memory_order_relaxed);
+    snapshot.sum = sum_.load(std::memory_order_relaxed);
+    const uint32_t min = min_.load(std::memory_order_relaxed);
+    snapshot.min = min == std::numeric_limits<uint32_t>::max() ? 0 : min;
+    snapshot.max = max_.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+std::size_t PayloadSizeStats::bucket_index(
+        uint32_t size) noexcept
+{
+    // Number of significant bits of the size
+    std::size_t index = 0;
+    for (; size != 0; size >>= 1)
+    {
+        ++index;
+    }
+    return index;
+}
+
+uint64_t PayloadSizeStats::bucket_lower_bound(
+        std::size_t index) noexcept
+{
+    return index == 0 ? 0 : uint64_t(1) << (index - 1);
+}
+
+uint64_t PayloadSizeStats::bucket_upper_bound(
+        std::size_t index) noexcept
+{
+    return (uint64_t(1) << index) - 1;
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
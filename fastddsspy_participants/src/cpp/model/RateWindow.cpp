@@ -0,0 +1,180 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+
+#include <fastddsspy_participants/model/RateWindow.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+constexpr std::size_t RateWindow::BUCKETS;
+constexpr int64_t RateWindow::HALF_LIFE_DIVISOR;
+constexpr uint32_t RateWindow::COUNT_BITS;
+constexpr uint64_t RateWindow::COUNT_MASK;
+constexpr uint64_t RateWindow::TAG_MASK;
+constexpr int64_t RateWindow::UNSET_TIME;
+
+void RateWindow::add(
+        int64_t time,
+        int64_t window,
+        uint64_t amount /* = 1 */) noexcept
+{
+    int64_t unset_time = UNSET_TIME;
+    first_time_.compare_exchange_strong(unset_time, time, std::memory_order_relaxed);
+
+    const int64_t span = span_(time, bucket_width_(window));
+    const uint64_t tag = span_tag_(span);
+    std::atomic<uint64_t>& bucket = buckets_[bucket_index_(span)];
+
+    uint64_t value = bucket.load(std::memory_order_relaxed);
+    uint64_t new_value;
+    do
+    {
+        const uint64_t bucket_tag = value >> COUNT_BITS;
+        if (bucket_tag == tag)
+        {
+            new_value = value + amount;
+        }
+        else if ((value & COUNT_MASK) == 0)
+        {
+            // Bucket never used
+            new_value = (tag << COUNT_BITS) | amount;
+        }
+        else
+        {
+            // Tags wrap around, so the distance between them tells which one is newer
+            const uint64_t distance = (tag - bucket_tag) & TAG_MASK;
+            if (distance > TAG_MASK / 2)
+            {
+                // The bucket already counts a later span, so this data is out of the window
+                return;
+            }
+            new_value = (tag << COUNT_BITS) | amount;
+        }
+    }
+    while (!bucket.compare_exchange_weak(value, new_value, std::memory_order_relaxed));
+}
+
+double RateWindow::rate(
+        int64_t now,
+        int64_t window) const noexcept
+{
+    const RateWindow* const self = this;
+    return rate(&self, 1, now, window);
+}
+
+double RateWindow::rate(
+        const RateWindow* const* windows,
+        std::size_t size,
+        int64_t now,
+        int64_t window) noexcept
+{
+    int64_t first_time = UNSET_TIME;
+    for (std::size_t w = 0; w < size; ++w)
+    {
+        const int64_t window_first_time = windows[w]->first_time_.load(std::memory_order_relaxed);
+        if (window_first_time != UNSET_TIME && (first_time == UNSET_TIME || window_first_time < first_time))
+        {
+            first_time = window_first_time;
+        }
+    }
+
+    if (first_time == UNSET_TIME)
+    {
+        return 0;
+    }
+
+    const int64_t width = bucket_width_(window);
+    const double half_life = static_cast<double>(std::max<int64_t>(window / HALF_LIFE_DIVISOR, 1));
+    const int64_t now_span = span_(now, width);
+
+    // Weighted count of data and time covered by the buckets, from the newest
+    double weighted_count = 0;
+    double weighted_time = 0;
+    for (std::size_t i = 0; i < BUCKETS; ++i)
+    {
+        const int64_t span = now_span - static_cast<int64_t>(i);
+        if (span * width + width <= first_time)
+        {
+            // Before the first data
+            break;
+        }
+
+        const int64_t start = std::max(span * width, first_time);
+        const int64_t end = std::min(span * width + width, now);
+        if (end <= start)
+        {
+            continue;
+        }
+
+        uint64_t count = 0;
+        for (std::size_t w = 0; w < size; ++w)
+        {
+            const uint64_t value = windows[w]->buckets_[bucket_index_(span)].load(std::memory_order_relaxed);
+            if ((value >> COUNT_BITS) == span_tag_(span))
+            {
+                count += value & COUNT_MASK;
+            }
+        }
+
+        const double weight = std::exp2(-static_cast<double>(now - end) / half_life);
+        weighted_count += weight * static_cast<double>(count);
+        weighted_time += weight * static_cast<double>(end - start);
+    }
+
+    if (weighted_count == 0)
+    {
+        return 0;
+    }
+
+    // Do not give a huge rate from a first data received just now
+    weighted_time = std::max(weighted_time, static_cast<double>(width));
+
+    return weighted_count / weighted_time * 1e9;
+}
+
+int64_t RateWindow::bucket_width_(
+        int64_t window) noexcept
+{
+    return std::max<int64_t>(window / static_cast<int64_t>(BUCKETS), 1);
+}
+
+int64_t RateWindow::span_(
+        int64_t time,
+        int64_t width) noexcept
+{
+    // Round down also for negative times
+    const int64_t span = time / width;
+    return (time % width < 0) ? span - 1 : span;
+}
+
+std::size_t RateWindow::bucket_index_(
+        int64_t span) noexcept
+{
+    const int64_t index = span % static_cast<int64_t>(BUCKETS);
+    return static_cast<std::size_t>(index < 0 ? index + static_cast<int64_t>(BUCKETS) : index);
+}
+
+uint64_t RateWindow::span_tag_(
+        int64_t span) noexcept
+{
+    return static_cast<uint64_t>(span) & TAG_MASK;
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
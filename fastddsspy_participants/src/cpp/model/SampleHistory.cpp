@@ -0,0 +1,158 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+
+#include <fastddsspy_participants/model/payload_utils.hpp>
+#include <fastddsspy_participants/model/SampleHistory.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+constexpr std::size_t SampleHistory::DEFAULT_MAX_MEMORY;
+
+SampleHistory::SampleHistory(
+        std::size_t depth,
+        std::size_t max_memory /* = DEFAULT_MAX_MEMORY */)
+    : depth_(depth)
+    , max_memory_(max_memory)
+{
+    // Do nothing
+}
+
+SampleHistory::TopicHistory& SampleHistory::topic_history(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    {
+        std::shared_lock<std::shared_timed_mutex> _(mutex_);
+        auto it = topics_.find(topic);
+        if (it != topics_.end())
+        {
+            return *it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+
+    auto& history = topics_[topic];
+    if (!history)
+    {
+        history = std::make_unique<TopicHistory>();
+        topic_count_.store(topics_.size());
+
+        // The share of every other topic is smaller now
+        const std::size_t topic_memory = topic_memory_();
+        for (auto& it : topics_)
+        {
+            std::lock_guard<std::mutex> lock(it.second->mutex);
+            shrink_nts_(*it.second, topic_memory);
+        }
+    }
+
+    return *history;
+}
+
+void SampleHistory::add(
+        TopicHistory& history,
+        const ddspipe::core::types::RtpsPayloadData& data)
+{
+    const std::size_t topic_memory = topic_memory_();
+    if (depth_ == 0 || data.payload.length > topic_memory)
+    {
+        return;
+    }
+
+    // NOTE: retained before locking, as it may need to copy the payload
+    auto sample = retain_payload_data(data);
+
+    std::lock_guard<std::mutex> _(history.mutex);
+
+    if (history.ring.size() != depth_)
+    {
+        history.ring.resize(depth_);
+    }
+
+    if (history.size == depth_)
+    {
+        pop_oldest_nts_(history);
+    }
+    shrink_nts_(history, topic_memory - data.payload.length);
+
+    history.ring[(history.first + history.size) % depth_] = std::move(sample);
+    ++history.size;
+    history.bytes += data.payload.length;
+}
+
+std::vector<std::shared_ptr<const ddspipe::core::types::RtpsPayloadData>> SampleHistory::last(
+        const ddspipe::core::types::DdsTopic& topic,
+        std::size_t n) const
+{
+    std::vector<std::shared_ptr<const ddspipe::core::types::RtpsPayloadData>> result;
+
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    auto it = topics_.find(topic);
+    if (it == topics_.end())
+    {
+        return result;
+    }
+
+    auto& history = *it->second;
+    std::lock_guard<std::mutex> lock(history.mutex);
+
+    const std::size_t count = std::min(n, history.size);
+    result.reserve(count);
+    for (std::size_t i = history.size - count; i < history.size; ++i)
+    {
+        result.push_back(history.ring[(history.first + i) % history.ring.size()]);
+    }
+
+    return result;
+}
+
+std::size_t SampleHistory::depth() const noexcept
+{
+    return depth_;
+}
+
+void SampleHistory::pop_oldest_nts_(
+        TopicHistory& history)
+{
+    auto& oldest = history.ring[history.first];
+    history.bytes -= oldest->payload.length;
+    oldest.reset();
+
+    history.first = (history.first + 1) % history.ring.size();
+    --history.size;
+}
+
+void SampleHistory::shrink_nts_(
+        TopicHistory& history,
+        std::size_t bytes)
+{
+    while (history.size > 0 && history.bytes > bytes)
+    {
+        pop_oldest_nts_(history);
+    }
+}
+
+std::size_t SampleHistory::topic_memory_() const noexcept
+{
+    return max_memory_ / std::max<std::size_t>(topic_count_.load(std::memory_order_relaxed), 1);
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
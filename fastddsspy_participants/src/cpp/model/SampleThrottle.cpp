@@ -0,0 +1,152 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mutex>
+
+#include <fastddsspy_participants/model/SampleThrottle.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+namespace {
+
+std::chrono::nanoseconds min_interval(
+        double max_rate)
+{
+    if (max_rate <= SampleThrottle::UNLIMITED_RATE)
+    {
+        return std::chrono::nanoseconds(0);
+    }
+    return std::chrono::nanoseconds(static_cast<int64_t>(1e9 / max_rate));
+}
+
+} /* namespace */
+
+constexpr double SampleThrottle::UNLIMITED_RATE;
+
+SampleThrottle::SampleThrottle(
+        double max_rate /* = UNLIMITED_RATE */,
+        uint32_t every /* = 1 */)
+    : min_interval_(min_interval(max_rate))
+    , every_(every > 0 ? every : 1)
+{
+    // Do nothing
+}
+
+bool SampleThrottle::limited() const noexcept
+{
+    return every_ > 1 || min_interval_.count() > 0;
+}
+
+bool SampleThrottle::accept(
+        const std::string& topic_name)
+{
+    return accept(topic_name, std::chrono::steady_clock::now());
+}
+
+bool SampleThrottle::accept(
+        const std::string& topic_name,
+        std::chrono::steady_clock::time_point now)
+{
+    if (!limited())
+    {
+        return true;
+    }
+
+    return accept(topic_state(topic_name), now);
+}
+
+bool SampleThrottle::accept(
+        TopicState& state)
+{
+    return accept(state, std::chrono::steady_clock::now());
+}
+
+bool SampleThrottle::accept(
+        TopicState& state,
+        std::chrono::steady_clock::time_point now)
+{
+    if (!limited())
+    {
+        return true;
+    }
+
+    // Decimation: keep the first of every every_ samples
+    if (every_ > 1 && state.received.fetch_add(1, std::memory_order_relaxed) % every_ != 0)
+    {
+        state.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    // Rate limit: keep the sample if the interval since the last one kept has passed
+    if (min_interval_.count() > 0)
+    {
+        const int64_t now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+        int64_t next_allowed_time = state.next_allowed_time.load(std::memory_order_relaxed);
+
+        // NOTE: if another thread keeps a sample meanwhile, this one is suppressed
+        if (now_ns < next_allowed_time ||
+                !state.next_allowed_time.compare_exchange_strong(
+                    next_allowed_time, now_ns + min_interval_.count(), std::memory_order_relaxed))
+        {
+            state.suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::map<std::string, uint64_t> SampleThrottle::suppressed_samples() const
+{
+    std::shared_lock<std::shared_timed_mutex> _(mutex_);
+
+    std::map<std::string, uint64_t> suppressed;
+    for (const auto& topic : topics_)
+    {
+        const uint64_t count = topic.second->suppressed.load(std::memory_order_relaxed);
+        if (count > 0)
+        {
+            suppressed[topic.first] = count;
+        }
+    }
+    return suppressed;
+}
+
+SampleThrottle::TopicState& SampleThrottle::topic_state(
+        const std::string& topic_name)
+{
+    {
+        std::shared_lock<std::shared_timed_mutex> _(mutex_);
+        auto it = topics_.find(topic_name);
+        if (it != topics_.end())
+        {
+            return *it->second;
+        }
+    }
+
+    // NOTE: states are never removed, so the reference stays valid once the lock is released
+    std::unique_lock<std::shared_timed_mutex> _(mutex_);
+    auto& state = topics_[topic_name];
+    if (!state)
+    {
+        state.reset(new TopicState());
+    }
+    return *state;
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
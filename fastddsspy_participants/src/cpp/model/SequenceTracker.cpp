@@ -0,0 +1,155 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+
+#include <fastddsspy_participants/model/SequenceTracker.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+constexpr uint64_t SequenceTracker::HISTORY;
+constexpr std::size_t SequenceTracker::HISTORY_WORDS;
+constexpr int64_t SequenceTracker::UNSET_TIME;
+
+void SequenceTracker::add(
+        uint64_t sequence_number,
+        int64_t time,
+        int64_t window,
+        int64_t source_time,
+        bool live)
+{
+    // Samples sent since the previous highest sequence number
+    uint64_t sent = 0;
+    bool duplicate = false;
+    {
+        std::lock_guard<std::mutex> _(mutex_);
+
+        if (highest_ == 0 || sequence_number > highest_)
+        {
+            // The sequence numbers skipped are lost, unless they arrive later
+            sent = highest_ == 0 ? 1 : sequence_number - highest_;
+            lost_ += sent - 1;
+
+            // Forget the sequence numbers that leave the history
+            if (sent >= HISTORY)
+            {
+                history_.fill(0);
+            }
+            else
+            {
+                for (uint64_t skipped = sequence_number - sent + 1; skipped < sequence_number; ++skipped)
+                {
+                    mark_nts_(skipped, false);
+                }
+            }
+
+            mark_nts_(sequence_number, true);
+            highest_ = sequence_number;
+            ++received_;
+        }
+        else if (highest_ - sequence_number < HISTORY && received_nts_(sequence_number))
+        {
+            ++duplicates_;
+            duplicate = true;
+        }
+        else
+        {
+            // NOTE: a sample older than the history cannot be told from a duplicate, it is taken as a late one
+            if (highest_ - sequence_number < HISTORY)
+            {
+                mark_nts_(sequence_number, true);
+            }
+
+            // It was counted as lost when it was skipped
+            lost_ -= std::min<uint64_t>(lost_, 1);
+            ++out_of_order_;
+            ++received_;
+        }
+
+        if (live)
+        {
+            if (last_time_ != UNSET_TIME)
+            {
+                const int64_t jitter = (time - last_time_) - (source_time - last_source_time_);
+                jitter_.add(jitter < 0 ? -jitter : jitter);
+            }
+
+            last_time_ = time;
+            last_source_time_ = source_time;
+        }
+    }
+
+    if (sent > 0)
+    {
+        sent_window_.add(time, window, sent);
+    }
+    if (!duplicate)
+    {
+        received_window_.add(time, window);
+    }
+}
+
+SequenceTracker::Snapshot SequenceTracker::snapshot(
+        int64_t now,
+        int64_t window) const
+{
+    Snapshot snapshot;
+    {
+        std::lock_guard<std::mutex> _(mutex_);
+        snapshot.received = received_;
+        snapshot.lost = lost_;
+        snapshot.out_of_order = out_of_order_;
+        snapshot.duplicates = duplicates_;
+    }
+
+    // NOTE: late samples are counted when they arrive, so more samples may be received than sent in the window
+    const double sent = sent_window_.rate(now, window);
+    if (sent > 0)
+    {
+        snapshot.loss_ratio = std::max(0.0, 1 - received_window_.rate(now, window) / sent);
+    }
+
+    snapshot.jitter = jitter_.snapshot();
+
+    return snapshot;
+}
+
+bool SequenceTracker::received_nts_(
+        uint64_t sequence_number) const noexcept
+{
+    const uint64_t index = sequence_number % HISTORY;
+    return (history_[index / 64] >> (index % 64)) & 1;
+}
+
+void SequenceTracker::mark_nts_(
+        uint64_t sequence_number,
+        bool received) noexcept
+{
+    const uint64_t index = sequence_number % HISTORY;
+    const uint64_t bit = uint64_t(1) << (index % 64);
+    if (received)
+    {
+        history_[index / 64] |= bit;
+    }
+    else
+    {
+        history_[index / 64] &= ~bit;
+    }
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
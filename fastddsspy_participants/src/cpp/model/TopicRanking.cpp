@@ -0,0 +1,93 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
+#include <fastddsspy_participants/model/TopicRanking.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+TopicRanking::TopicRanking(
+        std::size_t size,
+        Key key)
+    : size_(size)
+    , key_(key)
+{
+    heap_.reserve(size);
+}
+
+void TopicRanking::add(
+        TopicActivity&& activity)
+{
+    if (size_ == 0)
+    {
+        return;
+    }
+
+    // NOTE: with the higher ranked as the lower in the heap, its front is the lowest ranked kept
+    auto lower = [this](const TopicActivity& lhs, const TopicActivity& rhs)
+            {
+                return higher_(lhs, rhs);
+            };
+
+    if (heap_.size() < size_)
+    {
+        heap_.push_back(std::move(activity));
+        std::push_heap(heap_.begin(), heap_.end(), lower);
+    }
+    else if (higher_(activity, heap_.front()))
+    {
+        std::pop_heap(heap_.begin(), heap_.end(), lower);
+        heap_.back() = std::move(activity);
+        std::push_heap(heap_.begin(), heap_.end(), lower);
+    }
+}
+
+std::vector<TopicActivity> TopicRanking::take()
+{
+    std::vector<TopicActivity> result;
+    result.swap(heap_);
+    std::sort(result.begin(), result.end(), [this](const TopicActivity& lhs, const TopicActivity& rhs)
+            {
+                return higher_(lhs, rhs);
+            });
+    return result;
+}
+
+bool TopicRanking::higher_(
+        const TopicActivity& lhs,
+        const TopicActivity& rhs) const noexcept
+{
+    // Ties are broken by name, so the ranking does not change between refreshes with the same activity
+    switch (key_)
+    {
+        case Key::bandwidth:
+            return std::tie(rhs.bandwidth, lhs.topic_name) < std::tie(lhs.bandwidth, rhs.topic_name);
+
+        case Key::writers:
+            return std::tie(rhs.writers, lhs.topic_name) < std::tie(lhs.writers, rhs.topic_name);
+
+        case Key::rate:
+        default:
+            return std::tie(rhs.rate, lhs.topic_name) < std::tie(lhs.rate, rhs.topic_name);
+    }
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
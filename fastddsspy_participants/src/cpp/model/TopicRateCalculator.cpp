@@ -12,7 +12,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License\.
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <limits>
+#include <mutex>
+#include <utility>
+
+#include <fastdds/rtps/common/SequenceNumber.hpp>
 
 #include <fastddsspy_participants/model/TopicRateCalculator.hpp>
 
@@ -20,24 +27,47 @@ namespace eprosima {
 namespace spy {
 namespace participants {
 
+constexpr uint32_t TopicRateCalculator::DEFAULT_RATE_WINDOW_MS;
+constexpr std::size_t TopicRateCalculator::SHARDS;
+constexpr int64_t TopicRateCalculator::RateShard::UNSET_TIME;
+
+namespace {
+
+//! Time to count live data in the rate window, monotonic
+int64_t steady_time_ns() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//! Number of the calling thread, given in turns so that threads running at once get different shards
+std::size_t thread_number() noexcept
+{
+    static std::atomic<std::size_t> next_thread_number {0};
+    thread_local const std::size_t number = next_thread_number.fetch_add(1, std::memory_order_relaxed);
+    return number;
+}
+
+} /* namespace */
+
 void TopicRateCalculator::add_data(
         const ddspipe::core::types::DdsTopic& topic,
         ddspipe::core::types::RtpsPayloadData& data)
 {
-    std::unique_lock<RateByTopicMapType> _(data_by_topic_);
-    auto& rate_data = get_or_create_data_rate_from_topic_nts_(topic);
-
-    // If is first data, set initial time
-    if (rate_data.data_received == 0)
+    DataRateInfo* rate_data;
     {
-        rate_data.first_data_time = data.source_timestamp;
+        std::shared_lock<RateByTopicMapType> _(data_by_topic_);
+        rate_data = get_data_rate_from_topic_nts_(topic);
     }
 
-    // Set reception time
-    rate_data.last_data_time = data.source_timestamp;
+    // Only the first data of a topic needs an exclusive lock
+    if (!rate_data)
+    {
+        std::unique_lock<RateByTopicMapType> _(data_by_topic_);
+        rate_data = &get_or_create_data_rate_from_topic_nts_(topic);
+    }
 
-    // Increase in 1 the number of data received
-    rate_data.data_received++;
+    add_data_(*rate_data, data);
 }
 
 TopicRateCalculator::RateType TopicRateCalculator::get_topic_rate(
@@ -45,22 +75,334 @@ TopicRateCalculator::RateType TopicRateCalculator::get_topic_rate(
 {
     std::shared_lock<RateByTopicMapType> _(data_by_topic_);
 
-    DataRateInfo data;
-    bool exist = get_data_rate_from_topic_nts_(topic, data);
-    if (!exist)
+    const DataRateInfo* rate_data = get_data_rate_from_topic_nts_(topic);
+    if (!rate_data)
+    {
+        return 0;
+    }
+
+    return topic_rate_(*rate_data);
+}
+
+TopicRateCalculator::RateType TopicRateCalculator::get_topic_average_rate(
+        const ddspipe::core::types::DdsTopic& topic) const noexcept
+{
+    std::shared_lock<RateByTopicMapType> _(data_by_topic_);
+
+    const DataRateInfo* rate_data = get_data_rate_from_topic_nts_(topic);
+    if (!rate_data)
+    {
+        return 0;
+    }
+
+    uint64_t data_received = 0;
+    int64_t first_data_time = std::numeric_limits<int64_t>::max();
+    int64_t last_data_time = std::numeric_limits<int64_t>::min();
+    for (const RateShard& shard : rate_data->shards)
+    {
+        // NOTE: the times are written before the count, so they are set if there is any data
+        const uint64_t shard_data_received = shard.data_received.load(std::memory_order_acquire);
+        if (shard_data_received == 0)
+        {
+            continue;
+        }
+
+        data_received += shard_data_received;
+        first_data_time = std::min(first_data_time, shard.first_data_time.load(std::memory_order_relaxed));
+        last_data_time = std::max(last_data_time, shard.last_data_time.load(std::memory_order_relaxed));
+    }
+
+    if (data_received == 0)
     {
         return 0;
     }
 
     // If there is only one data (or in a special case) first and last could be the same and produce a 0 division
-    float seconds_elapsed = data.last_data_time.seconds() - data.first_data_time.seconds();
+    float seconds_elapsed = static_cast<float>(static_cast<double>(last_data_time - first_data_time) / 1e9);
     if (seconds_elapsed == 0)
     {
         // If not enough data to set the rate, return invalid value
         return std::numeric_limits<float>::infinity();
     }
 
-    return static_cast<float>(data.data_received) / seconds_elapsed;
+    return static_cast<float>(data_received) / seconds_elapsed;
+}
+
+void TopicRateCalculator::set_rate_window(
+        std::chrono::milliseconds window) noexcept
+{
+    rate_window_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(window).count(), std::memory_order_relaxed);
+}
+
+TopicRateCalculator::TopicTraffic TopicRateCalculator::get_topic_traffic(
+        const ddspipe::core::types::DdsTopic& topic) const
+{
+    TopicTraffic result;
+
+    std::shared_lock<RateByTopicMapType> _(data_by_topic_);
+
+    const DataRateInfo* rate_data = get_data_rate_from_topic_nts_(topic);
+    if (!rate_data)
+    {
+        return result;
+    }
+
+    const int64_t now = rate_window_end_(*rate_data);
+    const int64_t window = rate_window_.load(std::memory_order_relaxed);
+
+    result.topic.bandwidth = topic_bandwidth_(*rate_data);
+    result.topic.payload_size = rate_data->shards[0].payload_size.snapshot();
+    for (std::size_t i = 1; i < SHARDS; ++i)
+    {
+        result.topic.payload_size.merge(rate_data->shards[i].payload_size.snapshot());
+    }
+
+    std::array<const RateWindow*, SHARDS> bytes_windows;
+    std::shared_lock<std::shared_timed_mutex> writers_lock(rate_data->writers_mutex);
+    for (const auto& writer : rate_data->writers)
+    {
+        const WriterDataInfo& writer_data = *writer.second;
+        for (std::size_t i = 0; i < SHARDS; ++i)
+        {
+            bytes_windows[i] = &writer_data.shards[i].bytes_window;
+        }
+
+        TopicTraffic::Traffic& traffic = result.writers[writer.first];
+        traffic.bandwidth = static_cast<RateType>(RateWindow::rate(
+                    bytes_windows.data(), bytes_windows.size(), now, window));
+        traffic.payload_size = writer_data.shards[0].payload_size.snapshot();
+        for (std::size_t i = 1; i < SHARDS; ++i)
+        {
+            traffic.payload_size.merge(writer_data.shards[i].payload_size.snapshot());
+        }
+    }
+
+    return result;
+}
+
+TopicRateCalculator::TopicLatency TopicRateCalculator::get_topic_latency(
+        const ddspipe::core::types::DdsTopic& topic) const
+{
+    TopicLatency result;
+
+    std::shared_lock<RateByTopicMapType> _(data_by_topic_);
+
+    const DataRateInfo* rate_data = get_data_rate_from_topic_nts_(topic);
+    if (!rate_data)
+    {
+        return result;
+    }
+
+    result.topic = rate_data->shards[0].latency.snapshot();
+    for (std::size_t i = 1; i < SHARDS; ++i)
+    {
+        result.topic.merge(rate_data->shards[i].latency.snapshot());
+    }
+
+    std::shared_lock<std::shared_timed_mutex> writers_lock(rate_data->writers_mutex);
+    for (const auto& writer : rate_data->writers)
+    {
+        LatencyHistogram::Snapshot latency = writer.second->latency.snapshot();
+
+        // Writers whose data was not live have no latency
+        if (latency.count > 0)
+        {
+            result.writers.emplace(writer.first, std::move(latency));
+        }
+    }
+
+    return result;
+}
+
+std::map<ddspipe::core::types::Guid, SequenceTracker::Snapshot> TopicRateCalculator::get_topic_samples(
+        const ddspipe::core::types::DdsTopic& topic) const
+{
+    std::map<ddspipe::core::types::Guid, SequenceTracker::Snapshot> result;
+
+    std::shared_lock<RateByTopicMapType> _(data_by_topic_);
+
+    const DataRateInfo* rate_data = get_data_rate_from_topic_nts_(topic);
+    if (!rate_data)
+    {
+        return result;
+    }
+
+    const int64_t now = rate_window_end_(*rate_data);
+    const int64_t window = rate_window_.load(std::memory_order_relaxed);
+
+    std::shared_lock<std::shared_timed_mutex> writers_lock(rate_data->writers_mutex);
+    for (const auto& writer : rate_data->writers)
+    {
+        result.emplace(writer.first, writer.second->sequence.snapshot(now, window));
+    }
+
+    return result;
+}
+
+SequenceTracker::Snapshot TopicRateCalculator::get_writer_samples(
+        const ddspipe::core::types::Guid& writer) const
+{
+    std::shared_lock<RateByTopicMapType> _(data_by_topic_);
+
+    // A writer has a single topic, but it is not known here
+    for (const auto& topic_data : data_by_topic_)
+    {
+        const DataRateInfo& rate_data = topic_data.second;
+
+        std::shared_lock<std::shared_timed_mutex> writers_lock(rate_data.writers_mutex);
+        auto it = rate_data.writers.find(writer);
+        if (it != rate_data.writers.end())
+        {
+            return it->second->sequence.snapshot(
+                rate_window_end_(rate_data), rate_window_.load(std::memory_order_relaxed));
+        }
+    }
+
+    return SequenceTracker::Snapshot();
+}
+
+void TopicRateCalculator::set_live(
+        bool live) noexcept
+{
+    live_.store(live, std::memory_order_relaxed);
+}
+
+bool TopicRateCalculator::live() const noexcept
+{
+    return live_.load(std::memory_order_relaxed);
+}
+
+void TopicRateCalculator::add_data_(
+        DataRateInfo& rate_data,
+        const ddspipe::core::types::RtpsPayloadData& data)
+{
+    const int64_t data_time = data.source_timestamp.to_ns();
+
+    // NOTE: the counters of the shard are shared only if there are more threads than shards
+    const std::size_t shard_index = thread_number() % SHARDS;
+    RateShard& shard = rate_data.shards[shard_index];
+
+    // If is first data, set initial time
+    int64_t unset_time = RateShard::UNSET_TIME;
+    shard.first_data_time.compare_exchange_strong(unset_time, data_time, std::memory_order_relaxed);
+
+    // Set reception time
+    shard.last_data_time.store(data_time, std::memory_order_relaxed);
+
+    // Increase in 1 the number of data received, publishing the times above
+    shard.data_received.fetch_add(1, std::memory_order_release);
+
+    const bool live_data = live();
+    const int64_t time = live_data ? steady_time_ns() : data_time;
+    const int64_t window = rate_window_.load(std::memory_order_relaxed);
+
+    // NOTE: fragmented data is added once reassembled, so its length is the one of the whole payload
+    const uint32_t size = data.payload.length;
+
+    shard.window.add(time, window);
+    shard.bytes_window.add(time, window, size);
+    shard.payload_size.add(size);
+
+    // Data usually comes from the same writer as the previous one, so the writers are only looked up on a change
+    WriterDataInfo* writer_data = shard.last_writer.load(std::memory_order_acquire);
+    if (!writer_data || !(writer_data->guid == data.source_guid))
+    {
+        writer_data = &get_or_create_writer_data_(rate_data, data.source_guid);
+        shard.last_writer.store(writer_data, std::memory_order_release);
+    }
+
+    WriterShard& writer_shard = writer_data->shards[shard_index];
+    writer_shard.bytes_window.add(time, window, size);
+    writer_shard.payload_size.add(size);
+
+    // NOTE: data without a sequence number (e.g. read from a file that did not record it) cannot be checked
+    if (data.origin_sequence_number > fastdds::rtps::SequenceNumber_t())
+    {
+        writer_data->sequence.add(data.origin_sequence_number.to64long(), time, window, data_time, live_data);
+    }
+
+    if (live_data)
+    {
+        // NOTE: source timestamps are taken from the system clock of the writer
+        const int64_t reception_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        const int64_t latency = reception_time - data_time;
+
+        shard.latency.add(latency);
+        writer_data->latency.add(latency);
+    }
+}
+
+TopicRateCalculator::WriterDataInfo& TopicRateCalculator::get_or_create_writer_data_(
+        DataRateInfo& rate_data,
+        const ddspipe::core::types::Guid& writer)
+{
+    {
+        std::shared_lock<std::shared_timed_mutex> _(rate_data.writers_mutex);
+        auto it = rate_data.writers.find(writer);
+        if (it != rate_data.writers.end())
+        {
+            return *it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_timed_mutex> _(rate_data.writers_mutex);
+    auto& writer_data = rate_data.writers[writer];
+    if (!writer_data)
+    {
+        writer_data = std::make_unique<WriterDataInfo>(writer);
+    }
+    return *writer_data;
+}
+
+TopicRateCalculator::RateType TopicRateCalculator::topic_rate_(
+        const DataRateInfo& rate_data) const noexcept
+{
+    std::array<const RateWindow*, SHARDS> windows;
+    for (std::size_t i = 0; i < SHARDS; ++i)
+    {
+        windows[i] = &rate_data.shards[i].window;
+    }
+
+    return static_cast<RateType>(RateWindow::rate(
+               windows.data(), windows.size(), rate_window_end_(rate_data),
+               rate_window_.load(std::memory_order_relaxed)));
+}
+
+TopicRateCalculator::RateType TopicRateCalculator::topic_bandwidth_(
+        const DataRateInfo& rate_data) const noexcept
+{
+    std::array<const RateWindow*, SHARDS> bytes_windows;
+    for (std::size_t i = 0; i < SHARDS; ++i)
+    {
+        bytes_windows[i] = &rate_data.shards[i].bytes_window;
+    }
+
+    return static_cast<RateType>(RateWindow::rate(
+               bytes_windows.data(), bytes_windows.size(), rate_window_end_(rate_data),
+               rate_window_.load(std::memory_order_relaxed)));
+}
+
+int64_t TopicRateCalculator::rate_time_(
+        const ddspipe::core::types::RtpsPayloadData& data) const noexcept
+{
+    return live() ? steady_time_ns() : data.source_timestamp.to_ns();
+}
+
+int64_t TopicRateCalculator::rate_window_end_(
+        const DataRateInfo& rate_data) const noexcept
+{
+    if (live())
+    {
+        return steady_time_ns();
+    }
+
+    int64_t last_data_time = RateShard::UNSET_TIME;
+    for (const RateShard& shard : rate_data.shards)
+    {
+        last_data_time = std::max(last_data_time, shard.last_data_time.load(std::memory_order_relaxed));
+    }
+    return last_data_time;
 }
 
 TopicRateCalculator::DataRateInfo& TopicRateCalculator::get_or_create_data_rate_from_topic_nts_(
@@ -70,17 +412,26 @@ TopicRateCalculator::DataRateInfo& TopicRateCalculator::get_or_create_data_rate_
     return data_by_topic_[topic];
 }
 
-bool TopicRateCalculator::get_data_rate_from_topic_nts_(
-        const ddspipe::core::types::DdsTopic& topic,
-        TopicRateCalculator::DataRateInfo& data) const noexcept
+const TopicRateCalculator::DataRateInfo* TopicRateCalculator::get_data_rate_from_topic_nts_(
+        const ddspipe::core::types::DdsTopic& topic) const noexcept
+{
+    auto it = data_by_topic_.find(topic);
+    if (it == data_by_topic_.end())
+    {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+TopicRateCalculator::DataRateInfo* TopicRateCalculator::get_data_rate_from_topic_nts_(
+        const ddspipe::core::types::DdsTopic& topic) noexcept
 {
     auto it = data_by_topic_.find(topic);
-    if (data_by_topic_.find(topic) == data_by_topic_.end())
+    if (it == data_by_topic_.end())
     {
-        return false;
+        return nullptr;
     }
-    data = it->second;
-    return true;
+    return &it->second;
 }
 
 } /* namespace participants */
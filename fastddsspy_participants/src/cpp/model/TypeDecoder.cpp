@@ -0,0 +1,163 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+
+#include <cpp_utils/Log.hpp>
+
+#include <fastddsspy_participants/cdr/TypeLayoutBuilder.hpp>
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+constexpr std::size_t TypeDecoder::MAX_POOLED_DATA;
+
+TypeDecoder::DataLoan::DataLoan(
+        std::shared_ptr<TypeDecoder> decoder,
+        fastdds::dds::DynamicData::_ref_type data)
+    : decoder_(std::move(decoder))
+    , data_(std::move(data))
+{
+    // Do nothing
+}
+
+TypeDecoder::DataLoan& TypeDecoder::DataLoan::operator =(
+        DataLoan&& other)
+{
+    if (this != &other)
+    {
+        release_();
+        decoder_ = std::move(other.decoder_);
+        data_ = std::move(other.data_);
+    }
+    return *this;
+}
+
+TypeDecoder::DataLoan::~DataLoan()
+{
+    release_();
+}
+
+void TypeDecoder::DataLoan::release_() noexcept
+{
+    if (decoder_ && data_)
+    {
+        decoder_->return_data_(std::move(data_));
+    }
+    data_.reset();
+    decoder_.reset();
+}
+
+TypeDecoder::TypeDecoder(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        const fastdds::dds::xtypes::TypeIdentifier& type_identifier /* = TypeIdentifier() */)
+    : dyn_type_(dyn_type)
+    , type_identifier_(type_identifier)
+    , pubsub_type_(dyn_type)
+    , layout_(cdr::TypeLayoutBuilder::build(dyn_type))
+{
+    // Do nothing
+}
+
+const fastdds::dds::DynamicType::_ref_type& TypeDecoder::type() const noexcept
+{
+    return dyn_type_;
+}
+
+const fastdds::dds::xtypes::TypeIdentifier& TypeDecoder::type_identifier() const noexcept
+{
+    return type_identifier_;
+}
+
+const std::shared_ptr<const cdr::TypeLayout>& TypeDecoder::layout() const noexcept
+{
+    return layout_;
+}
+
+TypeDecoder::DataLoan TypeDecoder::loan()
+{
+    fastdds::dds::DynamicData::_ref_type data;
+
+    {
+        std::lock_guard<std::mutex> _(pool_mutex_);
+        if (!pool_.empty())
+        {
+            data = std::move(pool_.back());
+            pool_.pop_back();
+        }
+    }
+
+    if (!data)
+    {
+        data = fastdds::dds::DynamicDataFactory::get_instance()->create_data(dyn_type_);
+    }
+
+    return DataLoan(shared_from_this(), std::move(data));
+}
+
+TypeDecoder::DataLoan TypeDecoder::deserialize(
+        const ddspipe::core::types::RtpsPayloadData& data)
+{
+    DataLoan dyn_data = loan();
+    if (!dyn_data)
+    {
+        return dyn_data;
+    }
+
+    // NOTE: deserialize does not modify the payload, but the Fast DDS API does not take it as const
+    auto& payload = const_cast<ddspipe::core::types::RtpsPayloadData&>(data).payload;
+    auto data_ref = dyn_data.get();
+
+    bool deserialized = false;
+    try
+    {
+        deserialized = pubsub_type_.deserialize(payload, &data_ref);
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_TYPEDECODER,
+                "Exception deserializing payload of type " << dyn_type_->get_name().to_string() << ": " << e.what());
+    }
+
+    if (!deserialized)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_TYPEDECODER,
+                "Failed to deserialize payload of type " << dyn_type_->get_name().to_string() << ".");
+        return DataLoan();
+    }
+
+    return dyn_data;
+}
+
+void TypeDecoder::return_data_(
+        fastdds::dds::DynamicData::_ref_type&& data) noexcept
+{
+    // Leave no value from the previous sample (e.g. optional members absent in the next one)
+    if (fastdds::dds::RETCODE_OK != data->clear_all_values())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> _(pool_mutex_);
+    if (pool_.size() < MAX_POOLED_DATA)
+    {
+        pool_.push_back(std::move(data));
+    }
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,63 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+
+#include <fastddsspy_participants/model/payload_utils.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+std::shared_ptr<ddspipe::core::types::RtpsPayloadData> retain_payload_data(
+        const ddspipe::core::types::RtpsPayloadData& data)
+{
+    auto retained = std::make_shared<ddspipe::core::types::RtpsPayloadData>();
+    retain_payload_data(data, *retained);
+    return retained;
+}
+
+void retain_payload_data(
+        const ddspipe::core::types::RtpsPayloadData& data,
+        ddspipe::core::types::RtpsPayloadData& retained)
+{
+    retained.kind = data.kind;
+    retained.instanceHandle = data.instanceHandle;
+    retained.source_timestamp = data.source_timestamp;
+    retained.source_guid = data.source_guid;
+    retained.participant_receiver = data.participant_receiver;
+    retained.origin_sequence_number = data.origin_sequence_number;
+    retained.write_params = data.write_params;
+
+    if (data.payload_owner != nullptr &&
+            data.payload_owner->get_payload(data.payload, retained.payload))
+    {
+        // Payload is shared with the pool, which will release it once every reference is gone
+        retained.payload_owner = data.payload_owner;
+    }
+    else
+    {
+        retained.payload.reserve(data.payload.length);
+        if (data.payload.length > 0)
+        {
+            std::memcpy(retained.payload.data, data.payload.data, data.payload.length);
+        }
+        retained.payload.length = data.payload.length;
+        retained.payload.encapsulation = data.payload.encapsulation;
+    }
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <ddspipe_core/types/data/RtpsPayloadData.hpp>
+#include <ddspipe_core/types/dynamic_types/types.hpp>
+#include <ddspipe_core/types/topic/dds/DdsTopic.hpp>
 #include <ddspipe_participants/participant/rtps/CommonParticipant.hpp>
 
 #include <fastddsspy_participants/participant/SpyParticipant.hpp>
@@ -61,12 +64,42 @@ std::shared_ptr<ddspipe::core::IWriter> SpyParticipant::create_writer(
     {
         return endpoints_writer_;
     }
+    else if (ddspipe::core::types::is_type_object_topic(topic))
+    {
+        return ddspipe::participants::SchemaParticipant::create_writer(topic);
+    }
+    else if (const auto* dds_topic = dynamic_cast<const ddspipe::core::types::DdsTopic*>(&topic))
+    {
+        return create_data_writer_(*dds_topic);
+    }
     else
     {
         return ddspipe::participants::SchemaParticipant::create_writer(topic);
     }
 }
 
+std::shared_ptr<ddspipe::core::IWriter> SpyParticipant::create_data_writer_(
+        const ddspipe::core::types::DdsTopic& topic)
+{
+    // The topic is resolved once for the writer, and released along with it
+    auto model = model_;
+    auto handle = model->acquire_topic_handle(topic);
+    std::shared_ptr<DataStreamer::TopicHandle> writer_handle(
+        handle.get(),
+        [model, handle](DataStreamer::TopicHandle*)
+        {
+            model->release_topic_handle(handle);
+        });
+
+    auto data_callback = [model, writer_handle](ddspipe::core::IRoutingData& data)
+            {
+                model->add_data(*writer_handle, dynamic_cast<ddspipe::core::types::RtpsPayloadData&>(data));
+                return utils::ReturnCode::RETCODE_OK;
+            };
+
+    return std::make_shared<ddspipe::participants::InternalWriter>(id(), data_callback);
+}
+
 utils::ReturnCode SpyParticipant::new_participant_info_(
         const ddspipe::core::IRoutingData& data)
 {
@@ -0,0 +1,179 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <vector>
+
+#include <cpp_utils/Log.hpp>
+
+#include <fastddsspy_participants/recording/DataRecorder.hpp>
+#include <fastddsspy_participants/recording/type_serialization.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+namespace {
+
+//! Append \c value to \c body as it is written in the record files
+void append_string(
+        const std::string& value,
+        std::string& body)
+{
+    const uint32_t size = static_cast<uint32_t>(value.size());
+    body.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    body.append(value);
+}
+
+} /* namespace */
+
+DataRecorder::DataRecorder(
+        std::size_t segment_size /* = RecordWriter::DEFAULT_SEGMENT_SIZE */)
+    : writer_(segment_size)
+{
+    // Do nothing
+}
+
+bool DataRecorder::open(
+        const std::string& file_name)
+{
+    std::lock_guard<std::mutex> _(mutex_);
+
+    topic_ids_.clear();
+    types_.clear();
+    samples_ = 0;
+
+    return writer_.open(file_name);
+}
+
+void DataRecorder::close()
+{
+    std::lock_guard<std::mutex> _(mutex_);
+    writer_.close();
+}
+
+void DataRecorder::record(
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<TypeDecoder>& decoder,
+        const ddspipe::core::types::RtpsPayloadData& data)
+{
+    if (!decoder)
+    {
+        return;
+    }
+
+    SampleRecordHeader header {};
+    header.change_kind = static_cast<uint8_t>(data.kind);
+    std::memcpy(header.writer_guid, data.source_guid.guidPrefix.value, 12);
+    std::memcpy(header.writer_guid + 12, data.source_guid.entityId.value, 4);
+    for (std::size_t i = 0; i < sizeof(header.instance_handle); ++i)
+    {
+        header.instance_handle[i] = data.instanceHandle.value[i];
+    }
+    header.source_timestamp = data.source_timestamp.to_ns();
+    header.sequence_number = static_cast<uint64_t>(data.origin_sequence_number.to64long());
+
+    std::lock_guard<std::mutex> _(mutex_);
+
+    if (!writer_.is_open() || !topic_id_nts_(topic, *decoder, header.topic_id))
+    {
+        return;
+    }
+
+    // NOTE: the payload is copied as received, encapsulation included
+    if (writer_.append(RecordKind::sample, {{&header, sizeof(header)}, {data.payload.data, data.payload.length}}))
+    {
+        ++samples_;
+    }
+}
+
+uint64_t DataRecorder::samples() const noexcept
+{
+    std::lock_guard<std::mutex> _(mutex_);
+    return samples_;
+}
+
+uint64_t DataRecorder::size() const noexcept
+{
+    std::lock_guard<std::mutex> _(mutex_);
+    return writer_.size();
+}
+
+bool DataRecorder::topic_id_nts_(
+        const ddspipe::core::types::DdsTopic& topic,
+        const TypeDecoder& decoder,
+        uint32_t& topic_id)
+{
+    const auto key = std::make_pair(topic.m_topic_name, topic.type_name);
+    auto it = topic_ids_.find(key);
+    if (it != topic_ids_.end())
+    {
+        topic_id = it->second;
+        return true;
+    }
+
+    if (types_.count(topic.type_name) == 0)
+    {
+        if (!write_type_nts_(decoder))
+        {
+            return false;
+        }
+        types_.insert(topic.type_name);
+    }
+
+    topic_id = static_cast<uint32_t>(topic_ids_.size());
+
+    std::string body;
+    body.append(reinterpret_cast<const char*>(&topic_id), sizeof(topic_id));
+    append_string(topic.m_topic_name, body);
+    append_string(topic.type_name, body);
+
+    if (!writer_.append(RecordKind::topic, {{body.data(), body.size()}}))
+    {
+        return false;
+    }
+
+    topic_ids_.emplace(key, topic_id);
+    return true;
+}
+
+bool DataRecorder::write_type_nts_(
+        const TypeDecoder& decoder)
+{
+    const std::string type_name = decoder.type()->get_name().to_string();
+
+    std::vector<std::string> type_objects;
+    if (!serialize_type_objects(decoder.type_identifier(), type_objects))
+    {
+        // NOTE: the samples are recorded anyway, but the type must be known to read them
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "Type objects of type " << type_name << " are not available, it is recorded without them.");
+        type_objects.clear();
+    }
+
+    std::string body;
+    append_string(type_name, body);
+    const uint32_t count = static_cast<uint32_t>(type_objects.size());
+    body.append(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (const auto& type_object : type_objects)
+    {
+        append_string(type_object, body);
+    }
+
+    return writer_.append(RecordKind::type, {{body.data(), body.size()}});
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
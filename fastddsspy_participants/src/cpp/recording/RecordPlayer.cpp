@@ -0,0 +1,342 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include <fastdds/rtps/common/ChangeKind_t.hpp>
+#include <fastdds/rtps/common/SequenceNumber.hpp>
+#include <fastdds/rtps/common/SerializedPayload.hpp>
+
+#include <cpp_utils/Log.hpp>
+
+#include <fastddsspy_participants/recording/RecordPlayer.hpp>
+#include <fastddsspy_participants/recording/type_serialization.hpp>
+#include <fastddsspy_participants/types/EndpointInfo.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+RecordPlayer::RecordPlayer(
+        const std::shared_ptr<SpyModel>& model)
+    : model_(model)
+{
+    // Do nothing
+}
+
+bool RecordPlayer::load(
+        const std::string& file_name,
+        unsigned int n_threads /* = 1 */)
+{
+    topics_.clear();
+    topics_by_id_.clear();
+    samples_.clear();
+
+    if (!reader_.open(file_name))
+    {
+        return false;
+    }
+
+    read_records_();
+    add_writers_();
+    add_samples_(n_threads);
+
+    EPROSIMA_LOG_INFO(FASTDDSSPY_RECORDING,
+            "Loaded " << samples_.size() << " samples of " << topics_.size() << " topics from " << file_name << ".");
+
+    return true;
+}
+
+uint64_t RecordPlayer::replay(
+        const ddspipe::core::types::WildcardDdsFilterTopic& filter,
+        const DataStreamer::CallbackType& callback,
+        const std::shared_ptr<SampleThrottle>& throttle /* = nullptr */) const
+{
+    return replay_(false, filter, callback, throttle);
+}
+
+uint64_t RecordPlayer::replay_all(
+        const DataStreamer::CallbackType& callback,
+        const std::shared_ptr<SampleThrottle>& throttle /* = nullptr */) const
+{
+    return replay_(true, ddspipe::core::types::WildcardDdsFilterTopic(), callback, throttle);
+}
+
+uint64_t RecordPlayer::samples() const noexcept
+{
+    return samples_.size();
+}
+
+void RecordPlayer::read_records_()
+{
+    RecordReader::Record record;
+    while (reader_.next(record))
+    {
+        switch (record.kind)
+        {
+            case RecordKind::type:
+                add_type_(record);
+                break;
+
+            case RecordKind::topic:
+                add_topic_(record);
+                break;
+
+            case RecordKind::sample:
+                add_sample_(record);
+                break;
+
+            default:
+                // Records of later versions of the format are skipped
+                break;
+        }
+    }
+}
+
+void RecordPlayer::add_type_(
+        const RecordReader::Record& record)
+{
+    RecordReader::TypeRecord type;
+    if (!RecordReader::read_type(record, type))
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING, "Skipping malformed type record.");
+        return;
+    }
+
+    if (type.type_objects.empty())
+    {
+        // NOTE: the samples of this type are counted, but cannot be decoded, as when its type is not discovered
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "Type " << type.type_name << " was recorded without type objects, its data cannot be decoded.");
+        return;
+    }
+
+    fastdds::dds::xtypes::TypeIdentifier type_identifier;
+    const auto dynamic_type = deserialize_type_objects(type.type_objects, type_identifier);
+    if (!dynamic_type)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "Type " << type.type_name << " could not be built from its type objects.");
+        return;
+    }
+
+    model_->add_schema(dynamic_type, type_identifier);
+}
+
+void RecordPlayer::add_topic_(
+        const RecordReader::Record& record)
+{
+    RecordReader::TopicRecord topic_record;
+    if (!RecordReader::read_topic(record, topic_record))
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING, "Skipping malformed topic record.");
+        return;
+    }
+
+    auto topic = std::make_unique<RecordedTopic>();
+    topic->topic.m_topic_name = topic_record.topic_name;
+    topic->topic.type_name = topic_record.type_name;
+
+    topics_by_id_[topic_record.topic_id] = topic.get();
+    topics_.push_back(std::move(topic));
+}
+
+void RecordPlayer::add_sample_(
+        const RecordReader::Record& record)
+{
+    RecordReader::SampleRecord sample;
+    if (!RecordReader::read_sample(record, sample))
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING, "Skipping malformed sample record.");
+        return;
+    }
+
+    auto it = topics_by_id_.find(sample.header.topic_id);
+    if (it == topics_by_id_.end())
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "Skipping sample of unknown topic id " << sample.header.topic_id << ".");
+        return;
+    }
+
+    ddspipe::core::types::Guid writer_guid;
+    std::memcpy(writer_guid.guidPrefix.value, sample.header.writer_guid, 12);
+    std::memcpy(writer_guid.entityId.value, sample.header.writer_guid + 12, 4);
+    it->second->writers.insert(writer_guid);
+
+    it->second->samples.push_back(samples_.size());
+    samples_.push_back(record);
+}
+
+void RecordPlayer::add_writers_()
+{
+    for (const auto& topic : topics_)
+    {
+        for (const auto& writer_guid : topic->writers)
+        {
+            EndpointInfoData endpoint;
+            endpoint.info.kind = ddspipe::core::types::EndpointKind::writer;
+            endpoint.info.guid = writer_guid;
+            endpoint.info.topic = topic->topic;
+            endpoint.info.active = true;
+
+            model_->endpoint_database_.add_or_modify(ddspipe::core::types::Guid(writer_guid), std::move(endpoint));
+            model_->on_writer_discovered(writer_guid, topic->topic.m_topic_name, true);
+        }
+    }
+}
+
+void RecordPlayer::add_samples_(
+        unsigned int n_threads)
+{
+    // Topics with more samples first, so that no thread is left with a long topic at the end
+    std::vector<RecordedTopic*> topics;
+    topics.reserve(topics_.size());
+    for (const auto& topic : topics_)
+    {
+        topics.push_back(topic.get());
+    }
+    std::sort(topics.begin(), topics.end(), [](
+                const RecordedTopic* lhs,
+                const RecordedTopic* rhs)
+            {
+                return lhs->samples.size() > rhs->samples.size();
+            });
+
+    std::atomic<std::size_t> next_topic {0};
+    auto add_topics = [this, &topics, &next_topic]()
+            {
+                // NOTE: the samples of a topic are added by a single thread, in the order they were recorded
+                ddspipe::core::types::RtpsPayloadData data;
+                RecordReader::SampleRecord sample;
+                for (std::size_t i = next_topic.fetch_add(1); i < topics.size(); i = next_topic.fetch_add(1))
+                {
+                    // The topic is resolved once for all its samples
+                    const auto handle = model_->acquire_topic_handle(topics[i]->topic);
+                    for (const auto sample_index : topics[i]->samples)
+                    {
+                        RecordReader::read_sample(samples_[sample_index], sample);
+                        fill_data_(sample, data);
+                        model_->add_data(*handle, data);
+                    }
+                    model_->release_topic_handle(handle);
+                }
+            };
+
+    const std::size_t n_workers = std::min<std::size_t>(std::max(n_threads, 1u), topics.size());
+    std::vector<std::thread> workers;
+    for (std::size_t i = 1; i < n_workers; ++i)
+    {
+        workers.emplace_back(add_topics);
+    }
+
+    add_topics();
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+uint64_t RecordPlayer::replay_(
+        bool all,
+        const ddspipe::core::types::WildcardDdsFilterTopic& filter,
+        const DataStreamer::CallbackType& callback,
+        const std::shared_ptr<SampleThrottle>& throttle) const
+{
+    // Decoder of each topic replayed, the topics left out have none
+    std::map<uint32_t, std::shared_ptr<TypeDecoder>> decoders;
+    for (const auto& topic : topics_by_id_)
+    {
+        if (all || filter.matches(topic.second->topic))
+        {
+            decoders[topic.first] = model_->get_type_decoder(topic.second->topic.type_name);
+        }
+    }
+
+    uint64_t replayed = 0;
+    ddspipe::core::types::RtpsPayloadData data;
+    RecordReader::SampleRecord sample;
+    for (const auto& record : samples_)
+    {
+        RecordReader::read_sample(record, sample);
+
+        auto it = decoders.find(sample.header.topic_id);
+        if (it == decoders.end() || !it->second)
+        {
+            continue;
+        }
+
+        const auto& topic = topics_by_id_.at(sample.header.topic_id)->topic;
+
+        // The limits apply to the time the samples were sent, not to the time they are replayed
+        if (throttle &&
+                !throttle->accept(topic.m_topic_name,
+                std::chrono::steady_clock::time_point(std::chrono::nanoseconds(sample.header.source_timestamp))))
+        {
+            continue;
+        }
+
+        fill_data_(sample, data);
+        callback(topic, it->second, data);
+        ++replayed;
+    }
+
+    return replayed;
+}
+
+void RecordPlayer::fill_data_(
+        const RecordReader::SampleRecord& sample,
+        ddspipe::core::types::RtpsPayloadData& data)
+{
+    data.kind = static_cast<fastdds::rtps::ChangeKind_t>(sample.header.change_kind);
+    std::memcpy(data.source_guid.guidPrefix.value, sample.header.writer_guid, 12);
+    std::memcpy(data.source_guid.entityId.value, sample.header.writer_guid + 12, 4);
+    data.source_timestamp.from_ns(sample.header.source_timestamp);
+    data.origin_sequence_number = fastdds::rtps::SequenceNumber_t(sample.header.sequence_number);
+
+    // Samples of topics without key were recorded with an unset handle, which is all zeros
+    data.instanceHandle = ddspipe::core::types::InstanceHandle();
+    const uint8_t* handle_end = sample.header.instance_handle + sizeof(sample.header.instance_handle);
+    if (std::any_of(sample.header.instance_handle, handle_end, [](uint8_t byte)
+            {
+                return byte != 0;
+            }))
+    {
+        for (std::size_t i = 0; i < sizeof(sample.header.instance_handle); ++i)
+        {
+            data.instanceHandle.value[i] = sample.header.instance_handle[i];
+        }
+    }
+
+    // NOTE: the payload is copied so that it is aligned as the decoders expect
+    if (data.payload.max_size < sample.payload_size)
+    {
+        data.payload.reserve(sample.payload_size);
+    }
+    if (sample.payload_size > 0)
+    {
+        std::memcpy(data.payload.data, sample.payload, sample.payload_size);
+    }
+    data.payload.length = sample.payload_size;
+    data.payload.encapsulation = (sample.payload_size > 1 && (sample.payload[1] & 0x01)) ? CDR_LE : CDR_BE;
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
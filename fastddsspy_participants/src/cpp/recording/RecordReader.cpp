@@ -0,0 +1,282 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // if defined(_WIN32)
+
+#include <cpp_utils/Log.hpp>
+
+#include <fastddsspy_participants/recording/RecordReader.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+namespace {
+
+bool is_little_endian() noexcept
+{
+    const uint16_t value = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &value, 1);
+    return first_byte == 1;
+}
+
+//! Read a value of type \c T at \c position and advance it
+template<typename T>
+bool read_value(
+        const char*& position,
+        const char* end,
+        T& value) noexcept
+{
+    if (static_cast<std::size_t>(end - position) < sizeof(T))
+    {
+        return false;
+    }
+    std::memcpy(&value, position, sizeof(T));
+    position += sizeof(T);
+    return true;
+}
+
+//! Read a string at \c position and advance it
+bool read_string(
+        const char*& position,
+        const char* end,
+        std::string& value)
+{
+    uint32_t size;
+    if (!read_value(position, end, size) || static_cast<std::size_t>(end - position) < size)
+    {
+        return false;
+    }
+    value.assign(position, size);
+    position += size;
+    return true;
+}
+
+} /* namespace */
+
+RecordReader::~RecordReader()
+{
+    close();
+}
+
+bool RecordReader::open(
+        const std::string& file_name)
+{
+    close();
+
+#if defined(_WIN32)
+    std::ifstream file(file_name, std::ios::binary);
+    if (!file)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "Could not open record file " << file_name << ".");
+        return false;
+    }
+    buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#else
+    const int fd = ::open(file_name.c_str(), O_RDONLY);
+    struct stat file_stat;
+    if (fd < 0 || fstat(fd, &file_stat) != 0)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "Could not open record file " << file_name << ": " << std::strerror(errno));
+        if (fd >= 0)
+        {
+            ::close(fd);
+        }
+        return false;
+    }
+
+    size_ = static_cast<std::size_t>(file_stat.st_size);
+    if (size_ > 0)
+    {
+        // NOTE: the mapping outlives the file descriptor
+        mapping_ = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping_ == MAP_FAILED)
+        {
+            mapping_ = nullptr;
+            size_ = 0;
+        }
+        else
+        {
+            madvise(mapping_, size_, MADV_SEQUENTIAL);
+            data_ = static_cast<const char*>(mapping_);
+        }
+    }
+    ::close(fd);
+#endif // if defined(_WIN32)
+
+    RecordFileHeader header;
+    if (size_ < sizeof(header))
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "File " << file_name << " is not a record file.");
+        close();
+        return false;
+    }
+
+    std::memcpy(&header, data_, sizeof(header));
+    if (std::memcmp(header.magic, RECORD_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+            header.version != RECORD_FILE_VERSION ||
+            header.little_endian != (is_little_endian() ? 1 : 0))
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "File " << file_name << " is not a record file of version " << RECORD_FILE_VERSION
+                        << " written in the byte order of this host.");
+        close();
+        return false;
+    }
+
+    position_ = sizeof(header);
+    return true;
+}
+
+bool RecordReader::is_open() const noexcept
+{
+    return data_ != nullptr;
+}
+
+bool RecordReader::next(
+        Record& record) noexcept
+{
+    RecordHeader header;
+    if (!data_ || size_ - position_ < sizeof(header))
+    {
+        return false;
+    }
+
+    std::memcpy(&header, data_ + position_, sizeof(header));
+    const std::size_t record_size = record_aligned_size(sizeof(header) + header.size);
+    if (header.kind == RecordKind::end || size_ - position_ < sizeof(header) + header.size)
+    {
+        return false;
+    }
+
+    record.kind = header.kind;
+    record.body = data_ + position_ + sizeof(header);
+    record.size = header.size;
+
+    // NOTE: the padding of the last record may have been cut
+    position_ = std::min(size_, position_ + record_size);
+    return true;
+}
+
+void RecordReader::close()
+{
+#if defined(_WIN32)
+    buffer_.clear();
+    buffer_.shrink_to_fit();
+#else
+    if (mapping_)
+    {
+        munmap(mapping_, size_);
+        mapping_ = nullptr;
+    }
+#endif // if defined(_WIN32)
+
+    data_ = nullptr;
+    size_ = 0;
+    position_ = 0;
+}
+
+bool RecordReader::read_type(
+        const Record& record,
+        TypeRecord& type) noexcept
+{
+    const char* position = record.body;
+    const char* end = record.body + record.size;
+
+    try
+    {
+        uint32_t count;
+        if (record.kind != RecordKind::type ||
+                !read_string(position, end, type.type_name) ||
+                !read_value(position, end, count) ||
+                count > static_cast<std::size_t>(end - position) / sizeof(uint32_t))
+        {
+            return false;
+        }
+
+        type.type_objects.resize(count);
+        for (auto& type_object : type.type_objects)
+        {
+            if (!read_string(position, end, type_object))
+            {
+                return false;
+            }
+        }
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool RecordReader::read_topic(
+        const Record& record,
+        TopicRecord& topic) noexcept
+{
+    const char* position = record.body;
+    const char* end = record.body + record.size;
+
+    try
+    {
+        return record.kind == RecordKind::topic &&
+               read_value(position, end, topic.topic_id) &&
+               read_string(position, end, topic.topic_name) &&
+               read_string(position, end, topic.type_name);
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+}
+
+bool RecordReader::read_sample(
+        const Record& record,
+        SampleRecord& sample) noexcept
+{
+    const char* position = record.body;
+    const char* end = record.body + record.size;
+
+    if (record.kind != RecordKind::sample || !read_value(position, end, sample.header))
+    {
+        return false;
+    }
+
+    sample.payload = position;
+    sample.payload_size = static_cast<uint32_t>(end - position);
+    return true;
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,254 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#if defined(_WIN32)
+#include <stdio.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif // if defined(_WIN32)
+
+#include <cpp_utils/Log.hpp>
+
+#include <fastddsspy_participants/recording/RecordWriter.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+namespace {
+
+//! Zeros to pad the records with
+constexpr char PADDING[RECORD_ALIGNMENT] = {};
+
+bool is_little_endian() noexcept
+{
+    const uint16_t value = 1;
+    uint8_t first_byte;
+    std::memcpy(&first_byte, &value, 1);
+    return first_byte == 1;
+}
+
+} /* namespace */
+
+constexpr std::size_t RecordWriter::DEFAULT_SEGMENT_SIZE;
+
+RecordWriter::RecordWriter(
+        std::size_t segment_size /* = DEFAULT_SEGMENT_SIZE */)
+    : segment_size_(std::max<std::size_t>(segment_size, RECORD_ALIGNMENT))
+{
+    // Do nothing
+}
+
+RecordWriter::~RecordWriter()
+{
+    close();
+}
+
+bool RecordWriter::open(
+        const std::string& file_name)
+{
+    close();
+
+#if defined(_WIN32)
+    if (fopen_s(&file_, file_name.c_str(), "wb") != 0)
+    {
+        file_ = nullptr;
+    }
+    const bool opened = file_ != nullptr;
+#else
+    fd_ = ::open(file_name.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    const bool opened = fd_ >= 0;
+#endif // if defined(_WIN32)
+
+    if (!opened)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "Could not create record file " << file_name << ": " << std::strerror(errno));
+        return false;
+    }
+
+    size_ = 0;
+
+    RecordFileHeader header {};
+    std::memcpy(header.magic, RECORD_FILE_MAGIC, sizeof(header.magic));
+    header.version = RECORD_FILE_VERSION;
+    header.little_endian = is_little_endian() ? 1 : 0;
+
+    return write_(&header, sizeof(header));
+}
+
+bool RecordWriter::is_open() const noexcept
+{
+#if defined(_WIN32)
+    return file_ != nullptr;
+#else
+    return fd_ >= 0;
+#endif // if defined(_WIN32)
+}
+
+bool RecordWriter::append(
+        RecordKind kind,
+        std::initializer_list<Part> parts)
+{
+    RecordHeader header;
+    header.kind = kind;
+
+    std::size_t body_size = 0;
+    for (const auto& part : parts)
+    {
+        body_size += part.size;
+    }
+    header.size = static_cast<uint32_t>(body_size);
+
+    if (!reserve_(record_aligned_size(sizeof(header) + body_size)) ||
+            !write_(&header, sizeof(header)))
+    {
+        return false;
+    }
+
+    for (const auto& part : parts)
+    {
+        if (!write_(part.data, part.size))
+        {
+            return false;
+        }
+    }
+
+    return write_(PADDING, record_aligned_size(body_size) - body_size);
+}
+
+void RecordWriter::close()
+{
+    if (!is_open())
+    {
+        return;
+    }
+
+#if defined(_WIN32)
+    fclose(file_);
+    file_ = nullptr;
+#else
+    if (mapping_)
+    {
+        munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+    }
+
+    // Drop the rest of the last segment
+    if (ftruncate(fd_, static_cast<off_t>(size_)) != 0)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "Could not truncate record file: " << std::strerror(errno));
+    }
+
+    ::close(fd_);
+    fd_ = -1;
+#endif // if defined(_WIN32)
+}
+
+uint64_t RecordWriter::size() const noexcept
+{
+    return size_;
+}
+
+bool RecordWriter::write_(
+        const void* data,
+        std::size_t size)
+{
+    if (size == 0)
+    {
+        return true;
+    }
+
+    if (!reserve_(size))
+    {
+        return false;
+    }
+
+#if defined(_WIN32)
+    if (fwrite(data, 1, size, file_) != size)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "Could not write record file: " << std::strerror(errno));
+        close();
+        return false;
+    }
+#else
+    std::memcpy(mapping_ + (size_ - mapping_offset_), data, size);
+#endif // if defined(_WIN32)
+
+    size_ += size;
+    return true;
+}
+
+bool RecordWriter::reserve_(
+        std::size_t size)
+{
+    if (!is_open())
+    {
+        return false;
+    }
+
+#if !defined(_WIN32)
+    if (mapping_ && size_ + size <= mapping_offset_ + mapping_size_)
+    {
+        return true;
+    }
+
+    if (mapping_)
+    {
+        munmap(mapping_, mapping_size_);
+        mapping_ = nullptr;
+    }
+
+    // Map from the page of the end of the file, so that nothing written is mapped again
+    const uint64_t page_size = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    const uint64_t offset = size_ - size_ % page_size;
+    uint64_t mapping_size = std::max<uint64_t>(segment_size_, size_ - offset + size);
+    mapping_size = (mapping_size + page_size - 1) / page_size * page_size;
+
+    // NOTE: the space added to the file reads as zeros, which marks the end of the records if it is not truncated
+    void* mapping = MAP_FAILED;
+    if (ftruncate(fd_, static_cast<off_t>(offset + mapping_size)) == 0)
+    {
+        mapping = mmap(nullptr, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, static_cast<off_t>(offset));
+    }
+
+    if (mapping == MAP_FAILED)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "Could not map record file: " << std::strerror(errno));
+        close();
+        return false;
+    }
+
+    mapping_ = static_cast<char*>(mapping);
+    mapping_offset_ = offset;
+    mapping_size_ = static_cast<std::size_t>(mapping_size);
+#else
+    static_cast<void>(size);
+#endif // if !defined(_WIN32)
+
+    return true;
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
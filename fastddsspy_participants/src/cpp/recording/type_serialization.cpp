@@ -0,0 +1,185 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <unordered_set>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/CdrSizeCalculator.hpp>
+#include <fastcdr/FastBuffer.h>
+
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+#include <fastdds/dds/xtypes/type_representation/detail/dds_xtypes_typeobjectCdrAux.hpp>
+
+#include <cpp_utils/Log.hpp>
+
+#include <fastddsspy_participants/recording/type_serialization.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+namespace {
+
+//! Size of the encapsulation written before the type objects
+constexpr std::size_t ENCAPSULATION_SIZE = 4;
+
+void serialize_type_object(
+        const fastdds::dds::xtypes::TypeObject& type_object,
+        std::string& output)
+{
+    fastcdr::CdrSizeCalculator calculator(fastcdr::CdrVersion::XCDRv2);
+    std::size_t current_alignment {0};
+    output.resize(calculator.calculate_serialized_size(type_object, current_alignment) + ENCAPSULATION_SIZE);
+
+    fastcdr::FastBuffer buffer(&output[0], output.size());
+    fastcdr::Cdr cdr(buffer, fastcdr::Cdr::DEFAULT_ENDIAN, fastcdr::CdrVersion::XCDRv2);
+    cdr.serialize_encapsulation();
+    cdr << type_object;
+
+    output.resize(cdr.get_serialized_data_length());
+}
+
+void deserialize_type_object(
+        const std::string& input,
+        fastdds::dds::xtypes::TypeObject& type_object)
+{
+    // NOTE: FastBuffer does not modify the buffer when deserializing, but does not take it as const
+    fastcdr::FastBuffer buffer(const_cast<char*>(input.data()), input.size());
+    fastcdr::Cdr cdr(buffer, fastcdr::Cdr::DEFAULT_ENDIAN, fastcdr::CdrVersion::XCDRv2);
+    cdr.read_encapsulation();
+    cdr >> type_object;
+}
+
+} /* namespace */
+
+bool serialize_type_objects(
+        const fastdds::dds::xtypes::TypeIdentifier& type_identifier,
+        std::vector<std::string>& type_objects) noexcept
+{
+    auto& registry = fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry();
+
+    try
+    {
+        fastdds::dds::xtypes::TypeIdentifierSeq type_identifiers;
+        type_identifiers.push_back(type_identifier);
+        std::unordered_set<fastdds::dds::xtypes::TypeIdentfierWithSize> dependencies;
+        if (fastdds::dds::RETCODE_OK != registry.get_type_dependencies(type_identifiers, dependencies))
+        {
+            return false;
+        }
+
+        type_objects.clear();
+        type_objects.reserve(dependencies.size() + 1);
+
+        fastdds::dds::xtypes::TypeObject type_object;
+        for (const auto& dependency : dependencies)
+        {
+            if (fastdds::dds::RETCODE_OK != registry.get_type_object(dependency.type_id(), type_object))
+            {
+                return false;
+            }
+            type_objects.emplace_back();
+            serialize_type_object(type_object, type_objects.back());
+        }
+
+        if (fastdds::dds::RETCODE_OK != registry.get_type_object(type_identifier, type_object))
+        {
+            return false;
+        }
+        type_objects.emplace_back();
+        serialize_type_object(type_object, type_objects.back());
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "Exception serializing type objects: " << e.what());
+        return false;
+    }
+
+    return true;
+}
+
+fastdds::dds::DynamicType::_ref_type deserialize_type_objects(
+        const std::vector<std::string>& type_objects,
+        fastdds::dds::xtypes::TypeIdentifier& type_identifier) noexcept
+{
+    if (type_objects.empty())
+    {
+        return nullptr;
+    }
+
+    auto& registry = fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry();
+
+    try
+    {
+        std::vector<fastdds::dds::xtypes::TypeObject> objects(type_objects.size());
+        for (std::size_t i = 0; i < type_objects.size(); ++i)
+        {
+            deserialize_type_object(type_objects[i], objects[i]);
+        }
+
+        // A type object may only be registered once the types it refers to are known, so the dependencies are
+        // registered in as many rounds as needed
+        std::vector<bool> registered(objects.size() - 1, false);
+        std::size_t pending = registered.size();
+        while (pending > 0)
+        {
+            const std::size_t pending_before = pending;
+            for (std::size_t i = 0; i < registered.size(); ++i)
+            {
+                fastdds::dds::xtypes::TypeIdentifierPair type_identifiers;
+                if (!registered[i] &&
+                        fastdds::dds::RETCODE_OK == registry.register_type_object(objects[i], type_identifiers))
+                {
+                    registered[i] = true;
+                    --pending;
+                }
+            }
+
+            if (pending == pending_before)
+            {
+                EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                        "Failed to register " << pending << " type objects.");
+                return nullptr;
+            }
+        }
+
+        fastdds::dds::xtypes::TypeIdentifierPair type_identifiers;
+        if (fastdds::dds::RETCODE_OK != registry.register_type_object(objects.back(), type_identifiers))
+        {
+            return nullptr;
+        }
+        type_identifier = type_identifiers.type_identifier1();
+
+        auto builder = fastdds::dds::DynamicTypeBuilderFactory::get_instance()->create_type_w_type_object(
+            objects.back());
+        if (!builder)
+        {
+            return nullptr;
+        }
+        return builder->build();
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_RECORDING,
+                "Exception deserializing type objects: " << e.what());
+        return nullptr;
+    }
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
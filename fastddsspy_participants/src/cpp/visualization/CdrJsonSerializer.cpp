@@ -0,0 +1,630 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <limits>
+
+#include <fastddsspy_participants/visualization/CdrJsonSerializer.hpp>
+#include <fastddsspy_participants/visualization/json_utils.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+using cdr::FieldProjection;
+using cdr::TypeLayout;
+using cdr::TypeLayoutKind;
+
+namespace {
+
+//! Whether the JSON of a value of this layout is not an object nor an array
+bool is_json_primitive(
+        const TypeLayout& layout) noexcept
+{
+    switch (layout.kind)
+    {
+        case TypeLayoutKind::enumeration:
+        case TypeLayoutKind::structure:
+        case TypeLayoutKind::sequence:
+        case TypeLayoutKind::array:
+            return false;
+
+        default:
+            return true;
+    }
+}
+
+} /* namespace */
+
+constexpr std::size_t CdrJsonSerializer::INDENT_STEP;
+
+void CdrJsonSerializer::set_compact(
+        bool compact) noexcept
+{
+    compact_ = compact;
+}
+
+bool CdrJsonSerializer::serialize(
+        const TypeLayout& layout,
+        const uint8_t* data,
+        std::size_t size,
+        std::string& output)
+{
+    if (layout.kind != TypeLayoutKind::structure || !reader_.reset(data, size))
+    {
+        return false;
+    }
+
+    const std::size_t initial_size = output.size();
+    output_ = &output;
+    member_positions_.clear();
+
+    const bool written = write_value_(layout, 0);
+
+    output_ = nullptr;
+    if (!written)
+    {
+        output.resize(initial_size);
+    }
+    return written;
+}
+
+bool CdrJsonSerializer::serialize(
+        const TypeLayout& layout,
+        const FieldProjection& projection,
+        const uint8_t* data,
+        std::size_t size,
+        std::string& output)
+{
+    if (layout.kind != TypeLayoutKind::structure || !reader_.reset(data, size))
+    {
+        return false;
+    }
+
+    const std::size_t initial_size = output.size();
+    output_ = &output;
+    member_positions_.clear();
+
+    const bool written = projection.selects_all() ?
+            write_value_(layout, 0) :
+            write_projected_structure_(layout, projection, 0, true);
+
+    output_ = nullptr;
+    if (!written)
+    {
+        output.resize(initial_size);
+    }
+    return written;
+}
+
+bool CdrJsonSerializer::write_value_(
+        const TypeLayout& layout,
+        std::size_t indent)
+{
+    switch (layout.kind)
+    {
+        case TypeLayoutKind::boolean:
+        {
+            bool value;
+            if (!reader_.read(value))
+            {
+                return false;
+            }
+            output_->append(value ? "true" : "false");
+            return true;
+        }
+
+        case TypeLayoutKind::int8:
+            return write_integer_<int8_t>();
+
+        case TypeLayoutKind::uint8:
+            return write_integer_<uint8_t>();
+
+        case TypeLayoutKind::int16:
+            return write_integer_<int16_t>();
+
+        case TypeLayoutKind::uint16:
+            return write_integer_<uint16_t>();
+
+        case TypeLayoutKind::int32:
+            return write_integer_<int32_t>();
+
+        case TypeLayoutKind::uint32:
+            return write_integer_<uint32_t>();
+
+        case TypeLayoutKind::int64:
+            return write_integer_<int64_t>();
+
+        case TypeLayoutKind::uint64:
+            return write_integer_<uint64_t>();
+
+        case TypeLayoutKind::float32:
+        {
+            float value;
+            return reader_.read(value) && write_float_(value);
+        }
+
+        case TypeLayoutKind::float64:
+        {
+            double value;
+            return reader_.read(value) && write_float_(value);
+        }
+
+        case TypeLayoutKind::char8:
+        {
+            char value;
+            return reader_.read(value) && write_string_(&value, 1);
+        }
+
+        case TypeLayoutKind::string:
+        {
+            const char* chars;
+            uint32_t length;
+            if (!reader_.read_string(chars, length) || (layout.bound > 0 && length > layout.bound))
+            {
+                return false;
+            }
+            return write_string_(chars, length);
+        }
+
+        case TypeLayoutKind::enumeration:
+            return write_enumeration_(layout, indent);
+
+        case TypeLayoutKind::structure:
+            return write_structure_(layout, indent);
+
+        case TypeLayoutKind::sequence:
+        {
+            std::size_t end;
+            uint32_t count;
+            if (!reader_.read_delimiter(!layout.element->is_primitive(), end) ||
+                    !reader_.read(count) ||
+                    (layout.bound > 0 && count > layout.bound))
+            {
+                return false;
+            }
+            return write_collection_(*layout.element, count, indent) && reader_.close_delimiter(end);
+        }
+
+        case TypeLayoutKind::array:
+        {
+            std::size_t end;
+            if (!reader_.read_delimiter(!layout.element->is_primitive(), end))
+            {
+                return false;
+            }
+            return write_collection_(*layout.element, layout.bound, indent) && reader_.close_delimiter(end);
+        }
+    }
+
+    return false;
+}
+
+bool CdrJsonSerializer::write_structure_(
+        const TypeLayout& layout,
+        std::size_t indent)
+{
+    std::size_t end;
+    if (!reader_.read_delimiter(layout.appendable, end))
+    {
+        return false;
+    }
+
+    open_('{');
+
+    if (layout.members_sorted)
+    {
+        for (std::size_t i = 0; i < layout.members.size(); ++i)
+        {
+            if (i > 0)
+            {
+                separate_();
+            }
+            if (!write_member_(layout.members[i], indent + INDENT_STEP))
+            {
+                return false;
+            }
+        }
+    }
+    else
+    {
+        // Locate every member, then write them in name order
+        const std::size_t base = member_positions_.size();
+        for (const auto& member : layout.members)
+        {
+            member_positions_.push_back(reader_.position());
+            if (!reader_.skip_value(*member.layout))
+            {
+                return false;
+            }
+        }
+        const std::size_t structure_end = reader_.position();
+
+        for (std::size_t i = 0; i < layout.members_by_name.size(); ++i)
+        {
+            if (i > 0)
+            {
+                separate_();
+            }
+            const uint32_t index = layout.members_by_name[i];
+            reader_.seek(member_positions_[base + index]);
+            if (!write_member_(layout.members[index], indent + INDENT_STEP))
+            {
+                return false;
+            }
+        }
+
+        member_positions_.resize(base);
+        reader_.seek(structure_end);
+    }
+
+    close_('}', indent);
+
+    return reader_.close_delimiter(end);
+}
+
+bool CdrJsonSerializer::write_member_(
+        const TypeLayout::Member& member,
+        std::size_t indent)
+{
+    write_name_(member.name, indent);
+    return write_value_(*member.layout, indent);
+}
+
+bool CdrJsonSerializer::write_projected_structure_(
+        const TypeLayout& layout,
+        const FieldProjection& projection,
+        std::size_t indent,
+        bool root)
+{
+    std::size_t end;
+    if (!reader_.read_delimiter(layout.appendable, end))
+    {
+        return false;
+    }
+
+    open_('{');
+
+    bool first = true;
+    if (layout.members_sorted)
+    {
+        for (uint32_t i = 0; i <= projection.last_member; ++i)
+        {
+            const auto& selection = projection.members[i];
+            if (!selection)
+            {
+                if (!reader_.skip_value(*layout.members[i].layout))
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            if (!first)
+            {
+                separate_();
+            }
+            first = false;
+            if (!write_projected_member_(layout.members[i], *selection, indent + INDENT_STEP))
+            {
+                return false;
+            }
+        }
+    }
+    else
+    {
+        // Locate the members up to the last one selected, then write the selected ones in name order
+        const std::size_t base = member_positions_.size();
+        for (uint32_t i = 0; i <= projection.last_member; ++i)
+        {
+            member_positions_.push_back(reader_.position());
+            if (!reader_.skip_value(*layout.members[i].layout))
+            {
+                return false;
+            }
+        }
+        const std::size_t selection_end = reader_.position();
+
+        for (const uint32_t index : layout.members_by_name)
+        {
+            if (index > projection.last_member || !projection.members[index])
+            {
+                continue;
+            }
+
+            if (!first)
+            {
+                separate_();
+            }
+            first = false;
+            reader_.seek(member_positions_[base + index]);
+            if (!write_projected_member_(layout.members[index], *projection.members[index], indent + INDENT_STEP))
+            {
+                return false;
+            }
+        }
+
+        member_positions_.resize(base);
+        reader_.seek(selection_end);
+    }
+
+    close_('}', indent);
+
+    if (end > 0)
+    {
+        return reader_.close_delimiter(end);
+    }
+    if (root)
+    {
+        return true;
+    }
+
+    // The value that follows starts after the members not selected
+    for (std::size_t i = projection.last_member + 1; i < layout.members.size(); ++i)
+    {
+        if (!reader_.skip_value(*layout.members[i].layout))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CdrJsonSerializer::write_projected_member_(
+        const TypeLayout::Member& member,
+        const FieldProjection& projection,
+        std::size_t indent)
+{
+    if (projection.selects_all())
+    {
+        return write_member_(member, indent);
+    }
+
+    write_name_(member.name, indent);
+    return write_projected_structure_(*member.layout, projection, indent, false);
+}
+
+bool CdrJsonSerializer::write_collection_(
+        const TypeLayout& element,
+        uint32_t count,
+        std::size_t indent)
+{
+    // Every element but empty structures takes at least one byte
+    if (count > reader_.size() - reader_.position() &&
+            !(element.kind == TypeLayoutKind::structure && element.members.empty()))
+    {
+        return false;
+    }
+
+    if (count == 0)
+    {
+        output_->append("[]");
+        return true;
+    }
+
+    if (is_json_primitive(element))
+    {
+        output_->push_back('[');
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (i > 0)
+            {
+                output_->append(compact_ ? "," : ", ");
+            }
+            if (!write_value_(element, 0))
+            {
+                return false;
+            }
+        }
+        output_->push_back(']');
+        return true;
+    }
+
+    open_('[');
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (i > 0)
+        {
+            separate_();
+        }
+        write_indent_(indent + INDENT_STEP);
+        if (!write_value_(element, indent + INDENT_STEP))
+        {
+            return false;
+        }
+    }
+    close_(']', indent);
+    return true;
+}
+
+bool CdrJsonSerializer::write_enumeration_(
+        const TypeLayout& layout,
+        std::size_t indent)
+{
+    int32_t value;
+    switch (layout.primitive_size)
+    {
+        case 1:
+        {
+            int8_t narrow_value;
+            if (!reader_.read(narrow_value))
+            {
+                return false;
+            }
+            value = narrow_value;
+            break;
+        }
+
+        case 2:
+        {
+            int16_t narrow_value;
+            if (!reader_.read(narrow_value))
+            {
+                return false;
+            }
+            value = narrow_value;
+            break;
+        }
+
+        default:
+            if (!reader_.read(value))
+            {
+                return false;
+            }
+            break;
+    }
+
+    const auto literal = std::lower_bound(layout.literals.begin(), layout.literals.end(), value,
+                    [](const TypeLayout::EnumLiteral& literal, int32_t literal_value)
+                    {
+                        return literal.value < literal_value;
+                    });
+    if (literal == layout.literals.end() || literal->value != value)
+    {
+        return false;
+    }
+
+    open_('{');
+    write_name_("name", indent + INDENT_STEP);
+    if (!write_string_(literal->name.data(), literal->name.size()))
+    {
+        return false;
+    }
+    separate_();
+    write_name_("value", indent + INDENT_STEP);
+
+    char buffer[std::numeric_limits<int32_t>::digits10 + 3];
+    char* const buffer_end = buffer + sizeof(buffer);
+    char* begin = buffer_end;
+    uint32_t magnitude = value < 0 ? 0u - static_cast<uint32_t>(value) : static_cast<uint32_t>(value);
+    do
+    {
+        *--begin = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (value < 0)
+    {
+        *--begin = '-';
+    }
+    output_->append(begin, static_cast<std::size_t>(buffer_end - begin));
+
+    close_('}', indent);
+    return true;
+}
+
+template <typename T>
+bool CdrJsonSerializer::write_integer_()
+{
+    T value;
+    if (!reader_.read(value))
+    {
+        return false;
+    }
+
+    char buffer[std::numeric_limits<uint64_t>::digits10 + 3];
+    char* const buffer_end = buffer + sizeof(buffer);
+    char* begin = buffer_end;
+
+    const bool negative = value < 0;
+    // NOTE: computed in 64 bits unsigned so the lowest value of every type has a magnitude
+    uint64_t magnitude = negative ?
+            uint64_t(0) - static_cast<uint64_t>(static_cast<int64_t>(value)) :
+            static_cast<uint64_t>(value);
+    do
+    {
+        *--begin = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude != 0);
+    if (negative)
+    {
+        *--begin = '-';
+    }
+
+    output_->append(begin, static_cast<std::size_t>(buffer_end - begin));
+    return true;
+}
+
+bool CdrJsonSerializer::write_float_(
+        double value)
+{
+    append_json_float(value, *output_);
+    return true;
+}
+
+bool CdrJsonSerializer::write_string_(
+        const char* chars,
+        std::size_t length)
+{
+    // UTF-8 validation is left to the generic serializer
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        if (static_cast<unsigned char>(chars[i]) >= 0x80)
+        {
+            return false;
+        }
+    }
+
+    append_json_string(chars, length, *output_);
+    return true;
+}
+
+void CdrJsonSerializer::write_name_(
+        const std::string& name,
+        std::size_t indent)
+{
+    write_indent_(indent);
+    output_->push_back('"');
+    output_->append(name);
+    output_->append(compact_ ? "\":" : "\": ");
+}
+
+void CdrJsonSerializer::open_(
+        char bracket)
+{
+    output_->push_back(bracket);
+    if (!compact_)
+    {
+        output_->push_back('\n');
+    }
+}
+
+void CdrJsonSerializer::separate_()
+{
+    output_->append(compact_ ? "," : ",\n");
+}
+
+void CdrJsonSerializer::close_(
+        char bracket,
+        std::size_t indent)
+{
+    if (!compact_)
+    {
+        output_->push_back('\n');
+        write_indent_(indent);
+    }
+    output_->push_back(bracket);
+}
+
+void CdrJsonSerializer::write_indent_(
+        std::size_t indent)
+{
+    if (!compact_)
+    {
+        output_->append(indent, ' ');
+    }
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,958 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include <fastddsspy_participants/visualization/JsonFormatter.hpp>
+#include <fastddsspy_participants/visualization/json_utils.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+namespace {
+
+bool is_digit(
+        char c) noexcept
+{
+    return c >= '0' && c <= '9';
+}
+
+bool in_range(
+        const char* c,
+        unsigned char min,
+        unsigned char max) noexcept
+{
+    const unsigned char value = static_cast<unsigned char>(*c);
+    return value >= min && value <= max;
+}
+
+void append_utf8(
+        uint32_t code_point,
+        std::string& output)
+{
+    if (code_point < 0x80)
+    {
+        output.push_back(static_cast<char>(code_point));
+    }
+    else if (code_point < 0x800)
+    {
+        output.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+        output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+    else if (code_point < 0x10000)
+    {
+        output.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+        output.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+    else
+    {
+        output.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+        output.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    }
+}
+
+} /* namespace */
+
+constexpr std::size_t JsonFormatter::DEFAULT_INDENT_STEP;
+
+JsonFormatter::JsonFormatter(
+        std::size_t indent_step /* = DEFAULT_INDENT_STEP */)
+    : indent_step_(indent_step)
+{
+    // Do nothing
+}
+
+bool JsonFormatter::format(
+        const char* json,
+        std::size_t size,
+        std::string& output)
+{
+    const std::size_t initial_size = output.size();
+    cursor_ = json;
+    end_ = json + size;
+    output_ = &output;
+    members_.clear();
+
+    bool written = write_value_(0);
+    if (written)
+    {
+        // Nothing but whitespace may follow the document
+        skip_whitespace_();
+        written = (cursor_ == end_);
+    }
+
+    cursor_ = nullptr;
+    end_ = nullptr;
+    output_ = nullptr;
+    if (!written)
+    {
+        output.resize(initial_size);
+    }
+    return written;
+}
+
+bool JsonFormatter::format(
+        const std::string& json,
+        std::string& output)
+{
+    return format(json.data(), json.size(), output);
+}
+
+bool JsonFormatter::write_value_(
+        std::size_t indent)
+{
+    skip_whitespace_();
+    if (cursor_ == end_)
+    {
+        return false;
+    }
+
+    switch (*cursor_)
+    {
+        case '{':
+            return write_object_(indent);
+
+        case '[':
+            return write_array_(indent);
+
+        case '"':
+            return write_string_();
+
+        case 't':
+            return write_literal_("true", 4);
+
+        case 'f':
+            return write_literal_("false", 5);
+
+        case 'n':
+            return write_literal_("null", 4);
+
+        default:
+            return write_number_();
+    }
+}
+
+bool JsonFormatter::write_object_(
+        std::size_t indent)
+{
+    const char* object_begin = cursor_;
+    const std::size_t output_begin = output_->size();
+
+    ++cursor_;
+    output_->append("{\n");
+
+    skip_whitespace_();
+    if (cursor_ != end_ && *cursor_ == '}')
+    {
+        ++cursor_;
+        output_->push_back('\n');
+        write_indent_(indent);
+        output_->push_back('}');
+        return true;
+    }
+
+    const char* previous_name = nullptr;
+    while (true)
+    {
+        skip_whitespace_();
+        const char* name = cursor_;
+        bool plain;
+        if (!read_string_(nullptr, plain))
+        {
+            return false;
+        }
+
+        if (previous_name && !name_less_(previous_name, name))
+        {
+            // Unsorted or repeated names: start again locating every member first
+            output_->resize(output_begin);
+            cursor_ = object_begin;
+            return write_sorted_object_(indent);
+        }
+
+        if (previous_name)
+        {
+            output_->append(",\n");
+        }
+        write_indent_(indent + indent_step_);
+        if (plain)
+        {
+            output_->append(name, static_cast<std::size_t>(cursor_ - name));
+        }
+        else
+        {
+            cursor_ = name;
+            if (!write_string_())
+            {
+                return false;
+            }
+        }
+
+        if (!consume_(':'))
+        {
+            return false;
+        }
+        output_->append(": ");
+
+        if (!write_value_(indent + indent_step_))
+        {
+            return false;
+        }
+        previous_name = name;
+
+        if (consume_(','))
+        {
+            continue;
+        }
+        if (!consume_('}'))
+        {
+            return false;
+        }
+        break;
+    }
+
+    output_->push_back('\n');
+    write_indent_(indent);
+    output_->push_back('}');
+    return true;
+}
+
+bool JsonFormatter::write_sorted_object_(
+        std::size_t indent)
+{
+    const std::size_t first_member = members_.size();
+
+    // Locate every member
+    ++cursor_;
+    while (true)
+    {
+        skip_whitespace_();
+        const char* name = cursor_;
+        bool plain;
+        if (!read_string_(nullptr, plain) || !consume_(':'))
+        {
+            return false;
+        }
+
+        skip_whitespace_();
+        const char* value = cursor_;
+        if (!skip_value_())
+        {
+            return false;
+        }
+        members_.push_back({name, value});
+
+        if (consume_(','))
+        {
+            continue;
+        }
+        if (!consume_('}'))
+        {
+            return false;
+        }
+        break;
+    }
+    const char* object_end = cursor_;
+
+    std::stable_sort(members_.begin() + first_member, members_.end(),
+            [this](const MemberSpan& lhs, const MemberSpan& rhs)
+            {
+                return name_less_(lhs.name, rhs.name);
+            });
+
+    output_->append("{\n");
+    bool first = true;
+    for (std::size_t i = first_member; i < members_.size(); ++i)
+    {
+        // Only the last of repeated names is kept
+        if (i + 1 < members_.size() && !name_less_(members_[i].name, members_[i + 1].name))
+        {
+            continue;
+        }
+
+        // Nested objects use the stack too, so the member is copied
+        const MemberSpan member = members_[i];
+
+        if (!first)
+        {
+            output_->append(",\n");
+        }
+        first = false;
+
+        write_indent_(indent + indent_step_);
+        cursor_ = member.name;
+        if (!write_string_())
+        {
+            return false;
+        }
+        output_->append(": ");
+
+        cursor_ = member.value;
+        if (!write_value_(indent + indent_step_))
+        {
+            return false;
+        }
+    }
+    members_.resize(first_member);
+
+    output_->push_back('\n');
+    write_indent_(indent);
+    output_->push_back('}');
+
+    cursor_ = object_end;
+    return true;
+}
+
+bool JsonFormatter::write_array_(
+        std::size_t indent)
+{
+    const char* array_begin = cursor_;
+    const std::size_t output_begin = output_->size();
+
+    ++cursor_;
+    output_->push_back('[');
+
+    skip_whitespace_();
+    if (cursor_ != end_ && *cursor_ == ']')
+    {
+        ++cursor_;
+        output_->push_back(']');
+        return true;
+    }
+
+    bool first = true;
+    while (true)
+    {
+        skip_whitespace_();
+        if (cursor_ != end_ && (*cursor_ == '{' || *cursor_ == '['))
+        {
+            // Not all the elements are primitives: start again writing one element per line
+            output_->resize(output_begin);
+            cursor_ = array_begin;
+            return write_multiline_array_(indent);
+        }
+
+        if (!first)
+        {
+            output_->append(", ");
+        }
+        first = false;
+
+        if (!write_value_(indent + indent_step_))
+        {
+            return false;
+        }
+
+        if (consume_(','))
+        {
+            continue;
+        }
+        if (!consume_(']'))
+        {
+            return false;
+        }
+        break;
+    }
+
+    output_->push_back(']');
+    return true;
+}
+
+bool JsonFormatter::write_multiline_array_(
+        std::size_t indent)
+{
+    ++cursor_;
+    output_->append("[\n");
+
+    bool first = true;
+    while (true)
+    {
+        if (!first)
+        {
+            output_->append(",\n");
+        }
+        first = false;
+
+        write_indent_(indent + indent_step_);
+        if (!write_value_(indent + indent_step_))
+        {
+            return false;
+        }
+
+        if (consume_(','))
+        {
+            continue;
+        }
+        if (!consume_(']'))
+        {
+            return false;
+        }
+        break;
+    }
+
+    output_->push_back('\n');
+    write_indent_(indent);
+    output_->push_back(']');
+    return true;
+}
+
+bool JsonFormatter::write_string_()
+{
+    const char* string_begin = cursor_;
+    bool plain;
+    if (!read_string_(nullptr, plain))
+    {
+        return false;
+    }
+
+    if (plain)
+    {
+        // Nothing to escape: the text is written as is, quotes included
+        output_->append(string_begin, static_cast<std::size_t>(cursor_ - string_begin));
+        return true;
+    }
+
+    cursor_ = string_begin;
+    decoded_.clear();
+    if (!read_string_(&decoded_, plain))
+    {
+        return false;
+    }
+    append_json_string(decoded_.data(), decoded_.size(), *output_);
+    return true;
+}
+
+bool JsonFormatter::write_number_()
+{
+    const char* number_begin = cursor_;
+    bool integer;
+    if (!skip_number_(integer))
+    {
+        return false;
+    }
+    const std::size_t length = static_cast<std::size_t>(cursor_ - number_begin);
+    const bool negative = (*number_begin == '-');
+
+    // Integers that fit in 64 bits are written back as they are, but for -0
+    const std::size_t digits = negative ? length - 1 : length;
+    if (integer && digits < 19)
+    {
+        if (negative && digits == 1 && number_begin[1] == '0')
+        {
+            output_->push_back('0');
+        }
+        else
+        {
+            output_->append(number_begin, length);
+        }
+        return true;
+    }
+
+    // NOTE: strto* functions need a null-terminated string
+    decoded_.assign(number_begin, length);
+
+    if (integer)
+    {
+        char* parsed_end;
+        errno = 0;
+        if (negative)
+        {
+            const long long value = std::strtoll(decoded_.c_str(), &parsed_end, 10);
+            if (errno == 0)
+            {
+                output_->append(std::to_string(value));
+                return true;
+            }
+        }
+        else
+        {
+            const unsigned long long value = std::strtoull(decoded_.c_str(), &parsed_end, 10);
+            if (errno == 0)
+            {
+                output_->append(std::to_string(value));
+                return true;
+            }
+        }
+        // Out of range integers are read as floating point numbers, as nlohmann::json does
+    }
+
+    // Out of range numbers are not valid for nlohmann::json either
+    const double value = std::strtod(decoded_.c_str(), nullptr);
+    if (!std::isfinite(value))
+    {
+        return false;
+    }
+
+    append_json_float(value, *output_);
+    return true;
+}
+
+bool JsonFormatter::write_literal_(
+        const char* literal,
+        std::size_t length)
+{
+    if (static_cast<std::size_t>(end_ - cursor_) < length || std::memcmp(cursor_, literal, length) != 0)
+    {
+        return false;
+    }
+
+    output_->append(literal, length);
+    cursor_ += length;
+    return true;
+}
+
+bool JsonFormatter::skip_value_()
+{
+    skip_whitespace_();
+    if (cursor_ == end_)
+    {
+        return false;
+    }
+
+    switch (*cursor_)
+    {
+        case '{':
+        case '[':
+        {
+            const char close = (*cursor_ == '{') ? '}' : ']';
+            const bool object = (close == '}');
+
+            ++cursor_;
+            if (consume_(close))
+            {
+                return true;
+            }
+
+            while (true)
+            {
+                if (object)
+                {
+                    skip_whitespace_();
+                    bool plain;
+                    if (!read_string_(nullptr, plain) || !consume_(':'))
+                    {
+                        return false;
+                    }
+                }
+
+                if (!skip_value_())
+                {
+                    return false;
+                }
+
+                if (consume_(','))
+                {
+                    continue;
+                }
+                return consume_(close);
+            }
+        }
+
+        case '"':
+        {
+            bool plain;
+            return read_string_(nullptr, plain);
+        }
+
+        case 't':
+        case 'n':
+        {
+            const char* literal = (*cursor_ == 't') ? "true" : "null";
+            if (end_ - cursor_ < 4 || std::memcmp(cursor_, literal, 4) != 0)
+            {
+                return false;
+            }
+            cursor_ += 4;
+            return true;
+        }
+
+        case 'f':
+        {
+            if (end_ - cursor_ < 5 || std::memcmp(cursor_, "false", 5) != 0)
+            {
+                return false;
+            }
+            cursor_ += 5;
+            return true;
+        }
+
+        default:
+        {
+            bool integer;
+            return skip_number_(integer);
+        }
+    }
+}
+
+bool JsonFormatter::skip_number_(
+        bool& integer) noexcept
+{
+    integer = true;
+
+    if (cursor_ != end_ && *cursor_ == '-')
+    {
+        ++cursor_;
+    }
+
+    // Integer part: 0 or digits not starting with 0
+    if (cursor_ == end_ || !is_digit(*cursor_))
+    {
+        return false;
+    }
+    if (*cursor_++ != '0')
+    {
+        while (cursor_ != end_ && is_digit(*cursor_))
+        {
+            ++cursor_;
+        }
+    }
+
+    if (cursor_ != end_ && *cursor_ == '.')
+    {
+        integer = false;
+        ++cursor_;
+        if (cursor_ == end_ || !is_digit(*cursor_))
+        {
+            return false;
+        }
+        while (cursor_ != end_ && is_digit(*cursor_))
+        {
+            ++cursor_;
+        }
+    }
+
+    if (cursor_ != end_ && (*cursor_ == 'e' || *cursor_ == 'E'))
+    {
+        integer = false;
+        ++cursor_;
+        if (cursor_ != end_ && (*cursor_ == '+' || *cursor_ == '-'))
+        {
+            ++cursor_;
+        }
+        if (cursor_ == end_ || !is_digit(*cursor_))
+        {
+            return false;
+        }
+        while (cursor_ != end_ && is_digit(*cursor_))
+        {
+            ++cursor_;
+        }
+    }
+
+    return true;
+}
+
+bool JsonFormatter::read_string_(
+        std::string* decoded,
+        bool& plain)
+{
+    if (cursor_ == end_ || *cursor_ != '"')
+    {
+        return false;
+    }
+    ++cursor_;
+
+    plain = true;
+    const char* run_begin = cursor_;
+    while (cursor_ != end_)
+    {
+        const unsigned char c = static_cast<unsigned char>(*cursor_);
+        if (c == '"')
+        {
+            if (decoded)
+            {
+                decoded->append(run_begin, static_cast<std::size_t>(cursor_ - run_begin));
+            }
+            ++cursor_;
+            return true;
+        }
+        else if (c == '\\')
+        {
+            plain = false;
+            if (decoded)
+            {
+                decoded->append(run_begin, static_cast<std::size_t>(cursor_ - run_begin));
+            }
+            if (!read_escape_(decoded))
+            {
+                return false;
+            }
+            run_begin = cursor_;
+        }
+        else if (c < 0x20)
+        {
+            // Control characters must be escaped
+            return false;
+        }
+        else if (c >= 0x80)
+        {
+            if (!skip_utf8_())
+            {
+                return false;
+            }
+        }
+        else
+        {
+            ++cursor_;
+        }
+    }
+
+    // Missing closing quote
+    return false;
+}
+
+bool JsonFormatter::read_escape_(
+        std::string* decoded)
+{
+    // Skip backslash
+    ++cursor_;
+    if (cursor_ == end_)
+    {
+        return false;
+    }
+
+    char character;
+    switch (*cursor_++)
+    {
+        case '"':
+            character = '"';
+            break;
+        case '\\':
+            character = '\\';
+            break;
+        case '/':
+            character = '/';
+            break;
+        case 'b':
+            character = '\b';
+            break;
+        case 'f':
+            character = '\f';
+            break;
+        case 'n':
+            character = '\n';
+            break;
+        case 'r':
+            character = '\r';
+            break;
+        case 't':
+            character = '\t';
+            break;
+        case 'u':
+        {
+            uint32_t code_point;
+            if (!read_code_unit_(code_point))
+            {
+                return false;
+            }
+
+            if (code_point >= 0xD800 && code_point <= 0xDBFF)
+            {
+                // High surrogate: must be followed by a low surrogate
+                uint32_t low_surrogate;
+                if (end_ - cursor_ < 2 || cursor_[0] != '\\' || cursor_[1] != 'u')
+                {
+                    return false;
+                }
+                cursor_ += 2;
+                if (!read_code_unit_(low_surrogate) || low_surrogate < 0xDC00 || low_surrogate > 0xDFFF)
+                {
+                    return false;
+                }
+                code_point = 0x10000 + ((code_point - 0xD800) << 10) + (low_surrogate - 0xDC00);
+            }
+            else if (code_point >= 0xDC00 && code_point <= 0xDFFF)
+            {
+                return false;
+            }
+
+            if (decoded)
+            {
+                append_utf8(code_point, *decoded);
+            }
+            return true;
+        }
+        default:
+            return false;
+    }
+
+    if (decoded)
+    {
+        decoded->push_back(character);
+    }
+    return true;
+}
+
+bool JsonFormatter::read_code_unit_(
+        uint32_t& code_unit) noexcept
+{
+    if (end_ - cursor_ < 4)
+    {
+        return false;
+    }
+
+    code_unit = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        const char c = *cursor_++;
+        code_unit <<= 4;
+        if (c >= '0' && c <= '9')
+        {
+            code_unit |= static_cast<uint32_t>(c - '0');
+        }
+        else if (c >= 'a' && c <= 'f')
+        {
+            code_unit |= static_cast<uint32_t>(c - 'a' + 10);
+        }
+        else if (c >= 'A' && c <= 'F')
+        {
+            code_unit |= static_cast<uint32_t>(c - 'A' + 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool JsonFormatter::skip_utf8_() noexcept
+{
+    // Well-formed UTF-8 byte sequences (RFC 3629)
+    const unsigned char lead = static_cast<unsigned char>(*cursor_);
+    std::size_t continuation;
+    unsigned char second_min = 0x80;
+    unsigned char second_max = 0xBF;
+
+    if (lead >= 0xC2 && lead <= 0xDF)
+    {
+        continuation = 1;
+    }
+    else if (lead >= 0xE0 && lead <= 0xEF)
+    {
+        continuation = 2;
+        if (lead == 0xE0)
+        {
+            second_min = 0xA0;
+        }
+        else if (lead == 0xED)
+        {
+            second_max = 0x9F;
+        }
+    }
+    else if (lead >= 0xF0 && lead <= 0xF4)
+    {
+        continuation = 3;
+        if (lead == 0xF0)
+        {
+            second_min = 0x90;
+        }
+        else if (lead == 0xF4)
+        {
+            second_max = 0x8F;
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    if (static_cast<std::size_t>(end_ - cursor_) <= continuation || !in_range(cursor_ + 1, second_min, second_max))
+    {
+        return false;
+    }
+    for (std::size_t i = 2; i <= continuation; ++i)
+    {
+        if (!in_range(cursor_ + i, 0x80, 0xBF))
+        {
+            return false;
+        }
+    }
+
+    cursor_ += continuation + 1;
+    return true;
+}
+
+void JsonFormatter::skip_whitespace_() noexcept
+{
+    while (cursor_ != end_ && (*cursor_ == ' ' || *cursor_ == '\n' || *cursor_ == '\r' || *cursor_ == '\t'))
+    {
+        ++cursor_;
+    }
+}
+
+bool JsonFormatter::consume_(
+        char c) noexcept
+{
+    skip_whitespace_();
+    if (cursor_ == end_ || *cursor_ != c)
+    {
+        return false;
+    }
+    ++cursor_;
+    return true;
+}
+
+bool JsonFormatter::name_less_(
+        const char* lhs,
+        const char* rhs)
+{
+    // Names with no escape sequences are compared in place
+    const unsigned char* l = reinterpret_cast<const unsigned char*>(lhs + 1);
+    const unsigned char* r = reinterpret_cast<const unsigned char*>(rhs + 1);
+    while (*l != '\\' && *r != '\\')
+    {
+        if (*l == '"')
+        {
+            return *r != '"';
+        }
+        if (*r == '"' || *l != *r)
+        {
+            return *r != '"' && *l < *r;
+        }
+        ++l;
+        ++r;
+    }
+
+    // Decode both names otherwise
+    const char* cursor = cursor_;
+    bool plain;
+    decoded_.clear();
+    cursor_ = lhs;
+    read_string_(&decoded_, plain);
+    other_decoded_.clear();
+    cursor_ = rhs;
+    read_string_(&other_decoded_, plain);
+    cursor_ = cursor;
+
+    return decoded_ < other_decoded_;
+}
+
+void JsonFormatter::write_indent_(
+        std::size_t indent)
+{
+    output_->append(indent, ' ');
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
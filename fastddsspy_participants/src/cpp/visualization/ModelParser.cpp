@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License\.
 
+#include <algorithm>
 #include <utility>
 
 #include <cpp_utils/ros2_mangling.hpp>
@@ -197,6 +198,43 @@ void fill_complex_endpoint(
     result.qos.reliability = endpoint.topic.topic_qos.reliability_qos;
 }
 
+/*
+ * This is an auxiliary function that is only used in topic_latency_data and samples_data to
+ * not duplicate this functionality between the topic, its writers and their jitter.
+ */
+LatencyData latency_data(
+        const LatencyHistogram::Snapshot& latency) noexcept
+{
+    constexpr double NS_PER_MS = 1e6;
+
+    return {
+        latency.count,
+        latency.mean() / NS_PER_MS,
+        latency.percentile(0.5) / NS_PER_MS,
+        latency.percentile(0.9) / NS_PER_MS,
+        latency.percentile(0.99) / NS_PER_MS,
+        latency.percentile(0.999) / NS_PER_MS,
+        latency.max / NS_PER_MS,
+        "ms"};
+}
+
+/*
+ * This is an auxiliary function that is only used in writers and complex_topic_data to
+ * not duplicate this functionality between writers and topics.
+ */
+SamplesData samples_data(
+        const SequenceTracker::Snapshot& samples) noexcept
+{
+    return {
+        samples.received,
+        samples.lost,
+        samples.out_of_order,
+        samples.duplicates,
+        samples.loss_ratio * 100,
+        "%",
+        latency_data(samples.jitter)};
+}
+
 void set_endpoint_simple_information(
         const SpyModel& model,
         std::vector<SimpleEndpointData>& result,
@@ -262,6 +300,11 @@ ComplexEndpointData ModelParser::writers(
 
     set_endpoint_complex_information(model, result, eprosima::ddspipe::core::types::EndpointKind::writer, guid);
 
+    if (result.guid.is_valid())
+    {
+        result.samples = samples_data(model.get_writer_samples(guid));
+    }
+
     return result;
 }
 
@@ -319,6 +362,34 @@ std::set<eprosima::ddspipe::core::types::DdsTopic> ModelParser::get_topics(
     return result;
 }
 
+/*
+ * This is an auxiliary function that is only used in simple_topic_data and complex_topic_data to
+ * not duplicate this functionality between topics and writers.
+ */
+PayloadSizeData payload_size_data(
+        const PayloadSizeStats::Snapshot& payload_size,
+        bool histogram) noexcept
+{
+    PayloadSizeData result {payload_size.min, payload_size.mean(), payload_size.max, "B", {}};
+
+    if (histogram)
+    {
+        // Only the buckets with payloads
+        for (std::size_t i = 0; i < payload_size.buckets.size(); ++i)
+        {
+            if (payload_size.buckets[i] > 0)
+            {
+                result.histogram.push_back({
+                            PayloadSizeStats::bucket_lower_bound(i),
+                            PayloadSizeStats::bucket_upper_bound(i),
+                            payload_size.buckets[i]});
+            }
+        }
+    }
+
+    return result;
+}
+
 SimpleTopicData ModelParser::simple_topic_data(
         const SpyModel& model,
         const ddspipe::core::types::DdsTopic& topic) noexcept
@@ -348,6 +419,13 @@ SimpleTopicData ModelParser::simple_topic_data(
     result.datareaders = datareaders;
     result.rate.rate = model.get_topic_rate(topic);
     result.rate.unit = "Hz";
+    result.average_rate.rate = model.get_topic_average_rate(topic);
+    result.average_rate.unit = "Hz";
+
+    const TopicRateCalculator::TopicTraffic traffic = model.get_topic_traffic(topic);
+    result.bandwidth.rate = traffic.topic.bandwidth;
+    result.bandwidth.unit = "B/s";
+    result.payload_size = payload_size_data(traffic.topic.payload_size, false);
 
     return result;
 }
@@ -364,6 +442,25 @@ ComplexTopicData ModelParser::complex_topic_data(
     result.discovered = model.is_topic_type_discovered(topic);
     result.rate.rate = model.get_topic_rate(topic);
     result.rate.unit = "Hz";
+    result.average_rate.rate = model.get_topic_average_rate(topic);
+    result.average_rate.unit = "Hz";
+
+    const TopicRateCalculator::TopicTraffic traffic = model.get_topic_traffic(topic);
+    result.bandwidth.rate = traffic.topic.bandwidth;
+    result.bandwidth.unit = "B/s";
+    result.payload_size = payload_size_data(traffic.topic.payload_size, true);
+
+    const auto samples = model.get_topic_samples(topic);
+    for (const auto& writer : traffic.writers)
+    {
+        auto writer_samples = samples.find(writer.first);
+        result.datawriters_traffic.push_back({
+                    writer.first,
+                    {writer.second.bandwidth, "B/s"},
+                    payload_size_data(writer.second.payload_size, true),
+                    samples_data(
+                        writer_samples != samples.end() ? writer_samples->second : SequenceTracker::Snapshot())});
+    }
 
     for (const auto& it : model.endpoint_database_)
     {
@@ -394,6 +491,25 @@ ComplexTopicData ModelParser::complex_topic_data(
     return result;
 }
 
+TopicLatencyData ModelParser::topic_latency_data(
+        const SpyModel& model,
+        const ddspipe::core::types::DdsTopic& topic) noexcept
+{
+    TopicLatencyData result;
+
+    result.name = model.get_ros2_types() ? utils::demangle_if_ros_topic(topic.m_topic_name) : topic.m_topic_name;
+    result.type = model.get_ros2_types() ? utils::demangle_if_ros_type(topic.type_name) : topic.type_name;
+
+    const TopicRateCalculator::TopicLatency latency = model.get_topic_latency(topic);
+    result.latency = latency_data(latency.topic);
+    for (const auto& writer : latency.writers)
+    {
+        result.datawriters.push_back({writer.first, latency_data(writer.second)});
+    }
+
+    return result;
+}
+
 std::vector<SimpleTopicData> ModelParser::topics(
         const SpyModel& model,
         const ddspipe::core::types::WildcardDdsFilterTopic& filter_topic) noexcept
@@ -424,6 +540,40 @@ std::vector<ComplexTopicData> ModelParser::topics_verbose(
     return result;
 }
 
+std::vector<TopicLatencyData> ModelParser::topics_latency(
+        const SpyModel& model,
+        const ddspipe::core::types::WildcardDdsFilterTopic& filter_topic) noexcept
+{
+    std::vector<TopicLatencyData> result;
+
+    std::set<eprosima::ddspipe::core::types::DdsTopic> topics = get_topics(model, filter_topic);
+    for (const auto& topic : topics)
+    {
+        result.push_back(topic_latency_data(model, topic));
+    }
+
+    return result;
+}
+
+std::vector<TopTopicData> ModelParser::top_topics(
+        const SpyModel& model,
+        std::size_t size,
+        TopicRanking::Key key) noexcept
+{
+    std::vector<TopTopicData> result;
+
+    for (const auto& activity : model.get_top_topics(size, key))
+    {
+        result.push_back({
+                    model.get_ros2_types() ? utils::demangle_if_ros_topic(activity.topic_name) : activity.topic_name,
+                    static_cast<int>(activity.writers),
+                    {activity.rate, "Hz"},
+                    {activity.bandwidth, "B/s"}});
+    }
+
+    return result;
+}
+
 std::string ModelParser::topics_type_idl(
         const SpyModel& model,
         const ddspipe::core::types::WildcardDdsFilterTopic& filter_topic) noexcept
@@ -480,6 +630,11 @@ std::vector<TopicKeysData> ModelParser::topics_keys_by_ddstopic(
         topic_data.instances = std::vector<std::string>(instances.begin(), instances.end());
         topic_data.instance_count = instances.size();
 
+        auto evictions = model.get_topic_instance_evictions(topic.m_topic_name);
+        topic_data.evictions.per_topic_limit = evictions.per_topic_limit;
+        topic_data.evictions.total_limit = evictions.total_limit;
+        topic_data.evictions.memory_limit = evictions.memory_limit;
+
         result.push_back(topic_data);
     }
 
@@ -501,6 +656,76 @@ std::vector<TopicKeysData> ModelParser::topics_keys(
     return topics_keys_by_ddstopic(model, topics);
 }
 
+std::vector<TopicInstancesData> ModelParser::topics_instances(
+        SpyModel& model,
+        const ddspipe::core::types::WildcardDdsFilterTopic& filter_topic) noexcept
+{
+    std::vector<TopicInstancesData> result;
+
+    for (const auto& topic : get_topics(model, filter_topic))
+    {
+        std::set<eprosima::ddspipe::core::types::DdsTopic> topic_set = {topic};
+        if (!model.is_any_topic_type_discovered(topic_set))
+        {
+            continue;
+        }
+
+        TopicInstancesData topic_data;
+        topic_data.topic_name = model.get_ros2_types()
+            ? utils::demangle_if_ros_topic(topic.m_topic_name)
+            : topic.m_topic_name;
+        topic_data.key_fields = model.get_topic_key_fields(topic.m_topic_name);
+
+        auto instances = model.get_topic_instance_stats(topic);
+        std::sort(instances.begin(), instances.end(),
+                [](const InstanceCache::InstanceStats& lhs, const InstanceCache::InstanceStats& rhs)
+                {
+                    if (lhs.rate != rhs.rate)
+                    {
+                        return lhs.rate > rhs.rate;
+                    }
+                    if (lhs.samples != rhs.samples)
+                    {
+                        return lhs.samples > rhs.samples;
+                    }
+                    return lhs.key_representation < rhs.key_representation;
+                });
+
+        for (const auto& instance : instances)
+        {
+            InstanceData instance_data;
+            instance_data.key = instance.key_representation;
+            switch (instance.state)
+            {
+                case InstanceCache::InstanceState::alive:
+                    instance_data.state = "alive";
+                    break;
+                case InstanceCache::InstanceState::disposed:
+                    instance_data.state = "disposed";
+                    break;
+                case InstanceCache::InstanceState::no_writers:
+                    instance_data.state = "no_writers";
+                    break;
+            }
+            instance_data.writers = static_cast<int>(instance.writers);
+            instance_data.samples = instance.samples;
+            instance_data.rate = {static_cast<float>(instance.rate), "Hz"};
+            instance_data.payload_size = {
+                instance.samples > 0 ? static_cast<float>(instance.bytes) / instance.samples : 0, "B"};
+            topic_data.instances.push_back(std::move(instance_data));
+        }
+
+        auto evictions = model.get_topic_instance_evictions(topic.m_topic_name);
+        topic_data.evictions.per_topic_limit = evictions.per_topic_limit;
+        topic_data.evictions.total_limit = evictions.total_limit;
+        topic_data.evictions.memory_limit = evictions.memory_limit;
+
+        result.push_back(std::move(topic_data));
+    }
+
+    return result;
+}
+
 } /* namespace participants */
 } /* namespace spy */
 } /* namespace eprosima */
@@ -0,0 +1,139 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <sstream>
+
+#include <fastdds/dds/xtypes/utils.hpp>
+
+#include <cpp_utils/Log.hpp>
+
+#include <fastddsspy_participants/visualization/SampleJsonSerializer.hpp>
+#include <fastddsspy_participants/visualization/json_utils.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+bool SampleJsonSerializer::serialize(
+        TypeDecoder& decoder,
+        const ddspipe::core::types::RtpsPayloadData& data,
+        std::string& output)
+{
+    const auto& layout = decoder.layout();
+
+    if (!fields_.empty())
+    {
+        // Only the CDR serializer can skip the members not selected
+        std::string error;
+        const auto projection = projection_(decoder, error);
+        return projection &&
+               cdr_serializer_.serialize(*layout, *projection, data.payload.data, data.payload.length, output);
+    }
+
+    if (layout && cdr_serializer_.serialize(*layout, data.payload.data, data.payload.length, output))
+    {
+        return true;
+    }
+
+    return serialize_dynamic_data_(decoder, data, output);
+}
+
+void SampleJsonSerializer::select_fields(
+        const std::vector<std::string>& fields)
+{
+    fields_ = fields;
+    projections_.clear();
+}
+
+void SampleJsonSerializer::set_compact(
+        bool compact)
+{
+    compact_ = compact;
+    cdr_serializer_.set_compact(compact);
+}
+
+bool SampleJsonSerializer::can_serialize(
+        const TypeDecoder& decoder,
+        std::string& error)
+{
+    return fields_.empty() || projection_(decoder, error) != nullptr;
+}
+
+std::shared_ptr<const cdr::FieldProjection> SampleJsonSerializer::projection_(
+        const TypeDecoder& decoder,
+        std::string& error)
+{
+    const auto& layout = decoder.layout();
+    if (!layout)
+    {
+        error = "Fields cannot be selected in type " + decoder.type()->get_name().to_string() + ".";
+        return nullptr;
+    }
+
+    auto it = projections_.find(layout);
+    if (it == projections_.end())
+    {
+        CompiledProjection compiled;
+        compiled.projection = cdr::build_field_projection(*layout, fields_, compiled.error);
+        it = projections_.emplace(layout, std::move(compiled)).first;
+    }
+
+    error = it->second.error;
+    return it->second.projection;
+}
+
+bool SampleJsonSerializer::serialize_dynamic_data_(
+        TypeDecoder& decoder,
+        const ddspipe::core::types::RtpsPayloadData& data,
+        std::string& output)
+{
+    // Get deserialized data, borrowed from the decoder of the type
+    auto dyn_data = decoder.deserialize(data);
+    if (!dyn_data)
+    {
+        return false;
+    }
+
+    std::stringstream ss;
+    if (fastdds::dds::RETCODE_OK !=
+            fastdds::dds::json_serialize(dyn_data.get(), fastdds::dds::DynamicDataJsonFormat::EPROSIMA, ss))
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_SAMPLEJSONSERIALIZER,
+                "Failed to serialize data of type " << decoder.type()->get_name().to_string() << " into JSON.");
+        return false;
+    }
+
+    // Reformat: arrays single-line, and members sorted as the CDR serializer writes them
+    std::string& formatted = compact_ ? formatted_json_ : output;
+    if (compact_)
+    {
+        formatted_json_.clear();
+    }
+    if (!json_formatter_.format(ss.str(), formatted))
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_SAMPLEJSONSERIALIZER,
+                "Failed to format JSON of type " << decoder.type()->get_name().to_string() << ".");
+        return false;
+    }
+
+    if (compact_)
+    {
+        append_compact_json(formatted_json_.data(), formatted_json_.size(), output);
+    }
+    return true;
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,264 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+
+#include <nlohmann/json.hpp>
+
+#include <fastddsspy_participants/visualization/cbor_utils.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+namespace {
+
+constexpr uint8_t MAJOR_UNSIGNED = 0;
+constexpr uint8_t MAJOR_NEGATIVE = 1;
+constexpr uint8_t MAJOR_TEXT = 3;
+constexpr uint8_t MAJOR_MAP = 5;
+
+constexpr char INDEFINITE_ARRAY = '\x9f';
+constexpr char INDEFINITE_MAP = '\xbf';
+constexpr char BREAK = '\xff';
+constexpr char FALSE_VALUE = '\xf4';
+constexpr char TRUE_VALUE = '\xf5';
+constexpr char NULL_VALUE = '\xf6';
+constexpr char FLOAT32 = '\xfa';
+constexpr char FLOAT64 = '\xfb';
+
+//! Append the \c size low bytes of \c value, most significant first
+void append_big_endian(
+        uint64_t value,
+        std::size_t size,
+        std::string& output)
+{
+    for (std::size_t i = size; i > 0; --i)
+    {
+        output.push_back(static_cast<char>((value >> (8 * (i - 1))) & 0xFF));
+    }
+}
+
+//! Append the head of an item of \c major_type with \c argument, in its shortest encoding
+void append_head(
+        uint8_t major_type,
+        uint64_t argument,
+        std::string& output)
+{
+    const uint8_t major_bits = static_cast<uint8_t>(major_type << 5);
+    if (argument < 24)
+    {
+        output.push_back(static_cast<char>(major_bits | argument));
+    }
+    else if (argument <= 0xFF)
+    {
+        output.push_back(static_cast<char>(major_bits | 24));
+        append_big_endian(argument, 1, output);
+    }
+    else if (argument <= 0xFFFF)
+    {
+        output.push_back(static_cast<char>(major_bits | 25));
+        append_big_endian(argument, 2, output);
+    }
+    else if (argument <= 0xFFFFFFFF)
+    {
+        output.push_back(static_cast<char>(major_bits | 26));
+        append_big_endian(argument, 4, output);
+    }
+    else
+    {
+        output.push_back(static_cast<char>(major_bits | 27));
+        append_big_endian(argument, 8, output);
+    }
+}
+
+void append_float(
+        double value,
+        std::string& output)
+{
+    const float narrow_value = static_cast<float>(value);
+    if (static_cast<double>(narrow_value) == value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &narrow_value, sizeof(bits));
+        output.push_back(FLOAT32);
+        append_big_endian(bits, sizeof(bits), output);
+        return;
+    }
+
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    output.push_back(FLOAT64);
+    append_big_endian(bits, sizeof(bits), output);
+}
+
+//! Writes the CBOR item of a JSON document as the parser reads it
+class CborSaxWriter : public nlohmann::json::json_sax_t
+{
+public:
+
+    explicit CborSaxWriter(
+            std::string& output)
+        : output_(output)
+    {
+        // Do nothing
+    }
+
+    bool null() override
+    {
+        output_.push_back(NULL_VALUE);
+        return true;
+    }
+
+    bool boolean(
+            bool value) override
+    {
+        output_.push_back(value ? TRUE_VALUE : FALSE_VALUE);
+        return true;
+    }
+
+    bool number_integer(
+            number_integer_t value) override
+    {
+        append_cbor_integer(value, output_);
+        return true;
+    }
+
+    bool number_unsigned(
+            number_unsigned_t value) override
+    {
+        append_head(MAJOR_UNSIGNED, value, output_);
+        return true;
+    }
+
+    bool number_float(
+            number_float_t value,
+            const string_t& /*text*/) override
+    {
+        append_float(value, output_);
+        return true;
+    }
+
+    bool string(
+            string_t& value) override
+    {
+        append_cbor_text(value.data(), value.size(), output_);
+        return true;
+    }
+
+    bool binary(
+            binary_t& /*value*/) override
+    {
+        // Not given by JSON documents
+        return false;
+    }
+
+    bool start_object(
+            std::size_t /*elements*/) override
+    {
+        output_.push_back(INDEFINITE_MAP);
+        return true;
+    }
+
+    bool key(
+            string_t& value) override
+    {
+        append_cbor_text(value.data(), value.size(), output_);
+        return true;
+    }
+
+    bool end_object() override
+    {
+        output_.push_back(BREAK);
+        return true;
+    }
+
+    bool start_array(
+            std::size_t /*elements*/) override
+    {
+        output_.push_back(INDEFINITE_ARRAY);
+        return true;
+    }
+
+    bool end_array() override
+    {
+        output_.push_back(BREAK);
+        return true;
+    }
+
+    bool parse_error(
+            std::size_t /*position*/,
+            const std::string& /*last_token*/,
+            const nlohmann::detail::exception& /*exception*/) override
+    {
+        return false;
+    }
+
+protected:
+
+    std::string& output_;
+};
+
+} /* namespace */
+
+void append_cbor_map(
+        std::size_t size,
+        std::string& output)
+{
+    append_head(MAJOR_MAP, size, output);
+}
+
+void append_cbor_text(
+        const char* chars,
+        std::size_t length,
+        std::string& output)
+{
+    append_head(MAJOR_TEXT, length, output);
+    output.append(chars, length);
+}
+
+void append_cbor_integer(
+        int64_t value,
+        std::string& output)
+{
+    if (value >= 0)
+    {
+        append_head(MAJOR_UNSIGNED, static_cast<uint64_t>(value), output);
+    }
+    else
+    {
+        // Negative integers are written as -1 - argument
+        append_head(MAJOR_NEGATIVE, static_cast<uint64_t>(-(value + 1)), output);
+    }
+}
+
+bool append_cbor_json(
+        const char* json,
+        std::size_t size,
+        std::string& output)
+{
+    const std::size_t initial_size = output.size();
+
+    CborSaxWriter writer(output);
+    if (!nlohmann::json::sax_parse(json, json + size, &writer))
+    {
+        output.resize(initial_size);
+        return false;
+    }
+    return true;
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,160 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <sstream>
+
+#include <fastddsspy_participants/visualization/cbor_utils.hpp>
+#include <fastddsspy_participants/visualization/compact_formats.hpp>
+#include <fastddsspy_participants/visualization/json_utils.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+namespace {
+
+constexpr const char* TOPIC_FIELD = "topic";
+constexpr const char* TYPE_FIELD = "type";
+constexpr const char* WRITER_FIELD = "writer";
+constexpr const char* SOURCE_TIMESTAMP_FIELD = "source_timestamp";
+constexpr const char* DATA_FIELD = "data";
+
+constexpr std::size_t RECORD_FIELDS = 5;
+
+//! Append a CSV field, quoted only if it holds a separator, a quote or a line break
+void append_csv_field(
+        const std::string& value,
+        std::string& output)
+{
+    if (value.find_first_of(",\"\r\n") == std::string::npos)
+    {
+        output.append(value);
+        return;
+    }
+
+    output.push_back('"');
+    std::size_t run_begin = 0;
+    for (std::size_t quote = value.find('"'); quote != std::string::npos; quote = value.find('"', quote + 1))
+    {
+        // Quotes are escaped by doubling them
+        output.append(value, run_begin, quote + 1 - run_begin);
+        output.push_back('"');
+        run_begin = quote + 1;
+    }
+    output.append(value, run_begin, std::string::npos);
+    output.push_back('"');
+}
+
+void append_cbor_key(
+        const char* key,
+        std::string& output)
+{
+    append_cbor_text(key, std::strlen(key), output);
+}
+
+} /* namespace */
+
+std::string compact_format_header(
+        CompactFormat format)
+{
+    if (format != CompactFormat::csv)
+    {
+        return "";
+    }
+
+    std::string header;
+    for (const char* field : {TOPIC_FIELD, TYPE_FIELD, WRITER_FIELD, SOURCE_TIMESTAMP_FIELD, DATA_FIELD})
+    {
+        if (!header.empty())
+        {
+            header.push_back(',');
+        }
+        header.append(field);
+    }
+    header.push_back('\n');
+    return header;
+}
+
+bool append_compact_record(
+        CompactFormat format,
+        const ddspipe::core::types::DdsTopic& topic,
+        const ddspipe::core::types::RtpsPayloadData& data,
+        const std::string& json,
+        std::string& output)
+{
+    std::ostringstream writer_ss;
+    writer_ss << data.source_guid;
+    const std::string writer = writer_ss.str();
+    const std::string source_timestamp = std::to_string(data.source_timestamp.to_ns());
+
+    switch (format)
+    {
+        case CompactFormat::ndjson:
+        {
+            output.append("{\"").append(TOPIC_FIELD).append("\":");
+            append_json_string(topic.m_topic_name.data(), topic.m_topic_name.size(), output);
+            output.append(",\"").append(TYPE_FIELD).append("\":");
+            append_json_string(topic.type_name.data(), topic.type_name.size(), output);
+            output.append(",\"").append(WRITER_FIELD).append("\":");
+            append_json_string(writer.data(), writer.size(), output);
+            output.append(",\"").append(SOURCE_TIMESTAMP_FIELD).append("\":").append(source_timestamp);
+            output.append(",\"").append(DATA_FIELD).append("\":").append(json);
+            output.append("}\n");
+            return true;
+        }
+
+        case CompactFormat::csv:
+        {
+            append_csv_field(topic.m_topic_name, output);
+            output.push_back(',');
+            append_csv_field(topic.type_name, output);
+            output.push_back(',');
+            append_csv_field(writer, output);
+            output.push_back(',');
+            output.append(source_timestamp);
+            output.push_back(',');
+            append_csv_field(json, output);
+            output.push_back('\n');
+            return true;
+        }
+
+        case CompactFormat::cbor:
+        {
+            const std::size_t initial_size = output.size();
+            append_cbor_map(RECORD_FIELDS, output);
+            append_cbor_key(TOPIC_FIELD, output);
+            append_cbor_text(topic.m_topic_name.data(), topic.m_topic_name.size(), output);
+            append_cbor_key(TYPE_FIELD, output);
+            append_cbor_text(topic.type_name.data(), topic.type_name.size(), output);
+            append_cbor_key(WRITER_FIELD, output);
+            append_cbor_text(writer.data(), writer.size(), output);
+            append_cbor_key(SOURCE_TIMESTAMP_FIELD, output);
+            append_cbor_integer(data.source_timestamp.to_ns(), output);
+            append_cbor_key(DATA_FIELD, output);
+            if (!append_cbor_json(json.data(), json.size(), output))
+            {
+                output.resize(initial_size);
+                return false;
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,138 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+
+#include <nlohmann/json.hpp>
+
+#include <fastddsspy_participants/visualization/json_utils.hpp>
+
+namespace eprosima {
+namespace spy {
+namespace participants {
+
+void append_json_string(
+        const char* chars,
+        std::size_t length,
+        std::string& output)
+{
+    static const char* const HEX_DIGITS = "0123456789abcdef";
+
+    output.push_back('"');
+
+    // Escape as nlohmann::json dump does, appending unescaped runs at once
+    std::size_t run_begin = 0;
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        const unsigned char c = static_cast<unsigned char>(chars[i]);
+        if (c >= 0x20 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+
+        output.append(chars + run_begin, i - run_begin);
+        run_begin = i + 1;
+
+        switch (c)
+        {
+            case '"':
+                output.append("\\\"");
+                break;
+            case '\\':
+                output.append("\\\\");
+                break;
+            case '\b':
+                output.append("\\b");
+                break;
+            case '\f':
+                output.append("\\f");
+                break;
+            case '\n':
+                output.append("\\n");
+                break;
+            case '\r':
+                output.append("\\r");
+                break;
+            case '\t':
+                output.append("\\t");
+                break;
+            default:
+            {
+                const char escaped[] = {'\\', 'u', '0', '0', HEX_DIGITS[c >> 4], HEX_DIGITS[c & 0x0F]};
+                output.append(escaped, sizeof(escaped));
+                break;
+            }
+        }
+    }
+    output.append(chars + run_begin, length - run_begin);
+
+    output.push_back('"');
+}
+
+void append_json_float(
+        double value,
+        std::string& output)
+{
+    if (!std::isfinite(value))
+    {
+        output.append("null");
+        return;
+    }
+
+    char buffer[64];
+    const char* end = nlohmann::detail::to_chars(buffer, buffer + sizeof(buffer), value);
+    output.append(buffer, static_cast<std::size_t>(end - buffer));
+}
+
+void append_compact_json(
+        const char* json,
+        std::size_t size,
+        std::string& output)
+{
+    // Copy the runs of text between whitespace, strings included
+    std::size_t run_begin = 0;
+    bool in_string = false;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const char c = json[i];
+        if (in_string)
+        {
+            if (c == '\\')
+            {
+                ++i;
+            }
+            else if (c == '"')
+            {
+                in_string = false;
+            }
+        }
+        else if (c == '"')
+        {
+            in_string = true;
+        }
+        else if (c == ' ' || c == '\n' || c == '\r' || c == '\t')
+        {
+            output.append(json + run_begin, i - run_begin);
+            run_begin = i + 1;
+        }
+    }
+    if (run_begin < size)
+    {
+        output.append(json + run_begin, size - run_begin);
+    }
+}
+
+} /* namespace participants */
+} /* namespace spy */
+} /* namespace eprosima */
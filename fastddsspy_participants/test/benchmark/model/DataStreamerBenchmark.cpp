@@ -0,0 +1,122 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+#include <fastdds/dds/xtypes/type_representation/detail/dds_xtypes_typeobject.hpp>
+
+#include <fastddsspy_participants/model/DataStreamer.hpp>
+
+using namespace eprosima;
+
+fastdds::dds::DynamicType::_ref_type create_schema(
+        ddspipe::core::types::DdsTopic& topic)
+{
+    fastdds::dds::TypeDescriptor::_ref_type type_descriptor {fastdds::dds::traits<fastdds::dds::TypeDescriptor>::
+                                                             make_shared()};
+    type_descriptor->name(topic.type_name);
+    fastdds::dds::DynamicTypeBuilder::_ref_type struct_builder {fastdds::dds::DynamicTypeBuilderFactory::get_instance()
+                                                                        ->create_type(type_descriptor)};
+    fastdds::dds::DynamicType::_ref_type dynamic_type_topic {struct_builder->build()};
+    return dynamic_type_topic;
+}
+
+/**
+ * Benchmark of the data of a topic added with its handle from an increasing number of writer threads.
+ *
+ * The handle is resolved once per thread, so adding data takes no lock of the streamer and the data added per second
+ * should grow with the threads, up to the cores of the machine.
+ */
+int main()
+{
+    constexpr unsigned int SAMPLES = 100000;
+
+    const unsigned int max_threads = std::max(1u, std::min(8u, std::thread::hardware_concurrency()));
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    double single_thread_throughput = 0;
+    for (unsigned int n_threads = 1; n_threads <= max_threads; n_threads *= 2)
+    {
+        spy::participants::DataStreamer ds;
+        fastdds::dds::xtypes::TypeIdentifier type_identifier;
+        ds.add_schema(create_schema(topic), type_identifier);
+
+        std::atomic<uint64_t> data_sent(0);
+        ds.subscribe_all(std::make_shared<spy::participants::DataStreamer::CallbackType>(
+                    [&data_sent]
+                        (const ddspipe::core::types::DdsTopic& topic,
+                    const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
+                    const ddspipe::core::types::RtpsPayloadData& data)
+                    {
+                        data_sent.fetch_add(1, std::memory_order_relaxed);
+                    }));
+
+        const auto start = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> threads;
+        for (unsigned int i = 0; i < n_threads; i++)
+        {
+            threads.emplace_back(
+                [&ds, &topic]()
+                {
+                    const auto handle = ds.acquire_topic_handle(topic);
+                    ddspipe::core::types::RtpsPayloadData data;
+                    data.payload.length = 100;
+                    for (unsigned int j = 0; j < SAMPLES; j++)
+                    {
+                        ds.add_data(*handle, data);
+                    }
+                    ds.release_topic_handle(handle);
+                });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        const std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+
+        if (data_sent != uint64_t(SAMPLES) * n_threads)
+        {
+            std::cerr << n_threads << " threads: " << data_sent << " data sent of "
+                      << uint64_t(SAMPLES) * n_threads << std::endl;
+            return 1;
+        }
+
+        const double throughput = SAMPLES * n_threads / seconds.count();
+        if (n_threads == 1)
+        {
+            single_thread_throughput = throughput;
+        }
+
+        std::cout << n_threads << " threads: " << static_cast<uint64_t>(throughput)
+                  << " data/s (x" << throughput / single_thread_throughput << ")" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <fastddsspy_participants/model/TopicRateCalculator.hpp>
+
+using namespace eprosima;
+
+namespace test {
+
+//! Calculator of the rates alone, without the types
+class TopicRateCalculator : public spy::participants::TopicRateCalculator
+{
+public:
+
+    void add_schema(
+            const fastdds::dds::DynamicType::_ref_type& dynamic_type,
+            const fastdds::dds::xtypes::TypeIdentifier& type_identifier) override
+    {
+    }
+
+};
+
+//! Run \c function in \c threads threads at once, returning the seconds until all of them finish
+template <typename Function>
+double run_threads(
+        unsigned int threads,
+        Function function)
+{
+    std::atomic<bool> start {false};
+    std::vector<std::thread> running;
+    for (unsigned int i = 0; i < threads; i++)
+    {
+        running.emplace_back(
+            [&start, &function, i]()
+            {
+                while (!start.load())
+                {
+                    std::this_thread::yield();
+                }
+                function(i);
+            });
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true);
+    for (auto& thread : running)
+    {
+        thread.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+} /* namespace test */
+
+/**
+ * Benchmark of live data added to the same topic and writer from an increasing number of threads.
+ *
+ * Each thread counts in its own shard, so the data added per second should grow linearly with the threads, up to
+ * the cores of the machine.
+ */
+int main()
+{
+    constexpr unsigned int SAMPLES = 200000;
+
+    const unsigned int max_threads = std::max(1u, std::min(8u, std::thread::hardware_concurrency()));
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    double single_thread_throughput = 0;
+    for (unsigned int threads = 1; threads <= max_threads; threads *= 2)
+    {
+        test::TopicRateCalculator calculator;
+
+        const double seconds = test::run_threads(
+            threads,
+            [&calculator, &topic](unsigned int)
+            {
+                ddspipe::core::types::RtpsPayloadData data;
+                data.payload.length = 100;
+                for (unsigned int i = 0; i < SAMPLES; i++)
+                {
+                    data.source_timestamp.from_ns(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::system_clock::now().time_since_epoch()).count());
+                    calculator.add_data(topic, data);
+                }
+            });
+
+        if (calculator.get_topic_traffic(topic).topic.payload_size.count != uint64_t(SAMPLES) * threads ||
+                calculator.get_topic_latency(topic).topic.count != uint64_t(SAMPLES) * threads)
+        {
+            std::cerr << threads << " threads: data added is not counted" << std::endl;
+            return 1;
+        }
+
+        const double throughput = SAMPLES * threads / seconds;
+        if (threads == 1)
+        {
+            single_thread_throughput = throughput;
+        }
+
+        std::cout << threads << " threads: " << static_cast<uint64_t>(throughput)
+                  << " data/s (x" << throughput / single_thread_throughput << ")" << std::endl;
+    }
+
+    return 0;
+}
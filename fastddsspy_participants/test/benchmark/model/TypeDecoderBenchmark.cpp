@@ -0,0 +1,195 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
+
+#include <fastddsspy_participants/testing/random_values.hpp>
+#include <fastddsspy_participants/testing/dynamic_types_utils.hpp>
+
+using namespace eprosima;
+using namespace eprosima::spy::participants;
+
+namespace test {
+
+void add_member(
+        const fastdds::dds::DynamicTypeBuilder::_ref_type& builder,
+        const std::string& name,
+        const fastdds::dds::DynamicType::_ref_type& type)
+{
+    auto member_desc = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
+    member_desc->name(name);
+    member_desc->type(type);
+    builder->add_member(member_desc);
+}
+
+fastdds::dds::DynamicType::_ref_type primitive(
+        fastdds::dds::TypeKind kind)
+{
+    return fastdds::dds::DynamicTypeBuilderFactory::get_instance()->get_primitive_type(kind);
+}
+
+fastdds::dds::DynamicTypeBuilder::_ref_type structure_builder(
+        const std::string& name)
+{
+    auto type_desc = fastdds::dds::traits<fastdds::dds::TypeDescriptor>::make_shared();
+    type_desc->kind(fastdds::dds::TK_STRUCTURE);
+    type_desc->name(name);
+    return fastdds::dds::DynamicTypeBuilderFactory::get_instance()->create_type(type_desc);
+}
+
+/**
+ * Large nested type:
+ *
+ * struct Point { double x; double y; double z; };
+ * struct Pose { Point position; Point orientation; string frame; };
+ * struct Scene { uint64 stamp; string name; Pose poses[8]; sequence<Point> cloud; sequence<float> ranges; };
+ */
+fastdds::dds::DynamicType::_ref_type nested_type(
+        fastdds::dds::DynamicType::_ref_type& point_type)
+{
+    auto factory = fastdds::dds::DynamicTypeBuilderFactory::get_instance();
+    auto string_type = factory->create_string_type(static_cast<uint32_t>(fastdds::dds::LENGTH_UNLIMITED))->build();
+
+    auto point_builder = structure_builder("Point");
+    add_member(point_builder, "x", primitive(fastdds::dds::TK_FLOAT64));
+    add_member(point_builder, "y", primitive(fastdds::dds::TK_FLOAT64));
+    add_member(point_builder, "z", primitive(fastdds::dds::TK_FLOAT64));
+    point_type = point_builder->build();
+
+    auto pose_builder = structure_builder("Pose");
+    add_member(pose_builder, "position", point_type);
+    add_member(pose_builder, "orientation", point_type);
+    add_member(pose_builder, "frame", string_type);
+    auto pose_type = pose_builder->build();
+
+    auto builder = structure_builder("Scene");
+    add_member(builder, "stamp", primitive(fastdds::dds::TK_UINT64));
+    add_member(builder, "name", string_type);
+    add_member(builder, "poses", factory->create_array_type(pose_type, {8})->build());
+    add_member(builder, "cloud",
+            factory->create_sequence_type(point_type, static_cast<uint32_t>(fastdds::dds::LENGTH_UNLIMITED))->build());
+    add_member(builder, "ranges",
+            factory->create_sequence_type(primitive(fastdds::dds::TK_FLOAT32),
+            static_cast<uint32_t>(fastdds::dds::LENGTH_UNLIMITED))->build());
+    return builder->build();
+}
+
+//! Serialized sample of \c nested_type, with 64 points in the cloud and 256 ranges
+std::unique_ptr<ddspipe::core::types::RtpsPayloadData> nested_data(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        const fastdds::dds::DynamicType::_ref_type& point_type)
+{
+    auto dyn_data = fastdds::dds::DynamicDataFactory::get_instance()->create_data(dyn_type);
+    dyn_data->set_uint64_value(dyn_data->get_member_id_by_name("stamp"), 1234567890);
+    dyn_data->set_string_value(dyn_data->get_member_id_by_name("name"), "scene");
+
+    auto cloud = dyn_data->loan_value(dyn_data->get_member_id_by_name("cloud"));
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        auto point = fastdds::dds::DynamicDataFactory::get_instance()->create_data(point_type);
+        point->set_float64_value(point->get_member_id_by_name("x"), i * 0.5);
+        cloud->set_complex_value(i, point);
+    }
+    dyn_data->return_loaned_value(cloud);
+
+    dyn_data->set_float32_values(dyn_data->get_member_id_by_name("ranges"), std::vector<float>(256, 1.5f));
+
+    fastdds::dds::DynamicPubSubType pubsub_type(dyn_type);
+
+    auto data = std::make_unique<ddspipe::core::types::RtpsPayloadData>();
+    data->payload.reserve(pubsub_type.calculate_serialized_size(
+                &dyn_data, fastdds::dds::DEFAULT_DATA_REPRESENTATION));
+    pubsub_type.serialize(&dyn_data, data->payload, fastdds::dds::DEFAULT_DATA_REPRESENTATION);
+    return data;
+}
+
+//! Samples per second \c decode is called with
+double throughput(
+        unsigned int samples,
+        const std::function<bool()>& decode)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < samples; i++)
+    {
+        if (!decode())
+        {
+            return 0;
+        }
+    }
+    const std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - start;
+    return samples / seconds.count();
+}
+
+/**
+ * Print the samples per second decoded building the type support and the data for every sample, as it was done
+ * before \c TypeDecoder, and with a decoder.
+ */
+void benchmark(
+        const std::string& type_description,
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        ddspipe::core::types::RtpsPayloadData& data,
+        unsigned int samples)
+{
+    const double before = throughput(samples, [&dyn_type, &data]()
+                    {
+                        fastdds::dds::DynamicPubSubType pubsub_type(dyn_type);
+                        auto dyn_data = fastdds::dds::DynamicDataFactory::get_instance()->create_data(dyn_type);
+                        return pubsub_type.deserialize(data.payload, &dyn_data);
+                    });
+
+    auto decoder = std::make_shared<TypeDecoder>(dyn_type);
+    const double after = throughput(samples, [&decoder, &data]()
+                    {
+                        return static_cast<bool>(decoder->deserialize(data));
+                    });
+
+    std::cout << type_description << ": " << static_cast<uint64_t>(before)
+              << " data/s per sample, " << static_cast<uint64_t>(after) << " data/s with decoder (x"
+              << after / before << ")" << std::endl;
+}
+
+} /* namespace test */
+
+/**
+ * Benchmark of the samples decoded per second without and with a decoder, for a simple and a large nested type.
+ */
+int main()
+{
+    auto simple_type = spy::participants::testing::create_test_type_with_keys("TestType", {"id"});
+    auto simple_data = spy::participants::testing::create_test_data_with_keys(
+        simple_type, {{"id", 100}}, ddspipe::core::testing::random_guid());
+    test::benchmark("simple type", simple_type, *simple_data, 100000);
+
+    fastdds::dds::DynamicType::_ref_type point_type;
+    auto nested_type = test::nested_type(point_type);
+    auto nested_data = test::nested_data(nested_type, point_type);
+    test::benchmark("nested type", nested_type, *nested_data, 10000);
+
+    return 0;
+}
@@ -0,0 +1,339 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+
+#include <fastddsspy_participants/cdr/ContentFilter.hpp>
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
+
+using namespace eprosima;
+using namespace eprosima::spy::participants;
+
+namespace test {
+
+void add_member(
+        const fastdds::dds::DynamicTypeBuilder::_ref_type& builder,
+        const std::string& name,
+        const fastdds::dds::DynamicType::_ref_type& type)
+{
+    auto member_desc = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
+    member_desc->name(name);
+    member_desc->type(type);
+    builder->add_member(member_desc);
+}
+
+fastdds::dds::DynamicType::_ref_type primitive(
+        fastdds::dds::TypeKind kind)
+{
+    return fastdds::dds::DynamicTypeBuilderFactory::get_instance()->get_primitive_type(kind);
+}
+
+fastdds::dds::DynamicTypeBuilder::_ref_type structure_builder(
+        const std::string& name,
+        fastdds::dds::ExtensibilityKind extensibility)
+{
+    auto type_desc = fastdds::dds::traits<fastdds::dds::TypeDescriptor>::make_shared();
+    type_desc->kind(fastdds::dds::TK_STRUCTURE);
+    type_desc->name(name);
+    type_desc->extensibility_kind(extensibility);
+    return fastdds::dds::DynamicTypeBuilderFactory::get_instance()->create_type(type_desc);
+}
+
+/**
+ * enum Level { OK, WARN, ERROR };
+ * struct Stamp { int32 sec; uint32 nanosec; };
+ * struct Header { Stamp stamp; string frame_id; };
+ * struct Reading {
+ *     Header header; int32 id; double value; boolean valid; char8 unit; string name; Level level;
+ *     sequence<int16> samples; uint64 counter;
+ * };
+ */
+fastdds::dds::DynamicType::_ref_type reading_type(
+        fastdds::dds::ExtensibilityKind extensibility = fastdds::dds::ExtensibilityKind::FINAL)
+{
+    auto factory = fastdds::dds::DynamicTypeBuilderFactory::get_instance();
+
+    auto enum_desc = fastdds::dds::traits<fastdds::dds::TypeDescriptor>::make_shared();
+    enum_desc->kind(fastdds::dds::TK_ENUM);
+    enum_desc->name("Level");
+    auto enum_builder = factory->create_type(enum_desc);
+    for (const char* literal : {"OK", "WARN", "ERROR"})
+    {
+        add_member(enum_builder, literal, primitive(fastdds::dds::TK_INT32));
+    }
+
+    auto string_type = factory->create_string_type(static_cast<uint32_t>(fastdds::dds::LENGTH_UNLIMITED))->build();
+
+    auto stamp_builder = structure_builder("Stamp", extensibility);
+    add_member(stamp_builder, "sec", primitive(fastdds::dds::TK_INT32));
+    add_member(stamp_builder, "nanosec", primitive(fastdds::dds::TK_UINT32));
+
+    auto header_builder = structure_builder("Header", extensibility);
+    add_member(header_builder, "stamp", stamp_builder->build());
+    add_member(header_builder, "frame_id", string_type);
+
+    auto builder = structure_builder("Reading", extensibility);
+    add_member(builder, "header", header_builder->build());
+    add_member(builder, "id", primitive(fastdds::dds::TK_INT32));
+    add_member(builder, "value", primitive(fastdds::dds::TK_FLOAT64));
+    add_member(builder, "valid", primitive(fastdds::dds::TK_BOOLEAN));
+    add_member(builder, "unit", primitive(fastdds::dds::TK_CHAR8));
+    add_member(builder, "name", string_type);
+    add_member(builder, "level", enum_builder->build());
+    add_member(builder, "samples",
+            factory->create_sequence_type(primitive(fastdds::dds::TK_INT16),
+            static_cast<uint32_t>(fastdds::dds::LENGTH_UNLIMITED))->build());
+    add_member(builder, "counter", primitive(fastdds::dds::TK_UINT64));
+    return builder->build();
+}
+
+std::unique_ptr<ddspipe::core::types::RtpsPayloadData> reading_payload(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        fastdds::dds::DataRepresentationId_t representation = fastdds::dds::XCDR2_DATA_REPRESENTATION)
+{
+    auto dyn_data = fastdds::dds::DynamicDataFactory::get_instance()->create_data(dyn_type);
+
+    auto header = dyn_data->loan_value(dyn_data->get_member_id_by_name("header"));
+    auto stamp = header->loan_value(header->get_member_id_by_name("stamp"));
+    stamp->set_int32_value(stamp->get_member_id_by_name("sec"), 1700000000);
+    stamp->set_uint32_value(stamp->get_member_id_by_name("nanosec"), 500);
+    header->return_loaned_value(stamp);
+    header->set_string_value(header->get_member_id_by_name("frame_id"), "base_link");
+    dyn_data->return_loaned_value(header);
+
+    dyn_data->set_int32_value(dyn_data->get_member_id_by_name("id"), -7);
+    dyn_data->set_float64_value(dyn_data->get_member_id_by_name("value"), 2.5);
+    dyn_data->set_boolean_value(dyn_data->get_member_id_by_name("valid"), true);
+    dyn_data->set_char8_value(dyn_data->get_member_id_by_name("unit"), 'm');
+    dyn_data->set_string_value(dyn_data->get_member_id_by_name("name"), "left_sensor");
+    dyn_data->set_int32_value(dyn_data->get_member_id_by_name("level"), 1);
+    dyn_data->set_int16_values(dyn_data->get_member_id_by_name("samples"), {1, 2, 3});
+    dyn_data->set_uint64_value(dyn_data->get_member_id_by_name("counter"), 18446744073709551615ull);
+
+    fastdds::dds::DynamicPubSubType pubsub_type(dyn_type);
+
+    auto data = std::make_unique<ddspipe::core::types::RtpsPayloadData>();
+    data->payload.reserve(pubsub_type.calculate_serialized_size(&dyn_data, representation));
+    pubsub_type.serialize(&dyn_data, data->payload, representation);
+    return data;
+}
+
+//! Filter \c expression compiled for \c decoder, failing the test if it is not valid
+std::shared_ptr<const cdr::ContentFilter> compile(
+        const TypeDecoder& decoder,
+        const std::string& expression)
+{
+    std::string error;
+    auto filter_expression = cdr::FilterExpression::parse(expression, error);
+    EXPECT_TRUE(filter_expression) << expression << ": " << error;
+    if (!filter_expression)
+    {
+        return nullptr;
+    }
+
+    auto filter = cdr::ContentFilter::compile(*filter_expression, decoder.layout(), error);
+    EXPECT_TRUE(filter) << expression << ": " << error;
+    return filter;
+}
+
+//! Check that the reading sample passes each expression in \c passed and no expression in \c rejected
+void check_filters(
+        const std::vector<std::string>& passed,
+        const std::vector<std::string>& rejected,
+        fastdds::dds::ExtensibilityKind extensibility = fastdds::dds::ExtensibilityKind::FINAL)
+{
+    auto dyn_type = reading_type(extensibility);
+    TypeDecoder decoder(dyn_type);
+    ASSERT_TRUE(decoder.layout());
+
+    for (const auto representation : {fastdds::dds::XCDR_DATA_REPRESENTATION,
+                                      fastdds::dds::XCDR2_DATA_REPRESENTATION})
+    {
+        auto data = reading_payload(dyn_type, representation);
+        for (const auto& expression : passed)
+        {
+            auto filter = compile(decoder, expression);
+            ASSERT_TRUE(filter);
+            ASSERT_TRUE(filter->evaluate(data->payload.data, data->payload.length)) << expression;
+        }
+        for (const auto& expression : rejected)
+        {
+            auto filter = compile(decoder, expression);
+            ASSERT_TRUE(filter);
+            ASSERT_FALSE(filter->evaluate(data->payload.data, data->payload.length)) << expression;
+        }
+    }
+}
+
+//! Check that \c expression is not valid, or cannot be compiled for the reading type
+void check_invalid(
+        const std::string& expression)
+{
+    TypeDecoder decoder(reading_type());
+
+    std::string error;
+    auto filter_expression = cdr::FilterExpression::parse(expression, error);
+    if (filter_expression)
+    {
+        ASSERT_FALSE(cdr::ContentFilter::compile(*filter_expression, decoder.layout(), error)) << expression;
+    }
+    ASSERT_FALSE(error.empty()) << expression;
+}
+
+} /* namespace test */
+
+/**
+ * Members of every primitive kind compare with constants and with each other.
+ */
+TEST(ContentFilterTest, comparisons)
+{
+    test::check_filters(
+        {"id = -7", "id <> 7", "id != 0", "id < 0", "id <= -7", "id > -8", "id >= -7", "-8 < id",
+         "value = 2.5", "value > 2", "id < value", "valid = TRUE", "valid <> false",
+         "unit = 'm'", "name = 'left_sensor'", "name > 'left'", "name < 'right'",
+         "counter > 9223372036854775807", "counter > 1e19", "id = 0xFFFFFFF9 OR id = -0x7"},
+        {"id = 7", "id > 0", "value < 2.5", "valid = FALSE", "unit = 'n'", "name = 'left'", "name = ''",
+         "counter < 0"});
+}
+
+/**
+ * AND, OR and NOT follow the SQL precedence, and parentheses change it.
+ */
+TEST(ContentFilterTest, logical_operators)
+{
+    test::check_filters(
+        {"id = -7 AND value = 2.5", "id = 7 OR value = 2.5", "NOT id = 7", "NOT (id = 7 OR value = 3)",
+         "id = 7 AND value = 3 OR valid = TRUE", "id = 7 OR id = 8 OR id = 9 OR id = -7",
+         "(id = -7 OR id = 8) AND (value > 2 AND (name = 'x' OR unit = 'm'))", "id = -7 and not value = 3"},
+        {"id = -7 AND value = 3", "id = 7 OR value = 3", "NOT id = -7", "id = 7 AND (value = 2.5 OR valid = TRUE)",
+         "NOT (id = -7 AND valid = TRUE)", "NOT NOT id = 7"});
+}
+
+/**
+ * LIKE matches % with any characters and _ with one, BETWEEN includes both ends.
+ */
+TEST(ContentFilterTest, like_and_between)
+{
+    test::check_filters(
+        {"name LIKE 'left_sensor'", "name LIKE 'left%'", "name LIKE '%sensor'", "name LIKE '%t_s%'",
+         "name LIKE '%'", "name LIKE 'l_ft%r'", "unit LIKE 'm'", "id BETWEEN -7 AND 0", "value BETWEEN 2 AND 2.5",
+         "id NOT BETWEEN 0 AND 10", "name BETWEEN 'a' AND 'm'"},
+        {"name LIKE 'left'", "name LIKE '%left'", "name LIKE 'l_ft'", "name LIKE '%x%'", "id BETWEEN 0 AND 10",
+         "id NOT BETWEEN -10 AND -7", "value BETWEEN 2.6 AND 3"});
+}
+
+/**
+ * Enumerations compare with the names of their literals and with numbers.
+ */
+TEST(ContentFilterTest, enumeration_literals)
+{
+    test::check_filters(
+        {"level = 'WARN'", "level <> 'OK'", "level > 'OK'", "level < 'ERROR'", "level = 1",
+         "level BETWEEN 'OK' AND 'WARN'"},
+        {"level = 'OK'", "level = 'ERROR'", "level >= 'ERROR'", "level = 2"});
+}
+
+/**
+ * Members of nested structures are reached through their paths.
+ */
+TEST(ContentFilterTest, nested_members)
+{
+    test::check_filters(
+        {"header.stamp.sec = 1700000000", "header.stamp.nanosec < 1000", "header.frame_id = 'base_link'",
+         "header.stamp.sec > 0 AND header.frame_id LIKE 'base%' AND counter > 0"},
+        {"header.stamp.sec < 1700000000", "header.frame_id = 'map'"});
+}
+
+/**
+ * Appendable structures, delimited in XCDR2, are filtered as final ones.
+ */
+TEST(ContentFilterTest, appendable_type)
+{
+    test::check_filters(
+        {"header.stamp.nanosec = 500 AND name = 'left_sensor' AND counter > 0", "level = 'WARN'"},
+        {"header.frame_id = 'map'", "header.stamp.sec = 0 OR id = 7"},
+        fastdds::dds::ExtensibilityKind::APPENDABLE);
+}
+
+/**
+ * Expressions that do not follow the grammar are not valid.
+ */
+TEST(ContentFilterTest, invalid_expressions)
+{
+    for (const std::string expression : {"", "id", "id =", "id = 1 AND", "(id = 1", "id = 1)", "id == 1",
+                                         "id = %0", "id = 'unterminated", "id = 1x", "id BETWEEN 1", "a..b = 1",
+                                         "id LIKE", "NOT", "id = 1 id = 2"})
+    {
+        test::check_invalid(expression);
+    }
+
+    // Nesting is limited so that no expression can exhaust the stack
+    test::check_invalid(std::string(100, '(') + "id = 1" + std::string(100, ')'));
+}
+
+/**
+ * Fields must be primitive, string or enumeration members, compared with operands of the same kind.
+ */
+TEST(ContentFilterTest, invalid_fields)
+{
+    for (const std::string expression : {"missing = 1", "header = 1", "header.missing = 1", "samples = 1",
+                                         "id.x = 1", "name = 1", "id = 'a'", "valid = 1", "level = 'DEBUG'",
+                                         "id LIKE 'a'", "name LIKE 1", "id BETWEEN 'a' AND 'b'"})
+    {
+        test::check_invalid(expression);
+    }
+}
+
+/**
+ * Payloads that cannot be read do not pass the filter.
+ */
+TEST(ContentFilterTest, invalid_payload)
+{
+    auto dyn_type = test::reading_type();
+    TypeDecoder decoder(dyn_type);
+    auto data = test::reading_payload(dyn_type);
+
+    auto filter = test::compile(decoder, "name = 'left_sensor'");
+    ASSERT_TRUE(filter);
+    ASSERT_TRUE(filter->evaluate(data->payload.data, data->payload.length));
+
+    for (std::size_t size : {0u, 3u, 8u, 24u})
+    {
+        ASSERT_FALSE(filter->evaluate(data->payload.data, size));
+    }
+
+    // Expressions with no fields do not read the payload
+    filter = test::compile(decoder, "1 = 1");
+    ASSERT_TRUE(filter);
+    ASSERT_TRUE(filter->evaluate(data->payload.data, 0));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,504 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+
+#include <fastddsspy_participants/model/BoundedQueue.hpp>
+#include <fastddsspy_participants/model/DataDispatcher.hpp>
+
+using namespace eprosima;
+using namespace eprosima::spy::participants;
+
+namespace test {
+
+constexpr std::size_t QUEUE_SIZE = 4;
+
+ddspipe::core::types::DdsTopic create_topic(
+        const std::string& topic_name)
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = topic_name;
+    topic.type_name = "type1";
+    return topic;
+}
+
+//! Sample whose single payload byte identifies it
+void fill_data(
+        ddspipe::core::types::RtpsPayloadData& data,
+        uint8_t id)
+{
+    data.payload.reserve(1);
+    data.payload.data[0] = id;
+    data.payload.length = 1;
+}
+
+/**
+ * Callback that blocks on the first sample until released, so the queue can be filled.
+ * Stores the ids of the samples received.
+ */
+class BlockingCallback
+{
+public:
+
+    std::shared_ptr<DataStreamer::CallbackType> callback()
+    {
+        return std::make_shared<DataStreamer::CallbackType>(
+            [this](
+                const ddspipe::core::types::DdsTopic&,
+                const std::shared_ptr<TypeDecoder>&,
+                const ddspipe::core::types::RtpsPayloadData& data)
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                received.push_back(data.payload.data[0]);
+                cv.notify_all();
+                cv.wait(lock, [this]()
+                {
+                    return released;
+                });
+            });
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> _(mutex);
+        released = true;
+        cv.notify_all();
+    }
+
+    void wait_received(
+            std::size_t n)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this, n]()
+                {
+                    return received.size() >= n;
+                });
+    }
+
+    std::vector<uint8_t> received;
+    bool released {false};
+    std::mutex mutex;
+    std::condition_variable cv;
+};
+
+} /* namespace test */
+
+/**
+ * Capacity is rounded to a power of two and the queue keeps FIFO order.
+ */
+TEST(DataDispatcherTest, bounded_queue)
+{
+    BoundedQueue<int> queue(test::QUEUE_SIZE + 1);
+    ASSERT_EQ(queue.capacity(), 2 * test::QUEUE_SIZE);
+    ASSERT_TRUE(queue.empty());
+
+    for (int i = 0; i < static_cast<int>(queue.capacity()); i++)
+    {
+        ASSERT_TRUE(queue.try_push(std::move(i)));
+    }
+    int value = -1;
+    ASSERT_FALSE(queue.try_push(std::move(value)));
+    ASSERT_EQ(queue.size(), queue.capacity());
+
+    for (int i = 0; i < static_cast<int>(queue.capacity()); i++)
+    {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+}
+
+/**
+ * Every sample pushed reaches the callback, in order, from a thread other than the producer.
+ */
+TEST(DataDispatcherTest, dispatch_in_order)
+{
+    DataDispatcher dispatcher(test::QUEUE_SIZE, DropPolicy::block);
+    auto topic = test::create_topic("topic1");
+
+    std::vector<uint8_t> received;
+    std::mutex mutex;
+    std::condition_variable cv;
+    const std::thread::id producer_id = std::this_thread::get_id();
+    std::atomic<bool> same_thread(false);
+
+    dispatcher.start(std::make_shared<DataStreamer::CallbackType>(
+                [&](
+                    const ddspipe::core::types::DdsTopic&,
+                    const std::shared_ptr<TypeDecoder>&,
+                    const ddspipe::core::types::RtpsPayloadData& data)
+                {
+                    if (std::this_thread::get_id() == producer_id)
+                    {
+                        same_thread = true;
+                    }
+                    std::lock_guard<std::mutex> _(mutex);
+                    received.push_back(data.payload.data[0]);
+                    cv.notify_all();
+                }));
+
+    constexpr uint8_t N_SAMPLES = 100;
+    for (uint8_t i = 0; i < N_SAMPLES; i++)
+    {
+        ddspipe::core::types::RtpsPayloadData data;
+        test::fill_data(data, i);
+        dispatcher.push(topic, nullptr, data);
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]()
+                {
+                    return received.size() == N_SAMPLES;
+                });
+    }
+    dispatcher.stop();
+
+    ASSERT_FALSE(same_thread);
+    for (uint8_t i = 0; i < N_SAMPLES; i++)
+    {
+        ASSERT_EQ(received[i], i);
+    }
+    ASSERT_TRUE(dispatcher.dropped_samples().empty());
+}
+
+/**
+ * With several threads, each topic is processed by a single thread and keeps its order, and each thread calls its
+ * own callback.
+ */
+TEST(DataDispatcherTest, dispatch_in_order_threads)
+{
+    constexpr std::size_t N_THREADS = 3;
+    constexpr uint8_t N_TOPICS = 8;
+    constexpr uint8_t N_SAMPLES = 50;
+
+    DataDispatcher dispatcher(test::QUEUE_SIZE, DropPolicy::block, N_THREADS);
+    ASSERT_EQ(dispatcher.threads(), N_THREADS);
+
+    std::map<std::string, std::vector<uint8_t>> received;
+    std::map<std::string, std::set<std::thread::id>> topic_threads;
+    std::vector<std::set<std::thread::id>> callback_threads(N_THREADS);
+    std::size_t n_received = 0;
+    std::mutex mutex;
+    std::condition_variable cv;
+
+    std::vector<std::shared_ptr<DataStreamer::CallbackType>> callbacks;
+    for (std::size_t i = 0; i < N_THREADS; i++)
+    {
+        callbacks.push_back(std::make_shared<DataStreamer::CallbackType>(
+                    [&, i](
+                        const ddspipe::core::types::DdsTopic& topic,
+                        const std::shared_ptr<TypeDecoder>&,
+                        const ddspipe::core::types::RtpsPayloadData& data)
+                    {
+                        std::lock_guard<std::mutex> _(mutex);
+                        received[topic.m_topic_name].push_back(data.payload.data[0]);
+                        topic_threads[topic.m_topic_name].insert(std::this_thread::get_id());
+                        callback_threads[i].insert(std::this_thread::get_id());
+                        n_received++;
+                        cv.notify_all();
+                    }));
+    }
+
+    // One callback per thread is required
+    ASSERT_FALSE(dispatcher.start(std::vector<std::shared_ptr<DataStreamer::CallbackType>>(1, callbacks.front())));
+    ASSERT_TRUE(dispatcher.start(callbacks));
+
+    std::vector<ddspipe::core::types::DdsTopic> topics;
+    for (uint8_t t = 0; t < N_TOPICS; t++)
+    {
+        topics.push_back(test::create_topic("topic" + std::to_string(t)));
+    }
+    for (uint8_t i = 0; i < N_SAMPLES; i++)
+    {
+        for (const auto& topic : topics)
+        {
+            ddspipe::core::types::RtpsPayloadData data;
+            test::fill_data(data, i);
+            dispatcher.push(topic, nullptr, data);
+        }
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]()
+                {
+                    return n_received == N_TOPICS * N_SAMPLES;
+                });
+    }
+    dispatcher.stop();
+
+    std::set<std::thread::id> all_threads;
+    for (const auto& threads : callback_threads)
+    {
+        ASSERT_LE(threads.size(), 1u);
+        for (const auto& thread : threads)
+        {
+            ASSERT_TRUE(all_threads.insert(thread).second);
+        }
+    }
+
+    ASSERT_EQ(received.size(), N_TOPICS);
+    for (const auto& topic_received : received)
+    {
+        ASSERT_EQ(topic_threads[topic_received.first].size(), 1u);
+        ASSERT_EQ(topic_received.second.size(), N_SAMPLES);
+        for (uint8_t i = 0; i < N_SAMPLES; i++)
+        {
+            ASSERT_EQ(topic_received.second[i], i);
+        }
+    }
+    ASSERT_TRUE(dispatcher.dropped_samples().empty());
+}
+
+/**
+ * When full, new samples are discarded and counted under their topic.
+ */
+TEST(DataDispatcherTest, drop_newest)
+{
+    DataDispatcher dispatcher(test::QUEUE_SIZE, DropPolicy::drop_newest);
+    auto topic_1 = test::create_topic("topic1");
+    auto topic_2 = test::create_topic("topic2");
+
+    test::BlockingCallback callback;
+    dispatcher.start(callback.callback());
+
+    // First sample is held by the callback, next ones fill the queue
+    ddspipe::core::types::RtpsPayloadData data;
+    test::fill_data(data, 0);
+    dispatcher.push(topic_1, nullptr, data);
+    callback.wait_received(1);
+
+    for (uint8_t i = 1; i <= test::QUEUE_SIZE; i++)
+    {
+        test::fill_data(data, i);
+        dispatcher.push(topic_1, nullptr, data);
+    }
+
+    // These do not fit
+    test::fill_data(data, 100);
+    dispatcher.push(topic_1, nullptr, data);
+    dispatcher.push(topic_2, nullptr, data);
+    dispatcher.push(topic_2, nullptr, data);
+
+    callback.release();
+    callback.wait_received(test::QUEUE_SIZE + 1);
+    dispatcher.stop();
+
+    std::vector<uint8_t> expected {0, 1, 2, 3, 4};
+    ASSERT_EQ(callback.received, expected);
+
+    auto dropped = dispatcher.dropped_samples();
+    ASSERT_EQ(dropped.size(), 2u);
+    ASSERT_EQ(dropped["topic1"], 1u);
+    ASSERT_EQ(dropped["topic2"], 2u);
+}
+
+/**
+ * When full, the oldest queued samples are discarded and counted under their topic.
+ */
+TEST(DataDispatcherTest, drop_oldest)
+{
+    DataDispatcher dispatcher(test::QUEUE_SIZE, DropPolicy::drop_oldest);
+    auto topic_1 = test::create_topic("topic1");
+    auto topic_2 = test::create_topic("topic2");
+
+    test::BlockingCallback callback;
+    dispatcher.start(callback.callback());
+
+    ddspipe::core::types::RtpsPayloadData data;
+    test::fill_data(data, 0);
+    dispatcher.push(topic_1, nullptr, data);
+    callback.wait_received(1);
+
+    for (uint8_t i = 1; i <= test::QUEUE_SIZE; i++)
+    {
+        test::fill_data(data, i);
+        dispatcher.push(topic_1, nullptr, data);
+    }
+
+    // These replace samples 1 and 2
+    test::fill_data(data, 5);
+    dispatcher.push(topic_2, nullptr, data);
+    test::fill_data(data, 6);
+    dispatcher.push(topic_2, nullptr, data);
+
+    callback.release();
+    callback.wait_received(test::QUEUE_SIZE + 1);
+    dispatcher.stop();
+
+    std::vector<uint8_t> expected {0, 3, 4, 5, 6};
+    ASSERT_EQ(callback.received, expected);
+
+    auto dropped = dispatcher.dropped_samples();
+    ASSERT_EQ(dropped.size(), 1u);
+    ASSERT_EQ(dropped["topic1"], 2u);
+}
+
+/**
+ * The sample passed to the callback keeps the metadata of the one pushed.
+ */
+TEST(DataDispatcherTest, keep_metadata)
+{
+    DataDispatcher dispatcher(test::QUEUE_SIZE, DropPolicy::block);
+    auto topic = test::create_topic("topic1");
+
+    std::atomic<bool> received(false);
+    fastdds::rtps::SequenceNumber_t sequence_number;
+    fastdds::rtps::ChangeKind_t kind = fastdds::rtps::ALIVE;
+    dispatcher.start(std::make_shared<DataStreamer::CallbackType>(
+                [&](
+                    const ddspipe::core::types::DdsTopic&,
+                    const std::shared_ptr<TypeDecoder>&,
+                    const ddspipe::core::types::RtpsPayloadData& data)
+                {
+                    sequence_number = data.origin_sequence_number;
+                    kind = data.kind;
+                    received = true;
+                }));
+
+    ddspipe::core::types::RtpsPayloadData data;
+    test::fill_data(data, 0);
+    data.origin_sequence_number = fastdds::rtps::SequenceNumber_t(42);
+    data.kind = fastdds::rtps::NOT_ALIVE_DISPOSED;
+    dispatcher.push(topic, nullptr, data);
+
+    while (!received)
+    {
+        std::this_thread::yield();
+    }
+    dispatcher.stop();
+
+    ASSERT_EQ(sequence_number, fastdds::rtps::SequenceNumber_t(42));
+    ASSERT_EQ(kind, fastdds::rtps::NOT_ALIVE_DISPOSED);
+}
+
+/**
+ * Samples pushed while stopped are ignored, and a restart clears the drop counters.
+ */
+TEST(DataDispatcherTest, stop_and_restart)
+{
+    DataDispatcher dispatcher(test::QUEUE_SIZE, DropPolicy::drop_newest);
+    auto topic = test::create_topic("topic1");
+
+    std::atomic<uint32_t> received(0);
+    auto callback = std::make_shared<DataStreamer::CallbackType>(
+        [&received](
+            const ddspipe::core::types::DdsTopic&,
+            const std::shared_ptr<TypeDecoder>&,
+            const ddspipe::core::types::RtpsPayloadData&)
+        {
+            received++;
+        });
+
+    ddspipe::core::types::RtpsPayloadData data;
+    test::fill_data(data, 0);
+
+    // Not started
+    dispatcher.push(topic, nullptr, data);
+
+    ASSERT_TRUE(dispatcher.start(callback));
+    ASSERT_FALSE(dispatcher.start(callback));
+    dispatcher.stop();
+
+    ASSERT_EQ(received, 0u);
+
+    ASSERT_TRUE(dispatcher.start(callback));
+    dispatcher.push(topic, nullptr, data);
+    while (received == 0u)
+    {
+        std::this_thread::yield();
+    }
+    dispatcher.stop();
+
+    ASSERT_EQ(received, 1u);
+    ASSERT_TRUE(dispatcher.dropped_samples().empty());
+}
+
+/**
+ * Samples pushed while the dispatcher stops are discarded, and every payload is given back to its pool.
+ */
+TEST(DataDispatcherTest, stop_while_pushing)
+{
+    constexpr unsigned int PRODUCERS = 4;
+    constexpr unsigned int RESTARTS = 100;
+
+    auto payload_pool = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    {
+        DataDispatcher dispatcher(test::QUEUE_SIZE, DropPolicy::drop_oldest);
+        auto topic = test::create_topic("topic1");
+
+        auto callback = std::make_shared<DataStreamer::CallbackType>(
+            [](
+                const ddspipe::core::types::DdsTopic&,
+                const std::shared_ptr<TypeDecoder>&,
+                const ddspipe::core::types::RtpsPayloadData&)
+            {
+            });
+
+        std::atomic<bool> pushing(true);
+        std::vector<std::thread> producers;
+        for (unsigned int i = 0; i < PRODUCERS; i++)
+        {
+            producers.emplace_back(
+                [&]()
+                {
+                    while (pushing)
+                    {
+                        ddspipe::core::types::RtpsPayloadData data;
+                        ASSERT_TRUE(payload_pool->get_payload(1, data.payload));
+                        data.payload_owner = payload_pool.get();
+                        data.payload.data[0] = 0;
+                        data.payload.length = 1;
+                        dispatcher.push(topic, nullptr, data);
+                    }
+                });
+        }
+
+        for (unsigned int i = 0; i < RESTARTS; i++)
+        {
+            ASSERT_TRUE(dispatcher.start(callback));
+            std::this_thread::yield();
+            dispatcher.stop();
+        }
+
+        pushing = false;
+        for (auto& producer : producers)
+        {
+            producer.join();
+        }
+    }
+
+    ASSERT_TRUE(payload_pool->is_clean());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
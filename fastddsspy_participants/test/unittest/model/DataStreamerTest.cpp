@@ -12,9 +12,17 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
@@ -73,7 +81,7 @@ TEST(DataStreamerTest, deactivate)
             std::make_shared<spy::participants::DataStreamer::CallbackType>(
         [&data_sent]
             (const ddspipe::core::types::DdsTopic& topic,
-        const fastdds::dds::DynamicType::_ref_type& type,
+        const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
         const ddspipe::core::types::RtpsPayloadData& data)
         {
             data_sent++;
@@ -126,7 +134,7 @@ TEST(DataStreamerTest, add_data)
             std::make_shared<spy::participants::DataStreamer::CallbackType>(
         [&data_sent]
             (const ddspipe::core::types::DdsTopic& topic,
-        const fastdds::dds::DynamicType::_ref_type& type,
+        const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
         const ddspipe::core::types::RtpsPayloadData& data)
         {
             data_sent++;
@@ -170,7 +178,7 @@ TEST(DataStreamerTest, add_data_two_topics)
             std::make_shared<spy::participants::DataStreamer::CallbackType>(
         [&data_sent_1]
             (const ddspipe::core::types::DdsTopic& topic,
-        const fastdds::dds::DynamicType::_ref_type& type,
+        const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
         const ddspipe::core::types::RtpsPayloadData& data)
         {
             data_sent_1++;
@@ -198,7 +206,7 @@ TEST(DataStreamerTest, add_data_two_topics)
             std::make_shared<spy::participants::DataStreamer::CallbackType>(
         [&data_sent_2]
             (const ddspipe::core::types::DdsTopic& topic,
-        const fastdds::dds::DynamicType::_ref_type& type,
+        const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
         const ddspipe::core::types::RtpsPayloadData& data)
         {
             data_sent_2++;
@@ -236,6 +244,648 @@ TEST(DataStreamerTest, add_data_two_topics)
     ASSERT_EQ(data_sent_2, rand_2);
 }
 
+/**
+ * Data left out by the throttle does not reach the callback and is counted as suppressed.
+ */
+TEST(DataStreamerTest, add_data_throttled)
+{
+    spy::participants::DataStreamer ds;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    std::atomic<uint32_t> data_sent(0);
+
+    std::shared_ptr<spy::participants::DataStreamer::CallbackType> cb =
+            std::make_shared<spy::participants::DataStreamer::CallbackType>(
+        [&data_sent]
+            (const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
+        const ddspipe::core::types::RtpsPayloadData& data)
+        {
+            data_sent++;
+        });
+
+    fastdds::dds::DynamicType::_ref_type dynamic_type_topic;
+    dynamic_type_topic = create_schema(topic);
+
+    fastdds::dds::xtypes::TypeIdentifier type_identifier;
+    ds.add_schema(dynamic_type_topic, type_identifier);
+
+    // Keep one of every 4 samples
+    auto throttle = std::make_shared<spy::participants::SampleThrottle>(
+        spy::participants::SampleThrottle::UNLIMITED_RATE, 4);
+    ds.activate_all(cb, throttle);
+
+    ddspipe::core::types::RtpsPayloadData data;
+
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        ds.add_data(topic, data);
+    }
+
+    ASSERT_EQ(data_sent, 3u);
+    ASSERT_EQ(throttle->suppressed_samples().at("topic1"), 7u);
+}
+
+/**
+ * Every subscription receives the data of the topics it is subscribed to, independently of the others.
+ */
+TEST(DataStreamerTest, subscribe_multiple)
+{
+    spy::participants::DataStreamer ds;
+
+    ddspipe::core::types::DdsTopic topic_1;
+    topic_1.m_topic_name = "topic1";
+    topic_1.type_name = "type1";
+
+    ddspipe::core::types::DdsTopic topic_2;
+    topic_2.m_topic_name = "topic2";
+    topic_2.type_name = "type2";
+
+    fastdds::dds::xtypes::TypeIdentifier type_identifier;
+    ds.add_schema(create_schema(topic_1), type_identifier);
+    ds.add_schema(create_schema(topic_2), type_identifier);
+
+    std::atomic<uint32_t> data_sent_1(0);
+    std::atomic<uint32_t> data_sent_2(0);
+    std::atomic<uint32_t> data_sent_all(0);
+
+    const auto counter = [](std::atomic<uint32_t>& data_sent)
+            {
+                return std::make_shared<spy::participants::DataStreamer::CallbackType>(
+                    [&data_sent]
+                        (const ddspipe::core::types::DdsTopic& topic,
+                    const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
+                    const ddspipe::core::types::RtpsPayloadData& data)
+                    {
+                        data_sent++;
+                    });
+            };
+
+    ddspipe::core::types::WildcardDdsFilterTopic filter_topic_1;
+    filter_topic_1.topic_name = topic_1.m_topic_name;
+    filter_topic_1.type_name = topic_1.type_name;
+
+    ddspipe::core::types::WildcardDdsFilterTopic filter_topic_2;
+    filter_topic_2.topic_name = topic_2.m_topic_name;
+    filter_topic_2.type_name = topic_2.type_name;
+
+    const auto handle_1 = ds.subscribe(filter_topic_1, counter(data_sent_1));
+    const auto handle_2 = ds.subscribe(filter_topic_2, counter(data_sent_2));
+    const auto handle_all = ds.subscribe_all(counter(data_sent_all));
+
+    ASSERT_NE(handle_1, spy::participants::DataStreamer::INVALID_SUBSCRIPTION);
+    ASSERT_NE(handle_2, spy::participants::DataStreamer::INVALID_SUBSCRIPTION);
+    ASSERT_NE(handle_all, spy::participants::DataStreamer::INVALID_SUBSCRIPTION);
+    ASSERT_NE(handle_1, handle_2);
+    ASSERT_NE(handle_2, handle_all);
+
+    // Activating does not replace the subscriptions
+    uint32_t data_sent_activated = 0;
+    ds.activate(filter_topic_1, std::make_shared<spy::participants::DataStreamer::CallbackType>(
+                [&data_sent_activated]
+                    (const ddspipe::core::types::DdsTopic& topic,
+                const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
+                const ddspipe::core::types::RtpsPayloadData& data)
+                {
+                    data_sent_activated++;
+                }));
+
+    ddspipe::core::types::RtpsPayloadData data;
+
+    for (unsigned int i = 0; i < 3; i++)
+    {
+        ds.add_data(topic_1, data);
+    }
+
+    for (unsigned int i = 0; i < 5; i++)
+    {
+        ds.add_data(topic_2, data);
+    }
+
+    ASSERT_EQ(data_sent_1, 3u);
+    ASSERT_EQ(data_sent_2, 5u);
+    ASSERT_EQ(data_sent_all, 8u);
+    ASSERT_EQ(data_sent_activated, 3u);
+
+    // Deactivating does not remove the subscriptions
+    ds.deactivate();
+    ds.add_data(topic_1, data);
+
+    ASSERT_EQ(data_sent_1, 4u);
+    ASSERT_EQ(data_sent_all, 9u);
+    ASSERT_EQ(data_sent_activated, 3u);
+}
+
+/**
+ * An unsubscribed callback does not receive any more data, while the other subscriptions keep receiving it.
+ */
+TEST(DataStreamerTest, unsubscribe)
+{
+    spy::participants::DataStreamer ds;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    fastdds::dds::xtypes::TypeIdentifier type_identifier;
+    ds.add_schema(create_schema(topic), type_identifier);
+
+    std::atomic<uint32_t> data_sent_1(0);
+    std::atomic<uint32_t> data_sent_2(0);
+
+    const auto handle_1 = ds.subscribe_all(std::make_shared<spy::participants::DataStreamer::CallbackType>(
+                        [&data_sent_1]
+                            (const ddspipe::core::types::DdsTopic& topic,
+                        const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
+                        const ddspipe::core::types::RtpsPayloadData& data)
+                        {
+                            data_sent_1++;
+                        }));
+    const auto handle_2 = ds.subscribe_all(std::make_shared<spy::participants::DataStreamer::CallbackType>(
+                        [&data_sent_2]
+                            (const ddspipe::core::types::DdsTopic& topic,
+                        const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
+                        const ddspipe::core::types::RtpsPayloadData& data)
+                        {
+                            data_sent_2++;
+                        }));
+
+    ddspipe::core::types::RtpsPayloadData data;
+    ds.add_data(topic, data);
+
+    ASSERT_TRUE(ds.unsubscribe(handle_1));
+    ASSERT_FALSE(ds.unsubscribe(handle_1));
+    ASSERT_FALSE(ds.unsubscribe(spy::participants::DataStreamer::INVALID_SUBSCRIPTION));
+
+    ds.add_data(topic, data);
+
+    ASSERT_EQ(data_sent_1, 1u);
+    ASSERT_EQ(data_sent_2, 2u);
+
+    ASSERT_TRUE(ds.unsubscribe(handle_2));
+    ds.add_data(topic, data);
+
+    ASSERT_EQ(data_sent_2, 2u);
+
+    // A subscription without callback is not added
+    ASSERT_EQ(ds.subscribe_all(nullptr), spy::participants::DataStreamer::INVALID_SUBSCRIPTION);
+}
+
+/**
+ * Data received before the type of its topic is discovered is not delivered, and the data received after it is.
+ */
+TEST(DataStreamerTest, add_data_before_schema)
+{
+    spy::participants::DataStreamer ds;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    std::atomic<uint32_t> data_sent(0);
+
+    ds.subscribe_all(std::make_shared<spy::participants::DataStreamer::CallbackType>(
+                [&data_sent]
+                    (const ddspipe::core::types::DdsTopic& topic,
+                const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
+                const ddspipe::core::types::RtpsPayloadData& data)
+                {
+                    ASSERT_NE(decoder, nullptr);
+                    data_sent++;
+                }));
+
+    ddspipe::core::types::RtpsPayloadData data;
+    ds.add_data(topic, data);
+    ds.add_data(topic, data);
+
+    ASSERT_EQ(data_sent, 0u);
+
+    fastdds::dds::xtypes::TypeIdentifier type_identifier;
+    ds.add_schema(create_schema(topic), type_identifier);
+
+    ds.add_data(topic, data);
+
+    ASSERT_EQ(data_sent, 1u);
+
+    // The data received before the type is discovered is counted in the rate anyway
+    ASSERT_NE(ds.get_topic_rate(topic), 0);
+}
+
+/**
+ * Data of several topics added from several threads at once is all delivered to the right subscriptions.
+ */
+TEST(DataStreamerTest, add_data_concurrent)
+{
+    constexpr unsigned int THREADS = 4;
+    constexpr unsigned int SAMPLES = 1000;
+
+    spy::participants::DataStreamer ds;
+
+    std::vector<ddspipe::core::types::DdsTopic> topics(THREADS);
+    std::vector<std::atomic<uint32_t>> data_sent(THREADS);
+
+    fastdds::dds::xtypes::TypeIdentifier type_identifier;
+    for (unsigned int i = 0; i < THREADS; i++)
+    {
+        topics[i].m_topic_name = "topic" + std::to_string(i);
+        topics[i].type_name = "type" + std::to_string(i);
+        ds.add_schema(create_schema(topics[i]), type_identifier);
+        data_sent[i] = 0;
+
+        ddspipe::core::types::WildcardDdsFilterTopic filter_topic;
+        filter_topic.topic_name = topics[i].m_topic_name;
+        filter_topic.type_name = topics[i].type_name;
+
+        ds.subscribe(filter_topic, std::make_shared<spy::participants::DataStreamer::CallbackType>(
+                    [&data_sent, i]
+                        (const ddspipe::core::types::DdsTopic& topic,
+                    const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
+                    const ddspipe::core::types::RtpsPayloadData& data)
+                    {
+                        data_sent[i]++;
+                    }));
+    }
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < THREADS; i++)
+    {
+        threads.emplace_back(
+            [&ds, &topics, i]()
+            {
+                ddspipe::core::types::RtpsPayloadData data;
+                for (unsigned int j = 0; j < SAMPLES; j++)
+                {
+                    ds.add_data(topics[i], data);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (unsigned int i = 0; i < THREADS; i++)
+    {
+        ASSERT_EQ(data_sent[i], SAMPLES);
+    }
+}
+
+/**
+ * Writers of a topic share its handle, which follows the types discovered after it is acquired.
+ */
+TEST(DataStreamerTest, topic_handle)
+{
+    spy::participants::DataStreamer ds;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    std::atomic<uint32_t> data_sent(0);
+    ds.subscribe_all(std::make_shared<spy::participants::DataStreamer::CallbackType>(
+                [&data_sent]
+                    (const ddspipe::core::types::DdsTopic& topic,
+                const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
+                const ddspipe::core::types::RtpsPayloadData& data)
+                {
+                    ASSERT_EQ(topic.m_topic_name, "topic1");
+                    data_sent++;
+                }));
+
+    auto handle_1 = ds.acquire_topic_handle(topic);
+    auto handle_2 = ds.acquire_topic_handle(topic);
+    ASSERT_EQ(handle_1, handle_2);
+
+    // A copy of the topic is resolved to the same handle
+    {
+        ddspipe::core::types::DdsTopic other_topic = topic;
+        ddspipe::core::types::RtpsPayloadData data;
+        ds.add_data(other_topic, data);
+    }
+
+    ddspipe::core::types::RtpsPayloadData data;
+    ds.add_data(*handle_1, data);
+    ASSERT_EQ(data_sent, 0u);
+
+    fastdds::dds::xtypes::TypeIdentifier type_identifier;
+    ds.add_schema(create_schema(topic), type_identifier);
+
+    ds.add_data(*handle_1, data);
+    ds.add_data(*handle_2, data);
+    ASSERT_EQ(data_sent, 2u);
+    ASSERT_NE(ds.get_topic_rate(topic), 0);
+
+    ds.release_topic_handle(handle_1);
+    ds.release_topic_handle(handle_2);
+
+    // The topic is resolved again, with the data received so far
+    auto handle_3 = ds.acquire_topic_handle(topic);
+    ds.add_data(*handle_3, data);
+    ASSERT_EQ(data_sent, 3u);
+    ds.release_topic_handle(handle_3);
+}
+
+/**
+ * With the history enabled the last samples of each topic are kept, even before its type is discovered.
+ */
+TEST(DataStreamerTest, history)
+{
+    spy::participants::DataStreamer ds;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    ddspipe::core::types::RtpsPayloadData data;
+    data.payload.reserve(1);
+    data.payload.length = 1;
+
+    // Nothing is kept while it is disabled
+    ds.add_data(topic, data);
+    ASSERT_EQ(ds.history_depth(), 0u);
+    ASSERT_TRUE(ds.get_topic_history(topic, 10).empty());
+
+    ds.enable_history(2);
+    ASSERT_EQ(ds.history_depth(), 2u);
+
+    for (uint8_t id = 0; id < 3; ++id)
+    {
+        data.payload.data[0] = id;
+        ds.add_data(topic, data);
+    }
+
+    const auto samples = ds.get_topic_history(topic, 10);
+    ASSERT_EQ(samples.size(), 2u);
+    ASSERT_EQ(samples[0]->payload.data[0], 1);
+    ASSERT_EQ(samples[1]->payload.data[0], 2);
+}
+
+TEST(DataStreamerTest, content_filter)
+{
+    spy::participants::DataStreamer ds;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    // struct type1 { int32 value; };
+    fastdds::dds::TypeDescriptor::_ref_type type_descriptor {fastdds::dds::traits<fastdds::dds::TypeDescriptor>::
+                                                             make_shared()};
+    type_descriptor->kind(fastdds::dds::TK_STRUCTURE);
+    type_descriptor->name(topic.type_name);
+    fastdds::dds::DynamicTypeBuilder::_ref_type struct_builder {fastdds::dds::DynamicTypeBuilderFactory::get_instance()
+                                                                        ->create_type(type_descriptor)};
+    auto member_descriptor = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
+    member_descriptor->name("value");
+    member_descriptor->type(fastdds::dds::DynamicTypeBuilderFactory::get_instance()->get_primitive_type(
+                fastdds::dds::TK_INT32));
+    struct_builder->add_member(member_descriptor);
+    fastdds::dds::DynamicType::_ref_type dynamic_type_topic {struct_builder->build()};
+
+    fastdds::dds::xtypes::TypeIdentifier type_identifier;
+    ds.add_schema(dynamic_type_topic, type_identifier);
+
+    std::vector<int32_t> values_received;
+    std::shared_ptr<spy::participants::DataStreamer::CallbackType> cb =
+            std::make_shared<spy::participants::DataStreamer::CallbackType>(
+        [&values_received]
+            (const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
+        const ddspipe::core::types::RtpsPayloadData& data)
+        {
+            auto loan = decoder->deserialize(data);
+            int32_t value;
+            loan.get()->get_int32_value(value, loan.get()->get_member_id_by_name("value"));
+            values_received.push_back(value);
+        });
+    ds.activate_all(cb);
+
+    fastdds::dds::DynamicPubSubType pubsub_type(dynamic_type_topic);
+    auto add_value = [&](int32_t value)
+            {
+                auto dyn_data = fastdds::dds::DynamicDataFactory::get_instance()->create_data(dynamic_type_topic);
+                dyn_data->set_int32_value(dyn_data->get_member_id_by_name("value"), value);
+
+                ddspipe::core::types::RtpsPayloadData data;
+                data.payload.reserve(pubsub_type.calculate_serialized_size(&dyn_data,
+                        fastdds::dds::XCDR2_DATA_REPRESENTATION));
+                pubsub_type.serialize(&dyn_data, data.payload, fastdds::dds::XCDR2_DATA_REPRESENTATION);
+                ds.add_data(topic, data);
+            };
+
+    std::string error;
+    ASSERT_FALSE(ds.set_content_filter(topic.m_topic_name, "value >", error));
+    ASSERT_FALSE(error.empty());
+
+    // Data of the topic that does not pass the filter never reaches the subscriptions
+    ASSERT_TRUE(ds.set_content_filter(topic.m_topic_name, "value > 5", error));
+    add_value(3);
+    add_value(7);
+    ASSERT_EQ(values_received, std::vector<int32_t>({7}));
+
+    // Filters of other topics do not apply
+    ASSERT_TRUE(ds.set_content_filter("topic2", "value = 0", error));
+    add_value(9);
+    ASSERT_EQ(values_received, std::vector<int32_t>({7, 9}));
+
+    // An empty expression removes the filter
+    ASSERT_TRUE(ds.set_content_filter(topic.m_topic_name, "", error));
+    add_value(3);
+    ASSERT_EQ(values_received, std::vector<int32_t>({7, 9, 3}));
+}
+
+/**
+ * The latency of the data from its source timestamp is measured per topic and per writer, unless disabled.
+ */
+TEST(DataStreamerTest, latency)
+{
+    constexpr int64_t LATENCY_NS = 50000000;
+
+    spy::participants::DataStreamer ds;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    ASSERT_TRUE(ds.live());
+    ASSERT_EQ(ds.get_topic_latency(topic).topic.count, 0u);
+
+    auto add_data = [&](uint8_t writer)
+            {
+                ddspipe::core::types::RtpsPayloadData data;
+                data.source_guid.entityId.value[3] = writer;
+                data.source_timestamp.from_ns(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::system_clock::now().time_since_epoch()).count() - LATENCY_NS);
+                ds.add_data(topic, data);
+            };
+
+    add_data(1);
+    add_data(1);
+    add_data(2);
+
+    auto latency = ds.get_topic_latency(topic);
+    ASSERT_EQ(latency.topic.count, 3u);
+    ASSERT_GE(latency.topic.percentile(0.5), LATENCY_NS);
+    ASSERT_GE(latency.topic.mean(), LATENCY_NS);
+    ASSERT_EQ(latency.writers.size(), 2u);
+    for (const auto& writer : latency.writers)
+    {
+        ASSERT_EQ(writer.second.count, writer.first.entityId.value[3] == 1 ? 2u : 1u);
+    }
+
+    // Data that is not live is only counted in the rate
+    ds.set_live(false);
+    ASSERT_FALSE(ds.live());
+    add_data(3);
+
+    latency = ds.get_topic_latency(topic);
+    ASSERT_EQ(latency.topic.count, 3u);
+    ASSERT_EQ(latency.writers.size(), 2u);
+}
+
+/**
+ * Data that is not live is timed by its source timestamps, so its current rate is the one at its latest data.
+ */
+TEST(DataStreamerTest, rate_not_live)
+{
+    constexpr int64_t PERIOD_NS = 10000000;
+
+    spy::participants::DataStreamer ds;
+    ds.set_live(false);
+    ds.set_rate_window(std::chrono::milliseconds(2000));
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    ASSERT_EQ(ds.get_topic_rate(topic), 0);
+    ASSERT_EQ(ds.get_topic_average_rate(topic), 0);
+
+    // 100 Hz for 10 seconds, then 50 Hz for 4 seconds
+    ddspipe::core::types::RtpsPayloadData data;
+    int64_t time = 0;
+    for (int i = 0; i < 1000; i++, time += PERIOD_NS)
+    {
+        data.source_timestamp.from_ns(time);
+        ds.add_data(topic, data);
+    }
+    for (int i = 0; i < 200; i++, time += 2 * PERIOD_NS)
+    {
+        data.source_timestamp.from_ns(time);
+        ds.add_data(topic, data);
+    }
+
+    ASSERT_NEAR(ds.get_topic_rate(topic), 50, 2);
+    ASSERT_NEAR(ds.get_topic_average_rate(topic), 1200 / 13.98, 1);
+}
+
+/**
+ * The bytes of the payloads are counted per topic and per writer.
+ */
+TEST(DataStreamerTest, traffic)
+{
+    constexpr int64_t PERIOD_NS = 10000000;
+
+    spy::participants::DataStreamer ds;
+    ds.set_live(false);
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    ASSERT_EQ(ds.get_topic_traffic(topic).topic.payload_size.count, 0u);
+
+    // 100 Hz for 10 seconds, alternating two writers with payloads of 100 and 300 bytes
+    int64_t time = 0;
+    for (int i = 0; i < 1000; i++, time += PERIOD_NS)
+    {
+        ddspipe::core::types::RtpsPayloadData data;
+        data.source_guid.entityId.value[3] = 1 + i % 2;
+        data.source_timestamp.from_ns(time);
+        data.payload.length = i % 2 ? 300 : 100;
+        ds.add_data(topic, data);
+    }
+
+    auto traffic = ds.get_topic_traffic(topic);
+    ASSERT_NEAR(traffic.topic.bandwidth, 100 * 200, 400);
+    ASSERT_EQ(traffic.topic.payload_size.count, 1000u);
+    ASSERT_EQ(traffic.topic.payload_size.min, 100u);
+    ASSERT_EQ(traffic.topic.payload_size.max, 300u);
+    ASSERT_DOUBLE_EQ(traffic.topic.payload_size.mean(), 200);
+
+    ASSERT_EQ(traffic.writers.size(), 2u);
+    for (const auto& writer : traffic.writers)
+    {
+        const uint32_t size = writer.first.entityId.value[3] == 1 ? 100 : 300;
+        ASSERT_NEAR(writer.second.bandwidth, 50 * size, size);
+        ASSERT_EQ(writer.second.payload_size.count, 500u);
+        ASSERT_EQ(writer.second.payload_size.min, size);
+        ASSERT_EQ(writer.second.payload_size.max, size);
+    }
+}
+
+TEST(DataStreamerTest, top_topics)
+{
+    constexpr int64_t PERIOD_NS = 10000000;
+
+    spy::participants::DataStreamer ds;
+    ds.set_live(false);
+
+    // Topic i receives 100 * (i + 1) bytes at 100 / (i + 1) Hz for 10 seconds
+    for (int i = 0; i < 4; i++)
+    {
+        ddspipe::core::types::DdsTopic topic;
+        topic.m_topic_name = "topic" + std::to_string(i);
+        topic.type_name = "type";
+
+        int64_t time = 0;
+        for (int j = 0; j < 1000 / (i + 1); j++, time += PERIOD_NS * (i + 1))
+        {
+            ddspipe::core::types::RtpsPayloadData data;
+            data.source_timestamp.from_ns(time);
+            data.payload.length = 100 * (i + 1) * (i + 1);
+            ds.add_data(topic, data);
+        }
+    }
+
+    // Writers of a topic with no data, one of them discovered twice and another one no longer active
+    ddspipe::core::types::Guid writer_1;
+    writer_1.entityId.value[3] = 1;
+    ddspipe::core::types::Guid writer_2;
+    writer_2.entityId.value[3] = 2;
+    ddspipe::core::types::Guid writer_3;
+    writer_3.entityId.value[3] = 3;
+    ds.on_writer_discovered(writer_1, "silent", true);
+    ds.on_writer_discovered(writer_1, "silent", true);
+    ds.on_writer_discovered(writer_2, "silent", true);
+    ds.on_writer_discovered(writer_3, "silent", true);
+    ds.on_writer_discovered(writer_3, "silent", false);
+
+    auto top = ds.get_top_topics(2, spy::participants::TopicRanking::Key::rate);
+    ASSERT_EQ(top.size(), 2u);
+    ASSERT_EQ(top[0].topic_name, "topic0");
+    ASSERT_NEAR(top[0].rate, 100, 2);
+    ASSERT_NEAR(top[0].bandwidth, 100 * 100, 200);
+    ASSERT_EQ(top[1].topic_name, "topic1");
+    ASSERT_NEAR(top[1].rate, 50, 1);
+
+    top = ds.get_top_topics(2, spy::participants::TopicRanking::Key::bandwidth);
+    ASSERT_EQ(top.size(), 2u);
+    ASSERT_EQ(top[0].topic_name, "topic3");
+    ASSERT_NEAR(top[0].bandwidth, 25 * 1600, 800);
+    ASSERT_EQ(top[1].topic_name, "topic2");
+
+    top = ds.get_top_topics(10, spy::participants::TopicRanking::Key::writers);
+    ASSERT_EQ(top.size(), 5u);
+    ASSERT_EQ(top[0].topic_name, "silent");
+    ASSERT_EQ(top[0].writers, 2u);
+    ASSERT_EQ(top[0].rate, 0);
+}
+
 int main(
         int argc,
         char** argv)
@@ -234,6 +234,45 @@ TEST(InstanceCacheTest, multiple_key_fields)
     ASSERT_TRUE(instance_json.find("5000") != std::string::npos);
 }
 
+/**
+ * Only the key members are read from the payload, and the key-only type is compiled once for all the instances.
+ */
+TEST(InstanceCacheTest, keys_read_from_payload)
+{
+    spy::participants::InstanceCache cache;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "MultiKeyTopic";
+    topic.type_name = "MultiKeyType";
+
+    std::vector<std::string> key_names = {"sensor_id", "location_id"};
+    auto dyn_type = eprosima::spy::participants::testing::create_test_type_with_keys("MultiKeyType", key_names);
+    auto decoder = std::make_shared<spy::participants::TypeDecoder>(dyn_type);
+    ASSERT_NE(decoder->layout(), nullptr);
+
+    auto writer_guid = ddspipe::core::testing::random_guid();
+    for (int32_t i = 0; i < 100; ++i)
+    {
+        std::map<std::string, int32_t> key_values = {{"sensor_id", i}, {"location_id", 1000 + i}};
+        auto data = eprosima::spy::participants::testing::create_test_data_with_keys(dyn_type, key_values, writer_guid);
+        ASSERT_TRUE(cache.add_or_update_instance(topic, decoder, *data));
+    }
+
+    auto instances = cache.get_active_instances(topic.m_topic_name);
+    ASSERT_EQ(instances.size(), 100u);
+    for (const auto& instance_json : instances)
+    {
+        // Keys only, in a single line
+        ASSERT_NE(instance_json.find("\"sensor_id\""), std::string::npos);
+        ASSERT_NE(instance_json.find("\"location_id\""), std::string::npos);
+        ASSERT_EQ(instance_json.find("value"), std::string::npos);
+        ASSERT_EQ(instance_json.find('\n'), std::string::npos);
+    }
+    ASSERT_EQ(instances.count("{\"location_id\":1007,\"sensor_id\":7}"), 1u);
+
+    ASSERT_EQ(cache.get_key_fields(topic.m_topic_name), key_names);
+}
+
 TEST(InstanceCacheTest, type_without_keys)
 {
     spy::participants::InstanceCache cache;
@@ -284,6 +323,47 @@ TEST(InstanceCacheTest, type_without_keys)
     ASSERT_EQ(instances.size(), 0);
 }
 
+/**
+ * The instances of a topic are only resolved if its type has key members, and samples added through them are found
+ * by topic name.
+ */
+TEST(InstanceCacheTest, keyed)
+{
+    spy::participants::InstanceCache cache;
+
+    ddspipe::core::types::DdsTopic keyed_topic;
+    keyed_topic.m_topic_name = "KeyedTopic";
+    keyed_topic.type_name = "KeyedType";
+    auto keyed_type = eprosima::spy::participants::testing::create_test_type_with_keys("KeyedType", {"id"});
+    auto keyed_decoder = std::make_shared<spy::participants::TypeDecoder>(keyed_type);
+    auto topic_instances = cache.topic_instances(keyed_topic, keyed_decoder);
+    ASSERT_NE(topic_instances, nullptr);
+    ASSERT_EQ(cache.get_key_fields(keyed_topic.m_topic_name), std::vector<std::string>({"id"}));
+
+    auto data = eprosima::spy::participants::testing::create_test_data_with_keys(keyed_type, {{"id", 7}},
+                    ddspipe::core::testing::random_guid());
+    ASSERT_TRUE(cache.add_or_update_instance(*topic_instances, keyed_topic, keyed_decoder, *data));
+    ASSERT_TRUE(cache.add_or_update_instance(*topic_instances, keyed_topic, keyed_decoder, *data));
+    ASSERT_EQ(cache.get_active_instances(keyed_topic.m_topic_name).size(), 1u);
+    ASSERT_EQ(cache.get_instance_stats(keyed_topic.m_topic_name, 0, 0)[0].samples, 2u);
+
+    // Resolved instances are kept when the cache is cleared
+    cache.clear();
+    ASSERT_EQ(cache.topic_instances(keyed_topic, keyed_decoder), topic_instances);
+    ASSERT_TRUE(cache.add_or_update_instance(*topic_instances, keyed_topic, keyed_decoder, *data));
+    ASSERT_EQ(cache.get_active_instances(keyed_topic.m_topic_name).size(), 1u);
+
+    ddspipe::core::types::DdsTopic keyless_topic;
+    keyless_topic.m_topic_name = "NoKeyTopic";
+    keyless_topic.type_name = "NoKeyType";
+    auto keyless_type = eprosima::spy::participants::testing::create_test_type_with_keys("NoKeyType", {});
+    ASSERT_EQ(cache.topic_instances(keyless_topic, std::make_shared<spy::participants::TypeDecoder>(keyless_type)),
+            nullptr);
+    ASSERT_TRUE(cache.get_key_fields(keyless_topic.m_topic_name).empty());
+
+    ASSERT_EQ(cache.topic_instances(keyless_topic, nullptr), nullptr);
+}
+
 TEST(InstanceCacheTest, clear_cache)
 {
     spy::participants::InstanceCache cache;
@@ -425,7 +505,7 @@ TEST(InstanceCacheTest, max_instances_limit)
 
     auto writer_guid = ddspipe::core::testing::random_guid();
 
-    const int MAX_LIMIT = cache.MAX_INSTANCES_PER_TOPIC;
+    const int MAX_LIMIT = cache.DEFAULT_MAX_INSTANCES_PER_TOPIC;
 
     for (int i = 0; i < MAX_LIMIT + 10; ++i)
     {
@@ -440,6 +520,238 @@ TEST(InstanceCacheTest, max_instances_limit)
     ASSERT_LE(instances.size(), MAX_LIMIT);
 }
 
+/**
+ * Test that the least recently seen instance of a full topic is evicted for a new one
+ */
+TEST(InstanceCacheTest, eviction_per_topic_limit)
+{
+    spy::participants::InstanceCache cache;
+    cache.set_limits(3, cache.DEFAULT_MAX_INSTANCES, cache.DEFAULT_MAX_MEMORY);
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "EvictTopic";
+    topic.type_name = "EvictType";
+
+    std::vector<std::string> key_names = {"id"};
+    auto dyn_type = eprosima::spy::participants::testing::create_test_type_with_keys("EvictType", key_names);
+
+    auto writer_guid = ddspipe::core::testing::random_guid();
+    auto add_instance = [&](int32_t id)
+            {
+                std::map<std::string, int32_t> key_values = {{"id", id}};
+                auto data = eprosima::spy::participants::testing::create_test_data_with_keys(
+                    dyn_type, key_values, writer_guid);
+                return cache.add_or_update_instance(topic, dyn_type, *data);
+            };
+
+    ASSERT_TRUE(add_instance(100));
+    ASSERT_TRUE(add_instance(101));
+    ASSERT_TRUE(add_instance(102));
+
+    // Instance 100 seen again, so 101 is the least recently seen
+    ASSERT_TRUE(add_instance(100));
+    ASSERT_TRUE(add_instance(103));
+
+    auto instances = cache.get_active_instances(topic.m_topic_name);
+    ASSERT_EQ(instances.size(), 3);
+
+    std::string all_instances;
+    for (const auto& instance : instances)
+    {
+        all_instances += instance;
+    }
+    ASSERT_NE(all_instances.find("100"), std::string::npos);
+    ASSERT_EQ(all_instances.find("101"), std::string::npos);
+    ASSERT_NE(all_instances.find("102"), std::string::npos);
+    ASSERT_NE(all_instances.find("103"), std::string::npos);
+
+    auto evictions = cache.get_eviction_stats(topic.m_topic_name);
+    ASSERT_EQ(evictions.per_topic_limit, 1u);
+    ASSERT_EQ(evictions.total_limit, 0u);
+    ASSERT_EQ(evictions.memory_limit, 0u);
+}
+
+/**
+ * Test that the least recently seen instance of any topic is evicted when all topics are full
+ */
+TEST(InstanceCacheTest, eviction_total_limit)
+{
+    spy::participants::InstanceCache cache;
+    cache.set_limits(cache.DEFAULT_MAX_INSTANCES_PER_TOPIC, 3, cache.DEFAULT_MAX_MEMORY);
+
+    ddspipe::core::types::DdsTopic topic1;
+    topic1.m_topic_name = "Topic1";
+    topic1.type_name = "Type1";
+
+    ddspipe::core::types::DdsTopic topic2;
+    topic2.m_topic_name = "Topic2";
+    topic2.type_name = "Type2";
+
+    std::vector<std::string> key_names = {"id"};
+    auto dyn_type1 = eprosima::spy::participants::testing::create_test_type_with_keys("Type1", key_names);
+    auto dyn_type2 = eprosima::spy::participants::testing::create_test_type_with_keys("Type2", key_names);
+
+    auto writer_guid = ddspipe::core::testing::random_guid();
+    auto add_instance = [&](
+        const ddspipe::core::types::DdsTopic& topic,
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        int32_t id)
+            {
+                std::map<std::string, int32_t> key_values = {{"id", id}};
+                auto data = eprosima::spy::participants::testing::create_test_data_with_keys(
+                    dyn_type, key_values, writer_guid);
+                return cache.add_or_update_instance(topic, dyn_type, *data);
+            };
+
+    ASSERT_TRUE(add_instance(topic1, dyn_type1, 100));
+    ASSERT_TRUE(add_instance(topic1, dyn_type1, 101));
+    ASSERT_TRUE(add_instance(topic2, dyn_type2, 200));
+    ASSERT_TRUE(add_instance(topic2, dyn_type2, 201));
+
+    // The oldest instance is evicted, although it belongs to another topic
+    auto instances1 = cache.get_active_instances(topic1.m_topic_name);
+    ASSERT_EQ(instances1.size(), 1);
+    ASSERT_NE(instances1.begin()->find("101"), std::string::npos);
+    ASSERT_EQ(cache.get_active_instances(topic2.m_topic_name).size(), 2);
+
+    ASSERT_EQ(cache.get_eviction_stats(topic1.m_topic_name).total_limit, 1u);
+    ASSERT_EQ(cache.get_eviction_stats(topic2.m_topic_name).total_limit, 0u);
+}
+
+/**
+ * Test that the least recently seen instances are evicted when their keys take too much memory
+ */
+TEST(InstanceCacheTest, eviction_memory_limit)
+{
+    spy::participants::InstanceCache cache;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "MemoryTopic";
+    topic.type_name = "MemoryType";
+
+    std::vector<std::string> key_names = {"id"};
+    auto dyn_type = eprosima::spy::participants::testing::create_test_type_with_keys("MemoryType", key_names);
+
+    auto writer_guid = ddspipe::core::testing::random_guid();
+    auto add_instance = [&](int32_t id)
+            {
+                std::map<std::string, int32_t> key_values = {{"id", id}};
+                auto data = eprosima::spy::participants::testing::create_test_data_with_keys(
+                    dyn_type, key_values, writer_guid);
+                return cache.add_or_update_instance(topic, dyn_type, *data);
+            };
+
+    // Every key takes the same memory, as all ids have the same number of digits
+    ASSERT_TRUE(add_instance(100));
+    const std::size_t key_size = cache.get_active_instances(topic.m_topic_name).begin()->size();
+    cache.set_limits(cache.DEFAULT_MAX_INSTANCES_PER_TOPIC, cache.DEFAULT_MAX_INSTANCES, 3 * key_size);
+
+    for (int32_t id = 101; id < 105; ++id)
+    {
+        ASSERT_TRUE(add_instance(id));
+    }
+
+    auto instances = cache.get_active_instances(topic.m_topic_name);
+    ASSERT_EQ(instances.size(), 3);
+
+    std::string all_instances;
+    for (const auto& instance : instances)
+    {
+        all_instances += instance;
+    }
+    ASSERT_EQ(all_instances.find("100"), std::string::npos);
+    ASSERT_EQ(all_instances.find("101"), std::string::npos);
+
+    ASSERT_EQ(cache.get_eviction_stats(topic.m_topic_name).memory_limit, 2u);
+
+    // A key that does not fit at all is not kept, and nothing is evicted for it
+    cache.set_limits(cache.DEFAULT_MAX_INSTANCES_PER_TOPIC, cache.DEFAULT_MAX_INSTANCES, key_size - 1);
+    ASSERT_EQ(cache.get_active_instances(topic.m_topic_name).size(), 0);
+    ASSERT_FALSE(add_instance(105));
+    ASSERT_EQ(cache.get_eviction_stats(topic.m_topic_name).memory_limit, 5u);
+}
+
+/**
+ * Test that the instances over new limits are evicted right away, the least recently seen first
+ */
+TEST(InstanceCacheTest, eviction_on_new_limits)
+{
+    spy::participants::InstanceCache cache;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "LimitsTopic";
+    topic.type_name = "LimitsType";
+
+    std::vector<std::string> key_names = {"id"};
+    auto dyn_type = eprosima::spy::participants::testing::create_test_type_with_keys("LimitsType", key_names);
+
+    auto writer_guid = ddspipe::core::testing::random_guid();
+    for (int32_t id = 100; id < 105; ++id)
+    {
+        std::map<std::string, int32_t> key_values = {{"id", id}};
+        auto data = eprosima::spy::participants::testing::create_test_data_with_keys(dyn_type, key_values, writer_guid);
+        ASSERT_TRUE(cache.add_or_update_instance(topic, dyn_type, *data));
+    }
+
+    cache.set_limits(2, cache.DEFAULT_MAX_INSTANCES, cache.DEFAULT_MAX_MEMORY);
+
+    auto instances = cache.get_active_instances(topic.m_topic_name);
+    ASSERT_EQ(instances.size(), 2);
+
+    std::string all_instances;
+    for (const auto& instance : instances)
+    {
+        all_instances += instance;
+    }
+    ASSERT_NE(all_instances.find("103"), std::string::npos);
+    ASSERT_NE(all_instances.find("104"), std::string::npos);
+
+    ASSERT_EQ(cache.get_eviction_stats(topic.m_topic_name).per_topic_limit, 3u);
+
+    // Stats are dropped with the instances
+    cache.clear();
+    ASSERT_EQ(cache.get_eviction_stats(topic.m_topic_name).per_topic_limit, 0u);
+}
+
+/**
+ * Test that no instance is kept with a limit of 0
+ */
+TEST(InstanceCacheTest, zero_limits)
+{
+    spy::participants::InstanceCache cache;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "ZeroTopic";
+    topic.type_name = "ZeroType";
+
+    std::vector<std::string> key_names = {"id"};
+    auto dyn_type = eprosima::spy::participants::testing::create_test_type_with_keys("ZeroType", key_names);
+
+    auto writer_guid = ddspipe::core::testing::random_guid();
+    auto add_instance = [&](int32_t id)
+            {
+                std::map<std::string, int32_t> key_values = {{"id", id}};
+                auto data = eprosima::spy::participants::testing::create_test_data_with_keys(
+                    dyn_type, key_values, writer_guid);
+                return cache.add_or_update_instance(topic, dyn_type, *data);
+            };
+
+    ASSERT_TRUE(add_instance(100));
+
+    cache.set_limits(0, cache.DEFAULT_MAX_INSTANCES, cache.DEFAULT_MAX_MEMORY);
+    ASSERT_EQ(cache.get_active_instances(topic.m_topic_name).size(), 0);
+    ASSERT_FALSE(add_instance(101));
+    ASSERT_EQ(cache.get_active_instances(topic.m_topic_name).size(), 0);
+
+    cache.set_limits(cache.DEFAULT_MAX_INSTANCES_PER_TOPIC, 0, cache.DEFAULT_MAX_MEMORY);
+    ASSERT_FALSE(add_instance(102));
+    ASSERT_EQ(cache.get_active_instances(topic.m_topic_name).size(), 0);
+
+    cache.set_limits(cache.DEFAULT_MAX_INSTANCES_PER_TOPIC, cache.DEFAULT_MAX_INSTANCES, cache.DEFAULT_MAX_MEMORY);
+    ASSERT_TRUE(add_instance(103));
+    ASSERT_EQ(cache.get_active_instances(topic.m_topic_name).size(), 1);
+}
+
 TEST(InstanceCacheTest, multiple_writers_all_removed)
 {
     spy::participants::InstanceCache cache;
@@ -483,6 +795,180 @@ TEST(InstanceCacheTest, multiple_writers_all_removed)
     ASSERT_EQ(instances.size(), 0);
 }
 
+/**
+ * Test that removing a writer only removes the instances no other writer publishes, also after evictions
+ */
+TEST(InstanceCacheTest, writer_removal_own_instances)
+{
+    spy::participants::InstanceCache cache;
+    cache.set_limits(4, cache.DEFAULT_MAX_INSTANCES, cache.DEFAULT_MAX_MEMORY);
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "OwnInstancesTopic";
+    topic.type_name = "OwnInstancesType";
+
+    std::vector<std::string> key_names = {"id"};
+    auto dyn_type = eprosima::spy::participants::testing::create_test_type_with_keys("OwnInstancesType", key_names);
+
+    auto writer_guid1 = ddspipe::core::testing::random_guid(1);
+    auto writer_guid2 = ddspipe::core::testing::random_guid(2);
+    auto add_instance = [&](int32_t id, const ddspipe::core::types::Guid& writer_guid)
+            {
+                std::map<std::string, int32_t> key_values = {{"id", id}};
+                auto data = eprosima::spy::participants::testing::create_test_data_with_keys(
+                    dyn_type, key_values, writer_guid);
+                return cache.add_or_update_instance(topic, dyn_type, *data);
+            };
+
+    // Instance 100 of writer 1 is evicted by the last one
+    ASSERT_TRUE(add_instance(100, writer_guid1));
+    ASSERT_TRUE(add_instance(101, writer_guid1));
+    ASSERT_TRUE(add_instance(102, writer_guid1));
+    ASSERT_TRUE(add_instance(102, writer_guid2));
+    ASSERT_TRUE(add_instance(103, writer_guid2));
+    ASSERT_TRUE(add_instance(104, writer_guid2));
+    ASSERT_EQ(cache.get_active_instances(topic.m_topic_name).size(), 4);
+
+    // Instance 102 is also published by writer 2
+    cache.on_writer_changed(writer_guid1, topic.m_topic_name, false);
+
+    auto instances = cache.get_active_instances(topic.m_topic_name);
+    ASSERT_EQ(instances.size(), 3);
+
+    std::string all_instances;
+    for (const auto& instance : instances)
+    {
+        all_instances += instance;
+    }
+    ASSERT_EQ(all_instances.find("101"), std::string::npos);
+    ASSERT_NE(all_instances.find("102"), std::string::npos);
+
+    // Removing it again changes nothing
+    cache.on_writer_changed(writer_guid1, topic.m_topic_name, false);
+    ASSERT_EQ(cache.get_active_instances(topic.m_topic_name).size(), 3);
+
+    cache.on_writer_changed(writer_guid2, topic.m_topic_name, false);
+    ASSERT_EQ(cache.get_active_instances(topic.m_topic_name).size(), 0);
+}
+
+/**
+ * Test the lifecycle state of an instance through dispose and unregister samples and writer removal
+ */
+TEST(InstanceCacheTest, instance_lifecycle)
+{
+    using InstanceState = spy::participants::InstanceCache::InstanceState;
+
+    spy::participants::InstanceCache cache;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "LifecycleTopic";
+    topic.type_name = "LifecycleType";
+
+    std::vector<std::string> key_names = {"id"};
+    auto dyn_type = eprosima::spy::participants::testing::create_test_type_with_keys("LifecycleType", key_names);
+
+    auto writer_guid = ddspipe::core::testing::random_guid();
+    std::map<std::string, int32_t> key_values = {{"id", 300}};
+    auto add_sample = [&](fastdds::rtps::ChangeKind_t kind)
+            {
+                auto data = eprosima::spy::participants::testing::create_test_data_with_keys(
+                    dyn_type, key_values, writer_guid);
+                data->kind = kind;
+                return cache.add_or_update_instance(topic, dyn_type, *data);
+            };
+    auto single_stats = [&]()
+            {
+                auto stats = cache.get_instance_stats(topic.m_topic_name, 0, 0);
+                EXPECT_EQ(stats.size(), 1);
+                return stats.empty() ? spy::participants::InstanceCache::InstanceStats{} : stats.front();
+            };
+
+    // An instance is not added by a dispose sample
+    ASSERT_FALSE(add_sample(fastdds::rtps::NOT_ALIVE_DISPOSED));
+    ASSERT_EQ(cache.get_instance_stats(topic.m_topic_name, 0, 0).size(), 0);
+
+    ASSERT_TRUE(add_sample(fastdds::rtps::ALIVE));
+    ASSERT_EQ(single_stats().state, InstanceState::alive);
+    ASSERT_EQ(single_stats().writers, 1u);
+
+    // Disposed, and alive again with new data
+    ASSERT_TRUE(add_sample(fastdds::rtps::NOT_ALIVE_DISPOSED));
+    ASSERT_EQ(single_stats().state, InstanceState::disposed);
+    ASSERT_EQ(single_stats().samples, 1u);
+    ASSERT_EQ(cache.get_active_instances(topic.m_topic_name).size(), 0);
+
+    ASSERT_TRUE(add_sample(fastdds::rtps::ALIVE));
+    ASSERT_EQ(single_stats().state, InstanceState::alive);
+    ASSERT_EQ(single_stats().samples, 2u);
+
+    // Unregistered by its only writer, but kept
+    ASSERT_TRUE(add_sample(fastdds::rtps::NOT_ALIVE_UNREGISTERED));
+    ASSERT_EQ(single_stats().state, InstanceState::no_writers);
+    ASSERT_EQ(single_stats().writers, 0u);
+    ASSERT_EQ(cache.get_active_instances(topic.m_topic_name).size(), 0);
+
+    // Registered again with new data, and then its writer is removed
+    ASSERT_TRUE(add_sample(fastdds::rtps::ALIVE));
+    ASSERT_EQ(single_stats().state, InstanceState::alive);
+    ASSERT_EQ(cache.get_active_instances(topic.m_topic_name).size(), 1);
+
+    cache.on_writer_changed(writer_guid, topic.m_topic_name, false);
+    ASSERT_EQ(single_stats().state, InstanceState::no_writers);
+    ASSERT_EQ(single_stats().samples, 3u);
+}
+
+/**
+ * Test the samples, payload bytes and rate counted for each instance
+ */
+TEST(InstanceCacheTest, instance_stats)
+{
+    spy::participants::InstanceCache cache;
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "StatsTopic";
+    topic.type_name = "StatsType";
+
+    std::vector<std::string> key_names = {"id"};
+    auto dyn_type = eprosima::spy::participants::testing::create_test_type_with_keys("StatsType", key_names);
+
+    auto writer_guid = ddspipe::core::testing::random_guid();
+    const int64_t window = 1000000000;
+    uint32_t payload_length = 0;
+    auto add_instance = [&](int32_t id, int64_t time)
+            {
+                std::map<std::string, int32_t> key_values = {{"id", id}};
+                auto data = eprosima::spy::participants::testing::create_test_data_with_keys(
+                    dyn_type, key_values, writer_guid);
+                payload_length = data->payload.length;
+                return cache.add_or_update_instance(topic, dyn_type, *data, time, window);
+            };
+
+    // Instance 100 gets 10 samples in the window, and instance 101 only 1
+    for (int64_t i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(add_instance(100, i * window / 10));
+    }
+    ASSERT_TRUE(add_instance(101, window / 2));
+
+    auto stats = cache.get_instance_stats(topic.m_topic_name, window, window);
+    ASSERT_EQ(stats.size(), 2);
+
+    const auto& busy = stats[0].samples == 10 ? stats[0] : stats[1];
+    const auto& quiet = stats[0].samples == 10 ? stats[1] : stats[0];
+    ASSERT_EQ(busy.samples, 10u);
+    ASSERT_EQ(busy.bytes, 10u * payload_length);
+    ASSERT_EQ(quiet.samples, 1u);
+    ASSERT_EQ(quiet.bytes, payload_length);
+    ASSERT_GT(busy.rate, quiet.rate);
+    ASSERT_GT(quiet.rate, 0);
+
+    // No rate without a window
+    for (const auto& instance : cache.get_instance_stats(topic.m_topic_name, window, 0))
+    {
+        ASSERT_EQ(instance.rate, 0);
+    }
+}
+
 TEST(InstanceCacheTest, readd_after_removal)
 {
     spy::participants::InstanceCache cache;
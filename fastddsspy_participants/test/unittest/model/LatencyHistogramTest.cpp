@@ -0,0 +1,196 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastddsspy_participants/model/LatencyHistogram.hpp>
+
+using namespace eprosima::spy::participants;
+
+/**
+ * Every latency is counted in a bucket whose bounds contain it, and the buckets are sorted and contiguous.
+ */
+TEST(LatencyHistogramTest, bucket_bounds)
+{
+    for (std::size_t i = 1; i < LatencyHistogram::BUCKETS - 1; ++i)
+    {
+        const int64_t lower_bound = LatencyHistogram::bucket_upper_bound(i - 1) + 1;
+        const int64_t upper_bound = LatencyHistogram::bucket_upper_bound(i);
+        ASSERT_LE(lower_bound, upper_bound);
+        ASSERT_EQ(LatencyHistogram::bucket_index(lower_bound), i);
+        ASSERT_EQ(LatencyHistogram::bucket_index(upper_bound), i);
+
+        // The width of each bucket is under 1 / SUB_BUCKETS of its latencies
+        ASSERT_LT((upper_bound - lower_bound) * static_cast<int64_t>(LatencyHistogram::SUB_BUCKETS), lower_bound);
+    }
+
+    ASSERT_EQ(LatencyHistogram::bucket_index(0), 0u);
+    ASSERT_EQ(LatencyHistogram::bucket_index(-1), 0u);
+    ASSERT_EQ(LatencyHistogram::bucket_index(LatencyHistogram::MAX_LATENCY - 1), LatencyHistogram::BUCKETS - 1);
+    ASSERT_EQ(LatencyHistogram::bucket_index(LatencyHistogram::MAX_LATENCY), LatencyHistogram::BUCKETS - 1);
+    ASSERT_EQ(LatencyHistogram::bucket_index(INT64_MAX), LatencyHistogram::BUCKETS - 1);
+}
+
+/**
+ * An empty histogram has no latencies.
+ */
+TEST(LatencyHistogramTest, empty)
+{
+    LatencyHistogram histogram;
+    LatencyHistogram::Snapshot snapshot = histogram.snapshot();
+
+    ASSERT_EQ(snapshot.count, 0u);
+    ASSERT_EQ(snapshot.max, 0);
+    ASSERT_EQ(snapshot.mean(), 0);
+    ASSERT_EQ(snapshot.percentile(0.5), 0);
+    ASSERT_EQ(snapshot.buckets.size(), LatencyHistogram::BUCKETS);
+}
+
+/**
+ * Percentiles are within the relative error of the buckets, and never above the maximum.
+ */
+TEST(LatencyHistogramTest, percentiles)
+{
+    LatencyHistogram histogram;
+
+    // 1 to 1000 microseconds
+    for (int64_t i = 1; i <= 1000; ++i)
+    {
+        histogram.add(i * 1000);
+    }
+
+    LatencyHistogram::Snapshot snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.count, 1000u);
+    ASSERT_EQ(snapshot.max, 1000000);
+    ASSERT_DOUBLE_EQ(snapshot.mean(), 500500);
+
+    const std::vector<std::pair<double, int64_t>> expected = {
+        {0.5, 500000},
+        {0.9, 900000},
+        {0.99, 990000},
+        {0.999, 999000},
+    };
+    for (const auto& it : expected)
+    {
+        const int64_t percentile = snapshot.percentile(it.first);
+        ASSERT_GE(percentile, it.second);
+        ASSERT_LE(percentile, it.second + it.second / LatencyHistogram::SUB_BUCKETS);
+    }
+
+    ASSERT_EQ(snapshot.percentile(1), 1000000);
+    ASSERT_EQ(snapshot.percentile(0), LatencyHistogram::bucket_upper_bound(LatencyHistogram::bucket_index(1000)));
+}
+
+/**
+ * Negative latencies, from unsynchronized clocks, are counted as 0.
+ */
+TEST(LatencyHistogramTest, negative)
+{
+    LatencyHistogram histogram;
+    histogram.add(-1000);
+    histogram.add(-1);
+
+    LatencyHistogram::Snapshot snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.count, 2u);
+    ASSERT_EQ(snapshot.sum, 0);
+    ASSERT_EQ(snapshot.max, 0);
+    ASSERT_EQ(snapshot.buckets[0], 2u);
+}
+
+/**
+ * Histograms counted apart are merged into the counts of all their latencies.
+ */
+TEST(LatencyHistogramTest, merge)
+{
+    LatencyHistogram histogram_1;
+    histogram_1.add(10);
+    histogram_1.add(1000);
+
+    LatencyHistogram histogram_2;
+    histogram_2.add(5);
+    histogram_2.add(1000000);
+
+    LatencyHistogram::Snapshot snapshot = histogram_1.snapshot();
+    snapshot.merge(histogram_2.snapshot());
+    snapshot.merge(LatencyHistogram().snapshot());
+    ASSERT_EQ(snapshot.count, 4u);
+    ASSERT_EQ(snapshot.sum, 10 + 1000 + 5 + 1000000);
+    ASSERT_EQ(snapshot.max, 1000000);
+
+    std::vector<uint64_t> expected_buckets(LatencyHistogram::BUCKETS, 0);
+    ++expected_buckets[LatencyHistogram::bucket_index(10)];
+    ++expected_buckets[LatencyHistogram::bucket_index(1000)];
+    ++expected_buckets[LatencyHistogram::bucket_index(5)];
+    ++expected_buckets[LatencyHistogram::bucket_index(1000000)];
+    ASSERT_EQ(snapshot.buckets, expected_buckets);
+
+    // Merged into an empty snapshot, the maximum is the one of the other
+    LatencyHistogram::Snapshot empty = LatencyHistogram().snapshot();
+    empty.merge(histogram_2.snapshot());
+    ASSERT_EQ(empty.max, 1000000);
+    ASSERT_EQ(empty.count, 2u);
+}
+
+/**
+ * Latencies added from several threads at once are all counted.
+ */
+TEST(LatencyHistogramTest, concurrent)
+{
+    constexpr unsigned int THREADS = 4;
+    constexpr int64_t LATENCIES = 10000;
+
+    LatencyHistogram histogram;
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < THREADS; i++)
+    {
+        threads.emplace_back(
+            [&histogram, i]()
+            {
+                for (int64_t j = 0; j < LATENCIES; j++)
+                {
+                    histogram.add(j + i);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    LatencyHistogram::Snapshot snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.count, static_cast<uint64_t>(THREADS * LATENCIES));
+    ASSERT_EQ(snapshot.max, LATENCIES - 1 + THREADS - 1);
+
+    uint64_t counted = 0;
+    for (const auto& bucket : snapshot.buckets)
+    {
+        counted += bucket;
+    }
+    ASSERT_EQ(counted, static_cast<uint64_t>(THREADS * LATENCIES));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
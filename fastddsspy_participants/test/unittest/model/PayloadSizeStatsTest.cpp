@@ -0,0 +1,165 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastddsspy_participants/model/PayloadSizeStats.hpp>
+
+using namespace eprosima::spy::participants;
+
+/**
+ * Each size is counted in the bucket of its power of two.
+ */
+TEST(PayloadSizeStatsTest, bucket_bounds)
+{
+    ASSERT_EQ(PayloadSizeStats::bucket_index(0), 0u);
+    ASSERT_EQ(PayloadSizeStats::bucket_index(1), 1u);
+    ASSERT_EQ(PayloadSizeStats::bucket_index(2), 2u);
+    ASSERT_EQ(PayloadSizeStats::bucket_index(3), 2u);
+    ASSERT_EQ(PayloadSizeStats::bucket_index(1024), 11u);
+    ASSERT_EQ(PayloadSizeStats::bucket_index(std::numeric_limits<uint32_t>::max()), PayloadSizeStats::BUCKETS - 1);
+
+    for (std::size_t i = 0; i < PayloadSizeStats::BUCKETS; ++i)
+    {
+        const uint64_t lower_bound = PayloadSizeStats::bucket_lower_bound(i);
+        const uint64_t upper_bound = PayloadSizeStats::bucket_upper_bound(i);
+        ASSERT_LE(lower_bound, upper_bound);
+        ASSERT_EQ(PayloadSizeStats::bucket_index(static_cast<uint32_t>(lower_bound)), i);
+        ASSERT_EQ(PayloadSizeStats::bucket_index(static_cast<uint32_t>(upper_bound)), i);
+        if (i > 0)
+        {
+            ASSERT_EQ(PayloadSizeStats::bucket_upper_bound(i - 1) + 1, lower_bound);
+        }
+    }
+}
+
+/**
+ * Without payloads every statistic is 0.
+ */
+TEST(PayloadSizeStatsTest, empty)
+{
+    PayloadSizeStats stats;
+    PayloadSizeStats::Snapshot snapshot = stats.snapshot();
+
+    ASSERT_EQ(snapshot.count, 0u);
+    ASSERT_EQ(snapshot.min, 0u);
+    ASSERT_EQ(snapshot.max, 0u);
+    ASSERT_EQ(snapshot.mean(), 0);
+    ASSERT_EQ(snapshot.buckets, std::vector<uint64_t>(PayloadSizeStats::BUCKETS, 0));
+}
+
+/**
+ * Minimum, mean, maximum and histogram of the sizes.
+ */
+TEST(PayloadSizeStatsTest, sizes)
+{
+    PayloadSizeStats stats;
+    stats.add(100);
+    stats.add(200);
+    stats.add(120);
+    stats.add(1 << 20);
+
+    PayloadSizeStats::Snapshot snapshot = stats.snapshot();
+    ASSERT_EQ(snapshot.count, 4u);
+    ASSERT_EQ(snapshot.sum, 100u + 200u + 120u + (1u << 20));
+    ASSERT_EQ(snapshot.min, 100u);
+    ASSERT_EQ(snapshot.max, 1u << 20);
+    ASSERT_DOUBLE_EQ(snapshot.mean(), (100 + 200 + 120 + (1 << 20)) / 4.0);
+
+    std::vector<uint64_t> expected_buckets(PayloadSizeStats::BUCKETS, 0);
+    expected_buckets[7] = 2;
+    expected_buckets[8] = 1;
+    expected_buckets[21] = 1;
+    ASSERT_EQ(snapshot.buckets, expected_buckets);
+}
+
+TEST(PayloadSizeStatsTest, merge)
+{
+    PayloadSizeStats stats_1;
+    stats_1.add(100);
+    stats_1.add(200);
+
+    PayloadSizeStats stats_2;
+    stats_2.add(50);
+    stats_2.add(1 << 20);
+
+    PayloadSizeStats::Snapshot snapshot = stats_1.snapshot();
+    snapshot.merge(stats_2.snapshot());
+    snapshot.merge(PayloadSizeStats().snapshot());
+    ASSERT_EQ(snapshot.count, 4u);
+    ASSERT_EQ(snapshot.sum, 100u + 200u + 50u + (1u << 20));
+    ASSERT_EQ(snapshot.min, 50u);
+    ASSERT_EQ(snapshot.max, 1u << 20);
+
+    std::vector<uint64_t> expected_buckets(PayloadSizeStats::BUCKETS, 0);
+    expected_buckets[6] = 1;
+    expected_buckets[7] = 1;
+    expected_buckets[8] = 1;
+    expected_buckets[21] = 1;
+    ASSERT_EQ(snapshot.buckets, expected_buckets);
+
+    // Merged into an empty snapshot, the minimum is the one of the other
+    PayloadSizeStats::Snapshot empty = PayloadSizeStats().snapshot();
+    empty.merge(stats_2.snapshot());
+    ASSERT_EQ(empty.min, 50u);
+    ASSERT_EQ(empty.count, 2u);
+}
+
+/**
+ * Sizes added from several threads at once are all counted.
+ */
+TEST(PayloadSizeStatsTest, concurrent)
+{
+    constexpr unsigned int THREADS = 4;
+    constexpr uint32_t SIZES = 10000;
+
+    PayloadSizeStats stats;
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < THREADS; i++)
+    {
+        threads.emplace_back(
+            [&stats, i]()
+            {
+                for (uint32_t j = 1; j <= SIZES; j++)
+                {
+                    stats.add(j + i);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    PayloadSizeStats::Snapshot snapshot = stats.snapshot();
+    ASSERT_EQ(snapshot.count, THREADS * SIZES);
+    ASSERT_EQ(snapshot.min, 1u);
+    ASSERT_EQ(snapshot.max, SIZES + THREADS - 1);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,182 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastddsspy_participants/model/RateWindow.hpp>
+
+using namespace eprosima::spy::participants;
+
+namespace test {
+
+constexpr int64_t MS = 1000000;
+
+//! Window of 5 seconds, in buckets of 250 ms
+constexpr int64_t WINDOW = 5000 * MS;
+
+//! Add data at \c rate Hz from \c start_ms until before \c end_ms, returning the time of the last one
+int64_t add_data(
+        RateWindow& window,
+        int64_t rate,
+        int64_t start_ms,
+        int64_t end_ms)
+{
+    const int64_t period = 1000 * MS / rate;
+    int64_t time = start_ms * MS;
+    for (; time < end_ms * MS; time += period)
+    {
+        window.add(time, WINDOW);
+    }
+    return time - period;
+}
+
+} /* namespace test */
+
+/**
+ * A window without data has no rate.
+ */
+TEST(RateWindowTest, empty)
+{
+    RateWindow window;
+    ASSERT_EQ(window.rate(0, test::WINDOW), 0);
+    ASSERT_EQ(window.rate(1000 * test::MS, test::WINDOW), 0);
+}
+
+/**
+ * Data received at a constant rate gives that rate, also before a whole window passes.
+ */
+TEST(RateWindowTest, constant_rate)
+{
+    RateWindow window;
+
+    test::add_data(window, 100, 1000, 1500);
+    ASSERT_NEAR(window.rate(1500 * test::MS, test::WINDOW), 100, 1);
+
+    test::add_data(window, 100, 1500, 20000);
+    ASSERT_NEAR(window.rate(20000 * test::MS, test::WINDOW), 100, 1);
+
+    // The rate has sub-second precision
+    RateWindow slow_window;
+    test::add_data(slow_window, 4, 0, 20000);
+    ASSERT_NEAR(slow_window.rate(20000 * test::MS, test::WINDOW), 4, 0.1);
+}
+
+/**
+ * The rate follows changes, and drops to 0 once a whole window passes without data.
+ */
+TEST(RateWindowTest, rate_change)
+{
+    RateWindow window;
+
+    test::add_data(window, 100, 0, 10000);
+    test::add_data(window, 10, 10000, 12000);
+
+    const double rate_after_change = window.rate(12000 * test::MS, test::WINDOW);
+    ASSERT_LT(rate_after_change, 50);
+    ASSERT_GT(rate_after_change, 10);
+
+    test::add_data(window, 10, 12000, 15000);
+    ASSERT_NEAR(window.rate(15000 * test::MS, test::WINDOW), 10, 0.5);
+
+    // No more data
+    const double rate_stopping = window.rate(17000 * test::MS, test::WINDOW);
+    ASSERT_LT(rate_stopping, 10);
+    ASSERT_GT(rate_stopping, 0);
+    ASSERT_EQ(window.rate(20000 * test::MS, test::WINDOW), 0);
+    ASSERT_EQ(window.rate(3600000 * test::MS, test::WINDOW), 0);
+}
+
+/**
+ * Data older than the window of the latest data is not counted, and does not reset newer counts.
+ */
+TEST(RateWindowTest, old_data)
+{
+    RateWindow window;
+
+    test::add_data(window, 100, 0, 10000);
+    window.add(0, test::WINDOW);
+    window.add(4000 * test::MS, test::WINDOW);
+
+    ASSERT_NEAR(window.rate(10000 * test::MS, test::WINDOW), 100, 1);
+}
+
+/**
+ * Data added from several threads at once is all counted.
+ */
+TEST(RateWindowTest, concurrent)
+{
+    constexpr unsigned int THREADS = 4;
+
+    RateWindow window;
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < THREADS; i++)
+    {
+        threads.emplace_back(
+            [&window]()
+            {
+                test::add_data(window, 100, 0, 10000);
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_NEAR(window.rate(10000 * test::MS, test::WINDOW), 100 * THREADS, 1);
+}
+
+/**
+ * Windows counted apart give the rate of all their data together, from the first data of any of them.
+ */
+TEST(RateWindowTest, merged)
+{
+    RateWindow windows[3];
+    test::add_data(windows[0], 100, 0, 10000);
+    test::add_data(windows[1], 50, 0, 10000);
+    test::add_data(windows[2], 20, 1000, 10000);
+
+    const RateWindow* const all[] = {&windows[0], &windows[1], &windows[2]};
+    ASSERT_NEAR(RateWindow::rate(all, 3, 10000 * test::MS, test::WINDOW), 170, 1);
+    ASSERT_NEAR(RateWindow::rate(all, 2, 10000 * test::MS, test::WINDOW), 150, 1);
+    ASSERT_NEAR(RateWindow::rate(all + 2, 1, 10000 * test::MS, test::WINDOW), 20, 1);
+    ASSERT_EQ(RateWindow::rate(all, 0, 10000 * test::MS, test::WINDOW), 0);
+
+    // The time counted starts at the first data of any window, even if it is already out of the window
+    RateWindow old;
+    RateWindow recent;
+    test::add_data(old, 100, 0, 1000);
+    test::add_data(recent, 100, 11000, 12000);
+    const RateWindow* const both[] = {&old, &recent};
+    ASSERT_NEAR(RateWindow::rate(both + 1, 1, 12000 * test::MS, test::WINDOW), 100, 1);
+    ASSERT_NEAR(
+        RateWindow::rate(both, 2, 12000 * test::MS, test::WINDOW),
+        100 * (1 - std::exp2(-0.8)) / (1 - std::exp2(-4)),
+        2);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
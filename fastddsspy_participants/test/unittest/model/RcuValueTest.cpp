@@ -0,0 +1,138 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastddsspy_participants/model/RcuValue.hpp>
+
+using namespace eprosima::spy::participants;
+
+namespace test {
+
+//! Value that counts the instances alive, and is poisoned when destroyed
+struct CountedValue
+{
+    CountedValue(
+            int value,
+            std::atomic<int>& alive)
+        : value(value)
+        , alive(alive)
+    {
+        alive.fetch_add(1);
+    }
+
+    ~CountedValue()
+    {
+        value = -1;
+        alive.fetch_sub(1);
+    }
+
+    int value;
+    std::atomic<int>& alive;
+};
+
+} /* namespace test */
+
+/**
+ * A reader keeps the value it read while a new one is published, and the replaced value is destroyed once no reader
+ * holds it.
+ */
+TEST(RcuValueTest, publish)
+{
+    std::atomic<int> alive {0};
+    {
+        RcuValue<test::CountedValue> rcu(std::unique_ptr<const test::CountedValue>(new test::CountedValue(1, alive)));
+        ASSERT_EQ(rcu.read()->value, 1);
+
+        std::thread publisher;
+        {
+            auto reader = rcu.read();
+            publisher = std::thread([&rcu, &alive]()
+                            {
+                                rcu.publish(std::unique_ptr<const test::CountedValue>(
+                                    new test::CountedValue(2, alive)));
+                            });
+
+            // NOTE: the publisher waits for this reader, so the value read is not destroyed meanwhile
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            ASSERT_EQ(reader->value, 1);
+            ASSERT_EQ(alive.load(), 2);
+        }
+        publisher.join();
+
+        ASSERT_EQ(alive.load(), 1);
+        ASSERT_EQ(rcu.read()->value, 2);
+    }
+    ASSERT_EQ(alive.load(), 0);
+}
+
+/**
+ * Readers in several threads never see a destroyed value while it is replaced over and over.
+ */
+TEST(RcuValueTest, concurrent)
+{
+    constexpr int THREADS = 4;
+    constexpr int PUBLICATIONS = 1000;
+
+    std::atomic<int> alive {0};
+    RcuValue<test::CountedValue> rcu(std::unique_ptr<const test::CountedValue>(new test::CountedValue(0, alive)));
+
+    std::atomic<bool> stop {false};
+    std::atomic<int> errors {0};
+    std::vector<std::thread> readers;
+    for (int i = 0; i < THREADS; ++i)
+    {
+        readers.emplace_back([&rcu, &stop, &errors]()
+                {
+                    while (!stop.load())
+                    {
+                        auto reader = rcu.read();
+                        if (reader->value < 0)
+                        {
+                            errors.fetch_add(1);
+                        }
+                    }
+                });
+    }
+
+    for (int i = 1; i <= PUBLICATIONS; ++i)
+    {
+        rcu.publish(std::unique_ptr<const test::CountedValue>(new test::CountedValue(i, alive)));
+    }
+
+    stop.store(true);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+
+    ASSERT_EQ(errors.load(), 0);
+    ASSERT_EQ(alive.load(), 1);
+    ASSERT_EQ(rcu.read()->value, PUBLICATIONS);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
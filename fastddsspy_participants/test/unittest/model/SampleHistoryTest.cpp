@@ -0,0 +1,168 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddspipe_core/efficiency/payload/FastPayloadPool.hpp>
+
+#include <fastddsspy_participants/model/SampleHistory.hpp>
+
+using namespace eprosima;
+using namespace eprosima::spy::participants;
+
+namespace test {
+
+ddspipe::core::types::DdsTopic create_topic(
+        const std::string& topic_name)
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = topic_name;
+    topic.type_name = "type1";
+    return topic;
+}
+
+//! Sample of \c size bytes whose first payload byte identifies it
+void fill_data(
+        ddspipe::core::types::RtpsPayloadData& data,
+        uint8_t id,
+        uint32_t size = 1)
+{
+    data.payload.reserve(size);
+    data.payload.data[0] = id;
+    data.payload.length = size;
+}
+
+//! Ids of the samples kept
+std::vector<uint8_t> ids(
+        const std::vector<std::shared_ptr<const ddspipe::core::types::RtpsPayloadData>>& samples)
+{
+    std::vector<uint8_t> result;
+    for (const auto& sample : samples)
+    {
+        result.push_back(sample->payload.data[0]);
+    }
+    return result;
+}
+
+} /* namespace test */
+
+/**
+ * Only the last \c depth samples of a topic are kept, and the last ones are read oldest first.
+ */
+TEST(SampleHistoryTest, keep_last)
+{
+    SampleHistory history(3);
+    const auto topic = test::create_topic("topic1");
+    auto& topic_history = history.topic_history(topic);
+
+    for (uint8_t id = 0; id < 5; ++id)
+    {
+        ddspipe::core::types::RtpsPayloadData data;
+        test::fill_data(data, id);
+        history.add(topic_history, data);
+    }
+
+    ASSERT_EQ(test::ids(history.last(topic, 10)), (std::vector<uint8_t>{2, 3, 4}));
+    ASSERT_EQ(test::ids(history.last(topic, 2)), (std::vector<uint8_t>{3, 4}));
+    ASSERT_TRUE(history.last(test::create_topic("topic2"), 10).empty());
+}
+
+/**
+ * Each topic keeps its share of the memory, which gets smaller as topics are added.
+ */
+TEST(SampleHistoryTest, max_memory)
+{
+    SampleHistory history(10, 8);
+    const auto topic_1 = test::create_topic("topic1");
+    auto& topic_history_1 = history.topic_history(topic_1);
+
+    for (uint8_t id = 0; id < 4; ++id)
+    {
+        ddspipe::core::types::RtpsPayloadData data;
+        test::fill_data(data, id, 3);
+        history.add(topic_history_1, data);
+    }
+    ASSERT_EQ(test::ids(history.last(topic_1, 10)), (std::vector<uint8_t>{2, 3}));
+
+    // The first topic is left with half the memory
+    const auto topic_2 = test::create_topic("topic2");
+    auto& topic_history_2 = history.topic_history(topic_2);
+    ASSERT_EQ(test::ids(history.last(topic_1, 10)), (std::vector<uint8_t>{3}));
+
+    // A sample larger than the share of a topic is not kept
+    ddspipe::core::types::RtpsPayloadData data;
+    test::fill_data(data, 4, 5);
+    history.add(topic_history_2, data);
+    ASSERT_TRUE(history.last(topic_2, 10).empty());
+}
+
+/**
+ * Samples with a payload from a payload pool share it instead of copying it.
+ */
+TEST(SampleHistoryTest, share_payload)
+{
+    auto payload_pool = std::make_shared<ddspipe::core::FastPayloadPool>();
+
+    SampleHistory history(2);
+    const auto topic = test::create_topic("topic1");
+
+    {
+        ddspipe::core::types::RtpsPayloadData data;
+        ASSERT_TRUE(payload_pool->get_payload(4, data.payload));
+        data.payload_owner = payload_pool.get();
+        data.payload.data[0] = 7;
+        data.payload.length = 4;
+
+        history.add(history.topic_history(topic), data);
+
+        const auto samples = history.last(topic, 1);
+        ASSERT_EQ(samples.size(), 1u);
+        ASSERT_EQ(samples[0]->payload.data, data.payload.data);
+    }
+
+    // The payload outlives the sample it was received with
+    const auto samples = history.last(topic, 1);
+    ASSERT_EQ(samples.size(), 1u);
+    ASSERT_EQ(samples[0]->payload.data[0], 7);
+    ASSERT_EQ(samples[0]->payload.length, 4u);
+}
+
+/**
+ * With depth 0 nothing is kept.
+ */
+TEST(SampleHistoryTest, depth_zero)
+{
+    SampleHistory history(0);
+    const auto topic = test::create_topic("topic1");
+
+    ddspipe::core::types::RtpsPayloadData data;
+    test::fill_data(data, 1);
+    history.add(history.topic_history(topic), data);
+
+    ASSERT_TRUE(history.last(topic, 10).empty());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
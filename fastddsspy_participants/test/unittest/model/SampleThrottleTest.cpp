@@ -0,0 +1,124 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastddsspy_participants/model/SampleThrottle.hpp>
+
+using namespace eprosima::spy::participants;
+
+namespace test {
+
+const std::chrono::steady_clock::time_point START_TIME = std::chrono::steady_clock::now();
+
+std::chrono::steady_clock::time_point at_ms(
+        int64_t milliseconds)
+{
+    return START_TIME + std::chrono::milliseconds(milliseconds);
+}
+
+} /* namespace test */
+
+/**
+ * With no limits every sample is accepted and nothing is counted.
+ */
+TEST(SampleThrottleTest, unlimited)
+{
+    SampleThrottle throttle;
+    ASSERT_FALSE(throttle.limited());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(throttle.accept("topic", test::at_ms(0)));
+    }
+    ASSERT_TRUE(throttle.suppressed_samples().empty());
+}
+
+/**
+ * Only the first of every N samples is accepted.
+ */
+TEST(SampleThrottleTest, every)
+{
+    SampleThrottle throttle(SampleThrottle::UNLIMITED_RATE, 3);
+    ASSERT_TRUE(throttle.limited());
+
+    std::vector<bool> accepted;
+    for (int i = 0; i < 7; ++i)
+    {
+        accepted.push_back(throttle.accept("topic", test::at_ms(0)));
+    }
+
+    ASSERT_EQ(accepted, std::vector<bool>({true, false, false, true, false, false, true}));
+    ASSERT_EQ(throttle.suppressed_samples(), (std::map<std::string, uint64_t>{{"topic", 4}}));
+}
+
+/**
+ * At most max_rate samples per second are accepted.
+ */
+TEST(SampleThrottleTest, max_rate)
+{
+    // One sample every 100 ms
+    SampleThrottle throttle(10);
+    ASSERT_TRUE(throttle.limited());
+
+    ASSERT_TRUE(throttle.accept("topic", test::at_ms(0)));
+    ASSERT_FALSE(throttle.accept("topic", test::at_ms(1)));
+    ASSERT_FALSE(throttle.accept("topic", test::at_ms(99)));
+    ASSERT_TRUE(throttle.accept("topic", test::at_ms(100)));
+    ASSERT_FALSE(throttle.accept("topic", test::at_ms(150)));
+    ASSERT_TRUE(throttle.accept("topic", test::at_ms(1000)));
+
+    ASSERT_EQ(throttle.suppressed_samples(), (std::map<std::string, uint64_t>{{"topic", 3}}));
+}
+
+/**
+ * The rate limit applies to the samples kept by the decimation.
+ */
+TEST(SampleThrottleTest, every_and_max_rate)
+{
+    SampleThrottle throttle(10, 2);
+
+    ASSERT_TRUE(throttle.accept("topic", test::at_ms(0)));
+    ASSERT_FALSE(throttle.accept("topic", test::at_ms(200)));   // decimated
+    ASSERT_FALSE(throttle.accept("topic", test::at_ms(50)));    // rate limited
+    ASSERT_FALSE(throttle.accept("topic", test::at_ms(300)));   // decimated
+    ASSERT_TRUE(throttle.accept("topic", test::at_ms(400)));
+
+    ASSERT_EQ(throttle.suppressed_samples(), (std::map<std::string, uint64_t>{{"topic", 3}}));
+}
+
+/**
+ * Each topic has its own counters.
+ */
+TEST(SampleThrottleTest, per_topic)
+{
+    SampleThrottle throttle(SampleThrottle::UNLIMITED_RATE, 2);
+
+    ASSERT_TRUE(throttle.accept("topic_1", test::at_ms(0)));
+    ASSERT_TRUE(throttle.accept("topic_2", test::at_ms(0)));
+    ASSERT_FALSE(throttle.accept("topic_1", test::at_ms(0)));
+    ASSERT_TRUE(throttle.accept("topic_1", test::at_ms(0)));
+    ASSERT_FALSE(throttle.accept("topic_1", test::at_ms(0)));
+
+    ASSERT_EQ(throttle.suppressed_samples(), (std::map<std::string, uint64_t>{{"topic_1", 2}}));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
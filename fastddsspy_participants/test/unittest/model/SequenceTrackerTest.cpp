@@ -0,0 +1,206 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastddsspy_participants/model/SequenceTracker.hpp>
+
+using namespace eprosima::spy::participants;
+
+namespace test {
+
+constexpr int64_t MS = 1000000;
+
+//! Window of 5 seconds
+constexpr int64_t WINDOW = 5000 * MS;
+
+//! Add the samples from \c first to \c last, 1 ms apart, that \c received tells
+template <typename Received>
+void add_samples(
+        SequenceTracker& tracker,
+        uint64_t first,
+        uint64_t last,
+        Received received)
+{
+    for (uint64_t sequence_number = first; sequence_number <= last; ++sequence_number)
+    {
+        if (received(sequence_number))
+        {
+            const int64_t time = static_cast<int64_t>(sequence_number) * MS;
+            tracker.add(sequence_number, time, WINDOW, time, false);
+        }
+    }
+}
+
+} /* namespace test */
+
+TEST(SequenceTrackerTest, empty)
+{
+    SequenceTracker tracker;
+
+    SequenceTracker::Snapshot snapshot = tracker.snapshot(0, test::WINDOW);
+    ASSERT_EQ(snapshot.received, 0u);
+    ASSERT_EQ(snapshot.lost, 0u);
+    ASSERT_EQ(snapshot.out_of_order, 0u);
+    ASSERT_EQ(snapshot.duplicates, 0u);
+    ASSERT_EQ(snapshot.loss_ratio, 0);
+    ASSERT_EQ(snapshot.jitter.count, 0u);
+}
+
+/**
+ * Samples received in order, from a writer that had sent samples before the first one received.
+ */
+TEST(SequenceTrackerTest, in_order)
+{
+    SequenceTracker tracker;
+    test::add_samples(tracker, 100, 1099, [](uint64_t)
+            {
+                return true;
+            });
+
+    SequenceTracker::Snapshot snapshot = tracker.snapshot(1099 * test::MS, test::WINDOW);
+    ASSERT_EQ(snapshot.received, 1000u);
+    ASSERT_EQ(snapshot.lost, 0u);
+    ASSERT_EQ(snapshot.out_of_order, 0u);
+    ASSERT_EQ(snapshot.duplicates, 0u);
+    ASSERT_NEAR(snapshot.loss_ratio, 0, 1e-9);
+}
+
+TEST(SequenceTrackerTest, lost)
+{
+    SequenceTracker tracker;
+
+    // 1 of every 10 samples lost, and a gap longer than the history
+    test::add_samples(tracker, 1, 1000, [](uint64_t sequence_number)
+            {
+                return sequence_number % 10 != 5;
+            });
+    test::add_samples(tracker, 2001, 3000, [](uint64_t sequence_number)
+            {
+                return sequence_number % 10 != 5;
+            });
+
+    SequenceTracker::Snapshot snapshot = tracker.snapshot(3000 * test::MS, test::WINDOW);
+    ASSERT_EQ(snapshot.received, 1800u);
+    ASSERT_EQ(snapshot.lost, 1200u);
+    ASSERT_EQ(snapshot.out_of_order, 0u);
+    ASSERT_EQ(snapshot.duplicates, 0u);
+
+    // The window covers the lost samples and the gap, weighted
+    ASSERT_GT(snapshot.loss_ratio, 0.1);
+    ASSERT_LT(snapshot.loss_ratio, 0.5);
+
+    // Once the gap leaves the window, only 1 of every 10 samples is lost
+    test::add_samples(tracker, 3001, 12000, [](uint64_t sequence_number)
+            {
+                return sequence_number % 10 != 5;
+            });
+    ASSERT_NEAR(tracker.snapshot(12000 * test::MS, test::WINDOW).loss_ratio, 0.1, 0.01);
+}
+
+TEST(SequenceTrackerTest, out_of_order)
+{
+    SequenceTracker tracker;
+
+    // Each pair of samples swapped
+    for (uint64_t sequence_number = 1; sequence_number <= 1000; sequence_number += 2)
+    {
+        const int64_t time = static_cast<int64_t>(sequence_number) * test::MS;
+        tracker.add(sequence_number + 1, time, test::WINDOW, time, false);
+        tracker.add(sequence_number, time, test::WINDOW, time, false);
+    }
+
+    SequenceTracker::Snapshot snapshot = tracker.snapshot(1000 * test::MS, test::WINDOW);
+    ASSERT_EQ(snapshot.received, 1000u);
+    ASSERT_EQ(snapshot.out_of_order, 500u);
+    ASSERT_EQ(snapshot.duplicates, 0u);
+
+    // The first sample received is 2, so 1 is not known to be sent before it
+    ASSERT_EQ(snapshot.lost, 0u);
+    ASSERT_NEAR(snapshot.loss_ratio, 0, 0.01);
+
+    // A sample older than the history is taken as a late one, even if it was already received
+    tracker.add(1, 1000 * test::MS, test::WINDOW, 1000 * test::MS, false);
+    snapshot = tracker.snapshot(1000 * test::MS, test::WINDOW);
+    ASSERT_EQ(snapshot.out_of_order, 501u);
+    ASSERT_EQ(snapshot.duplicates, 0u);
+}
+
+TEST(SequenceTrackerTest, duplicates)
+{
+    SequenceTracker tracker;
+    test::add_samples(tracker, 1, 100, [](uint64_t)
+            {
+                return true;
+            });
+
+    // Samples received again, as from a writer sending them twice
+    test::add_samples(tracker, 1, 100, [](uint64_t sequence_number)
+            {
+                return sequence_number > 50;
+            });
+
+    // A skipped sample received later is not a duplicate, but a second time it is
+    tracker.add(102, 101 * test::MS, test::WINDOW, 101 * test::MS, false);
+    tracker.add(101, 102 * test::MS, test::WINDOW, 102 * test::MS, false);
+    tracker.add(101, 103 * test::MS, test::WINDOW, 103 * test::MS, false);
+
+    SequenceTracker::Snapshot snapshot = tracker.snapshot(103 * test::MS, test::WINDOW);
+    ASSERT_EQ(snapshot.received, 102u);
+    ASSERT_EQ(snapshot.lost, 0u);
+    ASSERT_EQ(snapshot.out_of_order, 1u);
+    ASSERT_EQ(snapshot.duplicates, 51u);
+    ASSERT_NEAR(snapshot.loss_ratio, 0, 1e-9);
+}
+
+/**
+ * The jitter is only measured for live samples, from the time between them.
+ */
+TEST(SequenceTrackerTest, jitter)
+{
+    SequenceTracker tracker;
+
+    // Sent every 10 ms, received alternating 8 and 12 ms apart
+    int64_t time = 0;
+    for (uint64_t sequence_number = 1; sequence_number <= 100; ++sequence_number)
+    {
+        const int64_t source_time = static_cast<int64_t>(sequence_number) * 10 * test::MS;
+        time += sequence_number % 2 ? 8 * test::MS : 12 * test::MS;
+        tracker.add(sequence_number, time, test::WINDOW, source_time, true);
+    }
+
+    SequenceTracker::Snapshot snapshot = tracker.snapshot(time, test::WINDOW);
+    ASSERT_EQ(snapshot.jitter.count, 99u);
+    ASSERT_NEAR(snapshot.jitter.mean(), 2 * test::MS, 1);
+    ASSERT_EQ(snapshot.jitter.max, 2 * test::MS);
+
+    // Samples not live have no jitter
+    SequenceTracker not_live;
+    test::add_samples(not_live, 1, 100, [](uint64_t)
+            {
+                return true;
+            });
+    ASSERT_EQ(not_live.snapshot(100 * test::MS, test::WINDOW).jitter.count, 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,137 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <string>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastddsspy_participants/model/TopicRanking.hpp>
+
+using namespace eprosima::spy::participants;
+
+namespace test {
+
+TopicActivity activity(
+        const std::string& topic_name,
+        float rate,
+        float bandwidth,
+        uint32_t writers)
+{
+    TopicActivity result;
+    result.topic_name = topic_name;
+    result.rate = rate;
+    result.bandwidth = bandwidth;
+    result.writers = writers;
+    return result;
+}
+
+//! Names of \c activities, in order
+std::vector<std::string> names(
+        const std::vector<TopicActivity>& activities)
+{
+    std::vector<std::string> result;
+    for (const auto& activity : activities)
+    {
+        result.push_back(activity.topic_name);
+    }
+    return result;
+}
+
+//! Add to \c ranking topics "0" to "9", with decreasing rates, increasing bandwidths and alternating writers
+void add_topics(
+        TopicRanking& ranking)
+{
+    for (int i = 0; i < 10; ++i)
+    {
+        ranking.add(activity(std::to_string(i), 10.0f - i, 100.0f * i, i % 2 ? 1 : 3));
+    }
+}
+
+} /* namespace test */
+
+/**
+ * A ranking with no topics added is empty.
+ */
+TEST(TopicRankingTest, empty)
+{
+    TopicRanking ranking(5, TopicRanking::Key::rate);
+    ASSERT_TRUE(ranking.take().empty());
+
+    TopicRanking no_size(0, TopicRanking::Key::rate);
+    test::add_topics(no_size);
+    ASSERT_TRUE(no_size.take().empty());
+}
+
+/**
+ * Only the topics with the highest rates are kept, from the highest.
+ */
+TEST(TopicRankingTest, rate)
+{
+    TopicRanking ranking(3, TopicRanking::Key::rate);
+    test::add_topics(ranking);
+
+    std::vector<TopicActivity> top = ranking.take();
+    ASSERT_EQ(test::names(top), (std::vector<std::string>{"0", "1", "2"}));
+    ASSERT_EQ(top[0].rate, 10.0f);
+    ASSERT_EQ(top[0].bandwidth, 0.0f);
+    ASSERT_EQ(top[0].writers, 3u);
+
+    // Taking the topics leaves the ranking empty
+    ASSERT_TRUE(ranking.take().empty());
+}
+
+/**
+ * Only the topics with the highest bandwidths are kept, from the highest.
+ */
+TEST(TopicRankingTest, bandwidth)
+{
+    TopicRanking ranking(3, TopicRanking::Key::bandwidth);
+    test::add_topics(ranking);
+
+    ASSERT_EQ(test::names(ranking.take()), (std::vector<std::string>{"9", "8", "7"}));
+}
+
+/**
+ * Topics with the same number of writers are ranked by name.
+ */
+TEST(TopicRankingTest, writers)
+{
+    TopicRanking ranking(4, TopicRanking::Key::writers);
+    test::add_topics(ranking);
+
+    ASSERT_EQ(test::names(ranking.take()), (std::vector<std::string>{"0", "2", "4", "6"}));
+}
+
+/**
+ * With fewer topics than the size of the ranking, all of them are kept, whatever the order they are added in.
+ */
+TEST(TopicRankingTest, fewer_topics)
+{
+    TopicRanking ranking(10, TopicRanking::Key::rate);
+    ranking.add(test::activity("b", 1, 0, 0));
+    ranking.add(test::activity("c", 2, 0, 0));
+    ranking.add(test::activity("a", 1, 0, 0));
+
+    ASSERT_EQ(test::names(ranking.take()), (std::vector<std::string>{"c", "a", "b"}));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,241 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/SequenceNumber.hpp>
+
+#include <fastddsspy_participants/model/TopicRateCalculator.hpp>
+
+using namespace eprosima;
+
+namespace test {
+
+constexpr int64_t PERIOD_NS = 10000000;
+
+//! Calculator of the rates alone, without the types
+class TopicRateCalculator : public spy::participants::TopicRateCalculator
+{
+public:
+
+    void add_schema(
+            const fastdds::dds::DynamicType::_ref_type& dynamic_type,
+            const fastdds::dds::xtypes::TypeIdentifier& type_identifier) override
+    {
+    }
+
+};
+
+//! Run \c function in \c threads threads at once, returning the seconds until all of them finish
+template <typename Function>
+double run_threads(
+        unsigned int threads,
+        Function function)
+{
+    std::atomic<bool> start {false};
+    std::vector<std::thread> running;
+    for (unsigned int i = 0; i < threads; i++)
+    {
+        running.emplace_back(
+            [&start, &function, i]()
+            {
+                while (!start.load())
+                {
+                    std::this_thread::yield();
+                }
+                function(i);
+            });
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    start.store(true);
+    for (auto& thread : running)
+    {
+        thread.join();
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+} /* namespace test */
+
+/**
+ * Data added from more threads than shards is counted exactly once, in its topic.
+ */
+TEST(TopicRateCalculatorTest, add_data_concurrent)
+{
+    constexpr unsigned int THREADS = 12;
+    constexpr unsigned int SAMPLES = 1000;
+
+    test::TopicRateCalculator calculator;
+    calculator.set_live(false);
+    calculator.set_rate_window(std::chrono::milliseconds(2000));
+
+    ddspipe::core::types::DdsTopic topics[2];
+    topics[0].m_topic_name = "topic1";
+    topics[0].type_name = "type1";
+    topics[1].m_topic_name = "topic2";
+    topics[1].type_name = "type2";
+
+    // Each thread adds data at 100 Hz for 10 seconds to one of the topics
+    test::run_threads(
+        THREADS,
+        [&calculator, &topics](unsigned int thread)
+        {
+            ddspipe::core::types::RtpsPayloadData data;
+            data.payload.length = 100 + thread % 2;
+            for (unsigned int i = 0; i < SAMPLES; i++)
+            {
+                data.source_timestamp.from_ns(i * test::PERIOD_NS);
+                calculator.add_data(topics[thread % 2], data);
+            }
+        });
+
+    for (unsigned int topic = 0; topic < 2; topic++)
+    {
+        constexpr unsigned int TOPIC_THREADS = THREADS / 2;
+
+        ASSERT_NEAR(calculator.get_topic_rate(topics[topic]), 100 * TOPIC_THREADS, 2 * TOPIC_THREADS);
+        ASSERT_NEAR(
+            calculator.get_topic_average_rate(topics[topic]),
+            SAMPLES * TOPIC_THREADS / ((SAMPLES - 1) * test::PERIOD_NS / 1e9),
+            1);
+
+        auto traffic = calculator.get_topic_traffic(topics[topic]);
+        ASSERT_EQ(traffic.topic.payload_size.count, SAMPLES * TOPIC_THREADS);
+        ASSERT_EQ(traffic.topic.payload_size.min, 100u + topic);
+        ASSERT_EQ(traffic.topic.payload_size.max, 100u + topic);
+        ASSERT_EQ(traffic.topic.payload_size.buckets[7], SAMPLES * TOPIC_THREADS);
+        ASSERT_NEAR(traffic.topic.bandwidth, 100 * TOPIC_THREADS * (100 + topic), 2 * TOPIC_THREADS * (100 + topic));
+    }
+}
+
+/**
+ * Data of several writers added from several threads at once is counted by its writer.
+ */
+TEST(TopicRateCalculatorTest, writers_concurrent)
+{
+    constexpr unsigned int THREADS = 4;
+    constexpr unsigned int WRITERS = 3;
+    constexpr unsigned int SAMPLES = 3000;
+
+    test::TopicRateCalculator calculator;
+    calculator.set_live(false);
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    // Each thread alternates the writers, so the writer of each data changes
+    test::run_threads(
+        THREADS,
+        [&calculator, &topic](unsigned int thread)
+        {
+            ddspipe::core::types::RtpsPayloadData data;
+            for (unsigned int i = 0; i < SAMPLES; i++)
+            {
+                const unsigned int writer = (i + thread) % WRITERS;
+                data.source_guid.entityId.value[3] = static_cast<uint8_t>(1 + writer);
+                data.source_timestamp.from_ns(i * test::PERIOD_NS);
+                data.payload.length = 100 * (1 + writer);
+                calculator.add_data(topic, data);
+            }
+        });
+
+    auto traffic = calculator.get_topic_traffic(topic);
+    ASSERT_EQ(traffic.topic.payload_size.count, SAMPLES * THREADS);
+    ASSERT_EQ(traffic.topic.payload_size.min, 100u);
+    ASSERT_EQ(traffic.topic.payload_size.max, 100u * WRITERS);
+
+    ASSERT_EQ(traffic.writers.size(), WRITERS);
+    for (const auto& writer : traffic.writers)
+    {
+        const uint32_t size = 100 * writer.first.entityId.value[3];
+        ASSERT_EQ(writer.second.payload_size.count, SAMPLES * THREADS / WRITERS);
+        ASSERT_EQ(writer.second.payload_size.min, size);
+        ASSERT_EQ(writer.second.payload_size.max, size);
+        ASSERT_EQ(writer.second.payload_size.sum, uint64_t(size) * SAMPLES * THREADS / WRITERS);
+    }
+}
+
+/**
+ * The sequence numbers of the data of each writer tell the samples lost, and data without them is not checked.
+ */
+TEST(TopicRateCalculatorTest, samples)
+{
+    test::TopicRateCalculator calculator;
+    calculator.set_live(false);
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "topic1";
+    topic.type_name = "type1";
+
+    ddspipe::core::types::Guid writers[3];
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        writers[i].entityId.value[3] = 1 + i;
+    }
+
+    // The first writer loses 1 of every 4 samples, the second none, and the third does not number them
+    for (uint64_t sequence_number = 1; sequence_number <= 400; sequence_number++)
+    {
+        for (unsigned int writer = 0; writer < 3; writer++)
+        {
+            if (writer == 0 && sequence_number % 4 == 0)
+            {
+                continue;
+            }
+
+            ddspipe::core::types::RtpsPayloadData data;
+            data.source_guid = writers[writer];
+            data.source_timestamp.from_ns(sequence_number * test::PERIOD_NS);
+            if (writer != 2)
+            {
+                data.origin_sequence_number = fastdds::rtps::SequenceNumber_t(sequence_number);
+            }
+            calculator.add_data(topic, data);
+        }
+    }
+
+    auto samples = calculator.get_topic_samples(topic);
+    ASSERT_EQ(samples.size(), 3u);
+    ASSERT_EQ(samples[writers[0]].received, 300u);
+    ASSERT_EQ(samples[writers[0]].lost, 99u);
+    ASSERT_NEAR(samples[writers[0]].loss_ratio, 0.25, 0.01);
+    ASSERT_EQ(samples[writers[1]].received, 400u);
+    ASSERT_EQ(samples[writers[1]].lost, 0u);
+    ASSERT_EQ(samples[writers[2]].received, 0u);
+
+    ASSERT_EQ(calculator.get_writer_samples(writers[0]).lost, 99u);
+    ASSERT_EQ(calculator.get_writer_samples(writers[1]).received, 400u);
+
+    ddspipe::core::types::Guid unknown_writer;
+    unknown_writer.entityId.value[3] = 4;
+    ASSERT_EQ(calculator.get_writer_samples(unknown_writer).received, 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,127 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
+
+#include <fastddsspy_participants/testing/random_values.hpp>
+#include <fastddsspy_participants/testing/dynamic_types_utils.hpp>
+
+using namespace eprosima;
+using namespace eprosima::spy::participants;
+
+TEST(TypeDecoderTest, deserialize)
+{
+    auto dyn_type = spy::participants::testing::create_test_type_with_keys("TestType", {"id"});
+    auto decoder = std::make_shared<TypeDecoder>(dyn_type);
+    ASSERT_EQ(decoder->type(), dyn_type);
+
+    auto writer_guid = ddspipe::core::testing::random_guid();
+    auto data = spy::participants::testing::create_test_data_with_keys(dyn_type, {{"id", 100}}, writer_guid);
+
+    auto dyn_data = decoder->deserialize(*data);
+    ASSERT_TRUE(dyn_data);
+
+    int32_t value = 0;
+    ASSERT_EQ(dyn_data.get()->get_int32_value(value, 0), fastdds::dds::RETCODE_OK);
+    ASSERT_EQ(value, 100);
+    ASSERT_EQ(dyn_data.get()->get_int32_value(value, 1), fastdds::dds::RETCODE_OK);
+    ASSERT_EQ(value, 42);
+}
+
+/**
+ * Data given back to the decoder is cleared and reused by the next loan.
+ */
+TEST(TypeDecoderTest, reuse_data)
+{
+    auto dyn_type = spy::participants::testing::create_test_type_with_keys("TestType", {"id"});
+    auto decoder = std::make_shared<TypeDecoder>(dyn_type);
+
+    auto writer_guid = ddspipe::core::testing::random_guid();
+    auto data = spy::participants::testing::create_test_data_with_keys(dyn_type, {{"id", 100}}, writer_guid);
+
+    fastdds::dds::DynamicData* first_data = nullptr;
+    {
+        auto dyn_data = decoder->deserialize(*data);
+        ASSERT_TRUE(dyn_data);
+        first_data = dyn_data.get().get();
+
+        // Data in use is not lent twice
+        auto other_data = decoder->loan();
+        ASSERT_TRUE(other_data);
+        ASSERT_NE(other_data.get().get(), first_data);
+    }
+
+    // Last data given back is lent first
+    auto dyn_data = decoder->loan();
+    ASSERT_EQ(dyn_data.get().get(), first_data);
+
+    int32_t value = -1;
+    ASSERT_EQ(dyn_data.get()->get_int32_value(value, 0), fastdds::dds::RETCODE_OK);
+    ASSERT_EQ(value, 0);
+}
+
+/**
+ * A loan outlives its decoder.
+ */
+TEST(TypeDecoderTest, loan_outlives_decoder)
+{
+    auto dyn_type = spy::participants::testing::create_test_type_with_keys("TestType", {"id"});
+    auto decoder = std::make_shared<TypeDecoder>(dyn_type);
+
+    auto dyn_data = decoder->loan();
+    decoder.reset();
+
+    ASSERT_TRUE(dyn_data);
+    ASSERT_EQ(dyn_data.get()->set_int32_value(0, 7), fastdds::dds::RETCODE_OK);
+}
+
+TEST(TypeDecoderTest, deserialize_invalid_payload)
+{
+    auto dyn_type = spy::participants::testing::create_test_type_with_keys("TestType", {"id"});
+    auto decoder = std::make_shared<TypeDecoder>(dyn_type);
+
+    // Encapsulation header only
+    ddspipe::core::types::RtpsPayloadData data;
+    data.payload.reserve(4);
+    data.payload.data[0] = 0x00;
+    data.payload.data[1] = 0x01;
+    data.payload.data[2] = 0x00;
+    data.payload.data[3] = 0x00;
+    data.payload.length = 4;
+
+    ASSERT_FALSE(decoder->deserialize(data));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
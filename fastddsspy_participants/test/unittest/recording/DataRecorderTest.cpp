@@ -0,0 +1,194 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
+#include <fastddsspy_participants/recording/DataRecorder.hpp>
+#include <fastddsspy_participants/recording/RecordReader.hpp>
+#include <fastddsspy_participants/recording/type_serialization.hpp>
+
+#include <fastddsspy_participants/testing/random_values.hpp>
+#include <fastddsspy_participants/testing/dynamic_types_utils.hpp>
+
+using namespace eprosima;
+
+namespace {
+
+const char* TEST_FILE = "DataRecorderTest.fddsspy";
+
+//! Decoder of a type registered in the type object registry, as discovered types are
+std::shared_ptr<spy::participants::TypeDecoder> create_registered_decoder(
+        const std::string& type_name)
+{
+    auto dyn_type = spy::participants::testing::create_test_type_with_keys(type_name, {"id"});
+
+    fastdds::dds::DynamicPubSubType pubsub_type(dyn_type);
+    pubsub_type.register_type_object_representation();
+
+    fastdds::dds::xtypes::TypeIdentifierPair type_identifiers;
+    fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+        type_name, type_identifiers);
+
+    return std::make_shared<spy::participants::TypeDecoder>(dyn_type, type_identifiers.type_identifier1());
+}
+
+} /* namespace */
+
+/**
+ * Samples recorded are read back with their topic, writer and payload, after the type and topic records they need.
+ */
+TEST(DataRecorderTest, record_samples)
+{
+    auto decoder = create_registered_decoder("RecordedType");
+
+    ddspipe::core::types::DdsTopic topic_1;
+    topic_1.m_topic_name = "RecordedTopic1";
+    topic_1.type_name = "RecordedType";
+
+    ddspipe::core::types::DdsTopic topic_2;
+    topic_2.m_topic_name = "RecordedTopic2";
+    topic_2.type_name = "RecordedType";
+
+    const auto writer_guid = ddspipe::core::testing::random_guid();
+
+    std::vector<std::unique_ptr<ddspipe::core::types::RtpsPayloadData>> samples;
+    for (int32_t i = 0; i < 5; ++i)
+    {
+        samples.push_back(spy::participants::testing::create_test_data_with_keys(
+                    decoder->type(), {{"id", i}}, writer_guid));
+    }
+
+    spy::participants::DataRecorder recorder;
+    ASSERT_TRUE(recorder.open(TEST_FILE));
+    for (std::size_t i = 0; i < samples.size(); ++i)
+    {
+        recorder.record(i % 2 ? topic_2 : topic_1, decoder, *samples[i]);
+    }
+    recorder.close();
+
+    ASSERT_EQ(recorder.samples(), samples.size());
+
+    spy::participants::RecordReader reader;
+    ASSERT_TRUE(reader.open(TEST_FILE));
+
+    std::map<uint32_t, std::string> topics;
+    std::size_t types = 0;
+    std::size_t sample_index = 0;
+
+    spy::participants::RecordReader::Record record;
+    while (reader.next(record))
+    {
+        switch (record.kind)
+        {
+            case spy::participants::RecordKind::type:
+            {
+                spy::participants::RecordReader::TypeRecord type;
+                ASSERT_TRUE(spy::participants::RecordReader::read_type(record, type));
+                ASSERT_EQ(type.type_name, "RecordedType");
+                ASSERT_FALSE(type.type_objects.empty());
+
+                // The type objects recorded are enough to build the type
+                fastdds::dds::xtypes::TypeIdentifier type_identifier;
+                auto dyn_type = spy::participants::deserialize_type_objects(type.type_objects, type_identifier);
+                ASSERT_NE(dyn_type, nullptr);
+                ASSERT_TRUE(dyn_type->equals(decoder->type()));
+                ++types;
+                break;
+            }
+
+            case spy::participants::RecordKind::topic:
+            {
+                spy::participants::RecordReader::TopicRecord topic;
+                ASSERT_TRUE(spy::participants::RecordReader::read_topic(record, topic));
+                ASSERT_EQ(types, 1u);
+                ASSERT_EQ(topic.type_name, "RecordedType");
+                topics[topic.topic_id] = topic.topic_name;
+                break;
+            }
+
+            case spy::participants::RecordKind::sample:
+            {
+                spy::participants::RecordReader::SampleRecord sample;
+                ASSERT_TRUE(spy::participants::RecordReader::read_sample(record, sample));
+                ASSERT_LT(sample_index, samples.size());
+
+                const auto& expected = *samples[sample_index];
+                ASSERT_EQ(topics.at(sample.header.topic_id), sample_index % 2 ? "RecordedTopic2" : "RecordedTopic1");
+                ASSERT_EQ(sample.payload_size, expected.payload.length);
+                ASSERT_EQ(std::memcmp(sample.payload, expected.payload.data, expected.payload.length), 0);
+                ASSERT_EQ(std::memcmp(sample.header.writer_guid, writer_guid.guidPrefix.value, 12), 0);
+                ASSERT_EQ(std::memcmp(sample.header.writer_guid + 12, writer_guid.entityId.value, 4), 0);
+                ++sample_index;
+                break;
+            }
+
+            default:
+                FAIL() << "Unexpected record kind";
+        }
+    }
+
+    ASSERT_EQ(types, 1u);
+    ASSERT_EQ(topics.size(), 2u);
+    ASSERT_EQ(sample_index, samples.size());
+
+    reader.close();
+    std::remove(TEST_FILE);
+}
+
+/**
+ * Samples are not recorded while the recorder is closed.
+ */
+TEST(DataRecorderTest, record_closed)
+{
+    auto decoder = create_registered_decoder("ClosedType");
+
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = "ClosedTopic";
+    topic.type_name = "ClosedType";
+
+    auto data = spy::participants::testing::create_test_data_with_keys(
+        decoder->type(), {{"id", 1}}, ddspipe::core::testing::random_guid());
+
+    spy::participants::DataRecorder recorder;
+    recorder.record(topic, decoder, *data);
+    ASSERT_EQ(recorder.samples(), 0u);
+
+    ASSERT_TRUE(recorder.open(TEST_FILE));
+    recorder.record(topic, decoder, *data);
+    recorder.close();
+    recorder.record(topic, decoder, *data);
+    ASSERT_EQ(recorder.samples(), 1u);
+
+    std::remove(TEST_FILE);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
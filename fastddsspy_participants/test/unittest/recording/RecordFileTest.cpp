@@ -0,0 +1,264 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastddsspy_participants/recording/RecordReader.hpp>
+#include <fastddsspy_participants/recording/RecordWriter.hpp>
+
+using namespace eprosima;
+
+namespace {
+
+const char* TEST_FILE = "RecordFileTest.fddsspy";
+
+//! Body of \c size bytes that depend on \c seed
+std::string test_body(
+        std::size_t size,
+        unsigned int seed)
+{
+    std::string body(size, '\0');
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        body[i] = static_cast<char>((i * 31 + seed) & 0xFF);
+    }
+    return body;
+}
+
+} /* namespace */
+
+/**
+ * Records appended are read back in order, with the same kind and body.
+ */
+TEST(RecordFileTest, round_trip)
+{
+    const std::vector<std::string> bodies = {
+        test_body(0, 1), test_body(1, 2), test_body(7, 3), test_body(8, 4), test_body(1000, 5)};
+
+    {
+        spy::participants::RecordWriter writer;
+        ASSERT_TRUE(writer.open(TEST_FILE));
+        for (const auto& body : bodies)
+        {
+            ASSERT_TRUE(writer.append(spy::participants::RecordKind::sample, {{body.data(), body.size()}}));
+        }
+
+        // A body given in several parts is written as one
+        const std::string first = "type";
+        const std::string second = "name";
+        ASSERT_TRUE(writer.append(spy::participants::RecordKind::type,
+                {{first.data(), first.size()}, {second.data(), second.size()}}));
+        writer.close();
+        ASSERT_FALSE(writer.is_open());
+    }
+
+    spy::participants::RecordReader reader;
+    ASSERT_TRUE(reader.open(TEST_FILE));
+
+    spy::participants::RecordReader::Record record;
+    for (const auto& body : bodies)
+    {
+        ASSERT_TRUE(reader.next(record));
+        ASSERT_EQ(record.kind, spy::participants::RecordKind::sample);
+        ASSERT_EQ(std::string(record.body, record.size), body);
+    }
+
+    ASSERT_TRUE(reader.next(record));
+    ASSERT_EQ(record.kind, spy::participants::RecordKind::type);
+    ASSERT_EQ(std::string(record.body, record.size), "typename");
+
+    ASSERT_FALSE(reader.next(record));
+
+    std::remove(TEST_FILE);
+}
+
+/**
+ * Records are written across several segments of the file, including records larger than a segment.
+ */
+TEST(RecordFileTest, segments)
+{
+    constexpr std::size_t SEGMENT_SIZE = 4096;
+    std::vector<std::string> bodies;
+    for (unsigned int i = 0; i < 200; ++i)
+    {
+        bodies.push_back(test_body((i * 977) % (3 * SEGMENT_SIZE), i));
+    }
+
+    uint64_t size = 0;
+    {
+        spy::participants::RecordWriter writer(SEGMENT_SIZE);
+        ASSERT_TRUE(writer.open(TEST_FILE));
+        for (const auto& body : bodies)
+        {
+            ASSERT_TRUE(writer.append(spy::participants::RecordKind::sample, {{body.data(), body.size()}}));
+        }
+        size = writer.size();
+    }
+
+    // The file is truncated to the records written
+    std::ifstream file(TEST_FILE, std::ios::binary | std::ios::ate);
+    ASSERT_EQ(static_cast<uint64_t>(file.tellg()), size);
+
+    spy::participants::RecordReader reader;
+    ASSERT_TRUE(reader.open(TEST_FILE));
+
+    spy::participants::RecordReader::Record record;
+    for (const auto& body : bodies)
+    {
+        ASSERT_TRUE(reader.next(record));
+        ASSERT_EQ(std::string(record.body, record.size), body);
+    }
+    ASSERT_FALSE(reader.next(record));
+
+    std::remove(TEST_FILE);
+}
+
+/**
+ * A file cut in the middle of a record is read up to its last complete record.
+ */
+TEST(RecordFileTest, truncated_file)
+{
+    const std::string body = test_body(100, 7);
+
+    {
+        spy::participants::RecordWriter writer;
+        ASSERT_TRUE(writer.open(TEST_FILE));
+        ASSERT_TRUE(writer.append(spy::participants::RecordKind::sample, {{body.data(), body.size()}}));
+        ASSERT_TRUE(writer.append(spy::participants::RecordKind::sample, {{body.data(), body.size()}}));
+    }
+
+    // Cut the second record
+    std::string contents;
+    {
+        std::ifstream file(TEST_FILE, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream file(TEST_FILE, std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), contents.size() - 50);
+    }
+
+    spy::participants::RecordReader reader;
+    ASSERT_TRUE(reader.open(TEST_FILE));
+
+    spy::participants::RecordReader::Record record;
+    ASSERT_TRUE(reader.next(record));
+    ASSERT_EQ(std::string(record.body, record.size), body);
+    ASSERT_FALSE(reader.next(record));
+
+    std::remove(TEST_FILE);
+}
+
+/**
+ * Files that are not record files are not opened.
+ */
+TEST(RecordFileTest, invalid_file)
+{
+    spy::participants::RecordReader reader;
+
+    std::remove(TEST_FILE);
+    ASSERT_FALSE(reader.open(TEST_FILE));
+
+    {
+        std::ofstream file(TEST_FILE, std::ios::binary | std::ios::trunc);
+    }
+    ASSERT_FALSE(reader.open(TEST_FILE));
+
+    {
+        std::ofstream file(TEST_FILE, std::ios::binary | std::ios::trunc);
+        file << "This is not a record file, although it is long enough to hold a file header.";
+    }
+    ASSERT_FALSE(reader.open(TEST_FILE));
+    ASSERT_FALSE(reader.is_open());
+
+    std::remove(TEST_FILE);
+}
+
+/**
+ * Bodies of type, topic and sample records are read as written.
+ */
+TEST(RecordFileTest, read_records)
+{
+    const auto append_string = [](const std::string& value, std::string& body)
+            {
+                const uint32_t size = static_cast<uint32_t>(value.size());
+                body.append(reinterpret_cast<const char*>(&size), sizeof(size));
+                body.append(value);
+            };
+
+    spy::participants::RecordReader::Record record;
+
+    // Type record
+    std::string type_body;
+    append_string("TestType", type_body);
+    const uint32_t count = 2;
+    type_body.append(reinterpret_cast<const char*>(&count), sizeof(count));
+    append_string("first", type_body);
+    append_string("second", type_body);
+
+    record = {spy::participants::RecordKind::type, type_body.data(), static_cast<uint32_t>(type_body.size())};
+    spy::participants::RecordReader::TypeRecord type;
+    ASSERT_TRUE(spy::participants::RecordReader::read_type(record, type));
+    ASSERT_EQ(type.type_name, "TestType");
+    ASSERT_EQ(type.type_objects, (std::vector<std::string>{"first", "second"}));
+
+    // A body cut short is not valid
+    record.size -= 1;
+    ASSERT_FALSE(spy::participants::RecordReader::read_type(record, type));
+
+    // Topic record
+    std::string topic_body;
+    const uint32_t topic_id = 3;
+    topic_body.append(reinterpret_cast<const char*>(&topic_id), sizeof(topic_id));
+    append_string("TestTopic", topic_body);
+    append_string("TestType", topic_body);
+
+    record = {spy::participants::RecordKind::topic, topic_body.data(), static_cast<uint32_t>(topic_body.size())};
+    spy::participants::RecordReader::TopicRecord topic;
+    ASSERT_TRUE(spy::participants::RecordReader::read_topic(record, topic));
+    ASSERT_EQ(topic.topic_id, 3u);
+    ASSERT_EQ(topic.topic_name, "TestTopic");
+    ASSERT_EQ(topic.type_name, "TestType");
+
+    // The kind of the record must match
+    ASSERT_FALSE(spy::participants::RecordReader::read_type(record, type));
+
+    // Sample record
+    spy::participants::SampleRecordHeader header {};
+    header.topic_id = 3;
+    header.sequence_number = 42;
+    std::string sample_body(reinterpret_cast<const char*>(&header), sizeof(header));
+    sample_body.append("payload");
+
+    record = {spy::participants::RecordKind::sample, sample_body.data(), static_cast<uint32_t>(sample_body.size())};
+    spy::participants::RecordReader::SampleRecord sample;
+    ASSERT_TRUE(spy::participants::RecordReader::read_sample(record, sample));
+    ASSERT_EQ(sample.header.topic_id, 3u);
+    ASSERT_EQ(sample.header.sequence_number, 42u);
+    ASSERT_EQ(std::string(sample.payload, sample.payload_size), "payload");
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
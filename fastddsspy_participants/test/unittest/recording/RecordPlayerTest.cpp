@@ -0,0 +1,218 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+
+#include <fastddsspy_participants/model/SpyModel.hpp>
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
+#include <fastddsspy_participants/recording/DataRecorder.hpp>
+#include <fastddsspy_participants/recording/RecordPlayer.hpp>
+#include <fastddsspy_participants/visualization/ModelParser.hpp>
+
+#include <fastddsspy_participants/testing/random_values.hpp>
+#include <fastddsspy_participants/testing/dynamic_types_utils.hpp>
+
+using namespace eprosima;
+
+namespace {
+
+const char* TEST_FILE = "RecordPlayerTest.fddsspy";
+
+constexpr int64_t SAMPLE_PERIOD_NS = 10000000;
+
+//! Decoder of a type registered in the type object registry, as discovered types are
+std::shared_ptr<spy::participants::TypeDecoder> create_registered_decoder(
+        const std::string& type_name)
+{
+    auto dyn_type = spy::participants::testing::create_test_type_with_keys(type_name, {"id"});
+
+    fastdds::dds::DynamicPubSubType pubsub_type(dyn_type);
+    pubsub_type.register_type_object_representation();
+
+    fastdds::dds::xtypes::TypeIdentifierPair type_identifiers;
+    fastdds::dds::DomainParticipantFactory::get_instance()->type_object_registry().get_type_identifiers(
+        type_name, type_identifiers);
+
+    return std::make_shared<spy::participants::TypeDecoder>(dyn_type, type_identifiers.type_identifier1());
+}
+
+ddspipe::core::types::DdsTopic create_topic(
+        const std::string& topic_name,
+        const std::string& type_name)
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = topic_name;
+    topic.type_name = type_name;
+    return topic;
+}
+
+/**
+ * Fill \c live_model with the samples of \c topics as received, and record them in \c TEST_FILE
+ *
+ * Topic i gets (i + 1) * 10 samples of 3 instances, sent every \c SAMPLE_PERIOD_NS.
+ */
+void receive_and_record(
+        spy::participants::SpyModel& live_model,
+        const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
+        const std::vector<ddspipe::core::types::DdsTopic>& topics)
+{
+    live_model.add_schema(decoder->type(), decoder->type_identifier());
+
+    spy::participants::DataRecorder recorder;
+    ASSERT_TRUE(recorder.open(TEST_FILE));
+
+    for (std::size_t i = 0; i < topics.size(); ++i)
+    {
+        const auto writer_guid = ddspipe::core::testing::random_guid(static_cast<unsigned int>(i));
+
+        spy::participants::EndpointInfoData endpoint;
+        endpoint.info.kind = ddspipe::core::types::EndpointKind::writer;
+        endpoint.info.guid = writer_guid;
+        endpoint.info.topic = topics[i];
+        endpoint.info.active = true;
+        live_model.endpoint_database_.add_or_modify(ddspipe::core::types::Guid(writer_guid), std::move(endpoint));
+
+        for (int32_t j = 0; j < static_cast<int32_t>((i + 1) * 10); ++j)
+        {
+            auto data = spy::participants::testing::create_test_data_with_keys(
+                decoder->type(), {{"id", j % 3}}, writer_guid);
+            data->source_timestamp.from_ns(j * SAMPLE_PERIOD_NS);
+
+            live_model.add_data(topics[i], *data);
+            recorder.record(topics[i], decoder, *data);
+        }
+    }
+
+    recorder.close();
+}
+
+} /* namespace */
+
+/**
+ * A model loaded from a record file has the same topics, rates, key fields and instances as the model that
+ * received the data recorded.
+ */
+TEST(RecordPlayerTest, load_same_as_live)
+{
+    auto decoder = create_registered_decoder("PlayedType");
+    const std::vector<ddspipe::core::types::DdsTopic> topics = {
+        create_topic("PlayedTopic1", "PlayedType"),
+        create_topic("PlayedTopic2", "PlayedType"),
+        create_topic("PlayedTopic3", "PlayedType"),
+    };
+
+    spy::participants::SpyModel live_model;
+    receive_and_record(live_model, decoder, topics);
+
+    auto offline_model = std::make_shared<spy::participants::SpyModel>();
+    spy::participants::RecordPlayer player(offline_model);
+    ASSERT_TRUE(player.load(TEST_FILE, 4));
+    ASSERT_EQ(player.samples(), 60u);
+
+    const auto offline_topics = spy::participants::ModelParser::get_topics(
+        *offline_model, ddspipe::core::types::WildcardDdsFilterTopic());
+    ASSERT_EQ(offline_topics.size(), topics.size());
+
+    for (const auto& topic : topics)
+    {
+        ASSERT_EQ(offline_topics.count(topic), 1u);
+        ASSERT_TRUE(offline_model->is_topic_type_discovered(topic));
+        ASSERT_EQ(offline_model->get_topic_rate(topic), live_model.get_topic_rate(topic));
+        ASSERT_EQ(offline_model->get_topic_key_fields(topic.m_topic_name),
+                live_model.get_topic_key_fields(topic.m_topic_name));
+        ASSERT_EQ(offline_model->get_topic_instances(topic.m_topic_name),
+                live_model.get_topic_instances(topic.m_topic_name));
+        ASSERT_EQ(offline_model->get_topic_instances(topic.m_topic_name).size(), 3u);
+    }
+
+    std::remove(TEST_FILE);
+}
+
+/**
+ * Replay passes the samples of the topics requested, in the order they were recorded, and applies the limits of
+ * a throttle to the time they were sent.
+ */
+TEST(RecordPlayerTest, replay)
+{
+    auto decoder = create_registered_decoder("ReplayedType");
+    const std::vector<ddspipe::core::types::DdsTopic> topics = {
+        create_topic("ReplayedTopic1", "ReplayedType"),
+        create_topic("ReplayedTopic2", "ReplayedType"),
+    };
+
+    spy::participants::SpyModel live_model;
+    receive_and_record(live_model, decoder, topics);
+
+    auto offline_model = std::make_shared<spy::participants::SpyModel>();
+    spy::participants::RecordPlayer player(offline_model);
+    ASSERT_TRUE(player.load(TEST_FILE));
+
+    // All topics, in the order they were recorded
+    std::vector<int64_t> times;
+    auto callback = [&times](
+        const ddspipe::core::types::DdsTopic&,
+        const std::shared_ptr<spy::participants::TypeDecoder>& decoder,
+        const ddspipe::core::types::RtpsPayloadData& data)
+            {
+                ASSERT_NE(decoder, nullptr);
+                times.push_back(data.source_timestamp.to_ns());
+            };
+    ASSERT_EQ(player.replay_all(callback), 30u);
+    ASSERT_EQ(times.size(), 30u);
+    ASSERT_EQ(times[9], 9 * SAMPLE_PERIOD_NS);
+    ASSERT_EQ(times[10], 0);
+
+    // One topic
+    ddspipe::core::types::WildcardDdsFilterTopic filter;
+    filter.topic_name.set_value("ReplayedTopic2");
+    times.clear();
+    ASSERT_EQ(player.replay(filter, callback), 20u);
+
+    // At most one sample every two periods of the recording
+    auto throttle = std::make_shared<spy::participants::SampleThrottle>(1e9 / (2 * SAMPLE_PERIOD_NS));
+    times.clear();
+    ASSERT_EQ(player.replay(filter, callback, throttle), 10u);
+    ASSERT_EQ(throttle->suppressed_samples().at("ReplayedTopic2"), 10u);
+
+    std::remove(TEST_FILE);
+}
+
+/**
+ * A file that does not exist is not loaded.
+ */
+TEST(RecordPlayerTest, load_missing_file)
+{
+    auto model = std::make_shared<spy::participants::SpyModel>();
+    spy::participants::RecordPlayer player(model);
+    ASSERT_FALSE(player.load("RecordPlayerTest_missing.fddsspy"));
+    ASSERT_EQ(player.samples(), 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
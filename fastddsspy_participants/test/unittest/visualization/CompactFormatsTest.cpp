@@ -0,0 +1,173 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include <fastddsspy_participants/visualization/cbor_utils.hpp>
+#include <fastddsspy_participants/visualization/compact_formats.hpp>
+
+using namespace eprosima;
+using namespace eprosima::spy::participants;
+
+namespace test {
+
+constexpr const char* INITIAL_OUTPUT = "previous output\n";
+
+constexpr const char* TOPIC_NAME = "rt/sensor,front";
+constexpr const char* TYPE_NAME = "sensor_msgs::msg::dds_::Range_";
+constexpr int64_t SOURCE_TIMESTAMP = 1700000000123456789;
+
+//! Compact JSON of the data of a sample, with characters that CSV must quote
+constexpr const char* DATA_JSON = R"({"name":"say \"hi\", twice","values":[1,-2,3.5]})";
+
+ddspipe::core::types::DdsTopic topic()
+{
+    ddspipe::core::types::DdsTopic topic;
+    topic.m_topic_name = TOPIC_NAME;
+    topic.type_name = TYPE_NAME;
+    return topic;
+}
+
+ddspipe::core::types::RtpsPayloadData sample()
+{
+    ddspipe::core::types::RtpsPayloadData data;
+    for (uint8_t i = 0; i < 12; ++i)
+    {
+        data.source_guid.guidPrefix.value[i] = i;
+    }
+    data.source_guid.entityId.value[2] = 0x01;
+    data.source_guid.entityId.value[3] = 0x03;
+    data.source_timestamp.from_ns(SOURCE_TIMESTAMP);
+    return data;
+}
+
+std::string writer_guid(
+        const ddspipe::core::types::RtpsPayloadData& data)
+{
+    std::ostringstream ss;
+    ss << data.source_guid;
+    return ss.str();
+}
+
+} /* namespace test */
+
+/**
+ * A JSON object per line with the metadata of the sample and its data.
+ */
+TEST(CompactFormatsTest, ndjson)
+{
+    const auto data = test::sample();
+
+    ASSERT_TRUE(compact_format_header(CompactFormat::ndjson).empty());
+
+    std::string output = test::INITIAL_OUTPUT;
+    ASSERT_TRUE(append_compact_record(CompactFormat::ndjson, test::topic(), data, test::DATA_JSON, output));
+    ASSERT_EQ(output, std::string(test::INITIAL_OUTPUT) +
+            R"({"topic":"rt/sensor,front","type":"sensor_msgs::msg::dds_::Range_","writer":")" +
+            test::writer_guid(data) + R"(","source_timestamp":1700000000123456789,"data":)" +
+            test::DATA_JSON + "}\n");
+}
+
+/**
+ * A header line and then a line per sample, quoting the fields that need it.
+ */
+TEST(CompactFormatsTest, csv)
+{
+    const auto data = test::sample();
+
+    ASSERT_EQ(compact_format_header(CompactFormat::csv), "topic,type,writer,source_timestamp,data\n");
+
+    std::string output = test::INITIAL_OUTPUT;
+    ASSERT_TRUE(append_compact_record(CompactFormat::csv, test::topic(), data, test::DATA_JSON, output));
+    ASSERT_EQ(output, std::string(test::INITIAL_OUTPUT) +
+            R"("rt/sensor,front",sensor_msgs::msg::dds_::Range_,)" + test::writer_guid(data) +
+            R"(,1700000000123456789,"{""name"":""say \""hi\"", twice"",""values"":[1,-2,3.5]}")" + "\n");
+}
+
+/**
+ * A CBOR map per sample, with the same content as the NDJSON record.
+ */
+TEST(CompactFormatsTest, cbor)
+{
+    const auto data = test::sample();
+
+    ASSERT_TRUE(compact_format_header(CompactFormat::cbor).empty());
+
+    std::string ndjson;
+    ASSERT_TRUE(append_compact_record(CompactFormat::ndjson, test::topic(), data, test::DATA_JSON, ndjson));
+
+    std::string output = test::INITIAL_OUTPUT;
+    ASSERT_TRUE(append_compact_record(CompactFormat::cbor, test::topic(), data, test::DATA_JSON, output));
+    ASSERT_EQ(output.substr(0, std::string(test::INITIAL_OUTPUT).size()), test::INITIAL_OUTPUT);
+
+    const auto record = nlohmann::json::from_cbor(output.substr(std::string(test::INITIAL_OUTPUT).size()));
+    ASSERT_EQ(record, nlohmann::json::parse(ndjson));
+    ASSERT_EQ(record["source_timestamp"].get<int64_t>(), test::SOURCE_TIMESTAMP);
+}
+
+/**
+ * Every JSON value is written as the CBOR item that reads back to the same value, in its shortest encoding.
+ */
+TEST(CompactFormatsTest, cbor_json_values)
+{
+    for (const std::string json : {
+                "{}",
+                "[]",
+                "[0,23,24,255,256,65535,65536,4294967296,18446744073709551615]",
+                "[-1,-24,-25,-256,-257,-9223372036854775808]",
+                "[0.5,0.1,-1e300,1e-10]",
+                "[true,false,null]",
+                R"({"text":"tab\t é 😀","nested":{"array":[{},[]]}})"})
+    {
+        std::string output;
+        ASSERT_TRUE(append_cbor_json(json.data(), json.size(), output)) << json;
+        ASSERT_EQ(nlohmann::json::from_cbor(output), nlohmann::json::parse(json)) << json;
+    }
+
+    // Containers of indefinite length and floats that keep their value in single precision
+    const std::string json = "[1.5,{\"a\":-2}]";
+    std::string output;
+    ASSERT_TRUE(append_cbor_json(json.data(), json.size(), output));
+    ASSERT_EQ(output, std::string("\x9f\xfa\x3f\xc0\x00\x00\xbf\x61\x61\x21\xff\xff", 12));
+}
+
+/**
+ * Documents that are not valid JSON are not written.
+ */
+TEST(CompactFormatsTest, cbor_invalid_json)
+{
+    for (const std::string json : {"", "{", "[1,]", "{\"a\":1}}", "{\"a\" 1}", "nul", "1e400"})
+    {
+        std::string output = test::INITIAL_OUTPUT;
+        ASSERT_FALSE(append_cbor_json(json.data(), json.size(), output)) << json;
+        ASSERT_EQ(output, test::INITIAL_OUTPUT);
+
+        ASSERT_FALSE(append_compact_record(CompactFormat::cbor, test::topic(), test::sample(), json, output)) << json;
+        ASSERT_EQ(output, test::INITIAL_OUTPUT);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
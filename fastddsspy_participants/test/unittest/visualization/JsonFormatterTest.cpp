@@ -0,0 +1,319 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+
+#include <nlohmann/json.hpp>
+
+#include <fastddsspy_participants/visualization/JsonFormatter.hpp>
+
+using namespace eprosima;
+using namespace eprosima::spy::participants;
+
+namespace test {
+
+constexpr const char* INITIAL_OUTPUT = "previous output\n";
+
+/**
+ * Reference layout: parse the document with nlohmann::json and print it with braces and indentation,
+ * arrays of primitives in a single line.
+ */
+void print_reference(
+        const nlohmann::json& j,
+        std::ostream& o,
+        std::size_t indent,
+        std::size_t step)
+{
+    if (j.is_object())
+    {
+        o << "{\n";
+        bool first = true;
+        for (auto it = j.begin(); it != j.end(); ++it)
+        {
+            o << (first ? "" : ",\n") << std::string(indent + step, ' ');
+            o << nlohmann::json(it.key()).dump() << ": ";
+            print_reference(it.value(), o, indent + step, step);
+            first = false;
+        }
+        o << "\n" << std::string(indent, ' ') << "}";
+    }
+    else if (j.is_array())
+    {
+        const bool all_primitives = std::all_of(j.begin(), j.end(),
+                        [](const nlohmann::json& e)
+                        {
+                            return e.is_primitive();
+                        });
+
+        if (all_primitives)
+        {
+            o << "[";
+            for (std::size_t i = 0; i < j.size(); ++i)
+            {
+                o << (i == 0 ? "" : ", ") << j[i].dump();
+            }
+            o << "]";
+        }
+        else
+        {
+            o << "[\n";
+            for (std::size_t i = 0; i < j.size(); ++i)
+            {
+                o << (i == 0 ? "" : ",\n") << std::string(indent + step, ' ');
+                print_reference(j[i], o, indent + step, step);
+            }
+            o << "\n" << std::string(indent, ' ') << "]";
+        }
+    }
+    else
+    {
+        o << j.dump();
+    }
+}
+
+std::string reference(
+        const std::string& json,
+        std::size_t step = JsonFormatter::DEFAULT_INDENT_STEP)
+{
+    std::ostringstream o;
+    print_reference(nlohmann::json::parse(json), o, 0, step);
+    return o.str();
+}
+
+void check_same_as_reference(
+        JsonFormatter& formatter,
+        const std::string& json,
+        std::size_t step = JsonFormatter::DEFAULT_INDENT_STEP)
+{
+    std::string output = INITIAL_OUTPUT;
+    ASSERT_TRUE(formatter.format(json, output)) << json;
+    ASSERT_EQ(output, INITIAL_OUTPUT + reference(json, step)) << json;
+}
+
+void check_same_as_reference(
+        const std::vector<std::string>& documents)
+{
+    JsonFormatter formatter;
+    for (const auto& json : documents)
+    {
+        check_same_as_reference(formatter, json);
+    }
+}
+
+nlohmann::ordered_json random_value(
+        std::mt19937& generator,
+        unsigned int depth)
+{
+    static const std::vector<std::string> NAMES = {"a", "b", "c", "id", "value", "data", "x", "y", "z", "Z", "_", ""};
+    static const std::vector<std::string> STRINGS = {"", "text", "tab\t", "quote\"", "back\\slash", "\x01", "\xc3\xa9",
+                                                     "line\nbreak", "\xf0\x9f\x98\x80", "slash/"};
+
+    std::uniform_int_distribution<int> kind(0, depth < 4 ? 9 : 6);
+    switch (kind(generator))
+    {
+        case 0:
+            return nullptr;
+        case 1:
+            return std::uniform_int_distribution<int>(0, 1)(generator) == 1;
+        case 2:
+            return std::uniform_int_distribution<int64_t>(std::numeric_limits<int64_t>::min())(generator);
+        case 3:
+            return std::uniform_int_distribution<uint64_t>()(generator);
+        case 4:
+            return std::uniform_int_distribution<int>(-1000, 1000)(generator);
+        case 5:
+            return std::uniform_real_distribution<double>(-1e6, 1e6)(generator) *
+                   std::pow(10.0, std::uniform_int_distribution<int>(-30, 30)(generator));
+        case 6:
+            return STRINGS[std::uniform_int_distribution<std::size_t>(0, STRINGS.size() - 1)(generator)];
+        case 7:
+        case 8:
+        {
+            auto object = nlohmann::ordered_json::object();
+            const int size = std::uniform_int_distribution<int>(0, 6)(generator);
+            for (int i = 0; i < size; ++i)
+            {
+                object[NAMES[std::uniform_int_distribution<std::size_t>(0, NAMES.size() - 1)(generator)]] =
+                        random_value(generator, depth + 1);
+            }
+            return object;
+        }
+        default:
+        {
+            auto array = nlohmann::ordered_json::array();
+            const int size = std::uniform_int_distribution<int>(0, 5)(generator);
+            for (int i = 0; i < size; ++i)
+            {
+                array.push_back(random_value(generator, depth + 1));
+            }
+            return array;
+        }
+    }
+}
+
+} /* namespace test */
+
+/**
+ * Documents in the layout given by json_serialize are formatted as the reference does.
+ */
+TEST(JsonFormatterTest, golden_documents)
+{
+    test::check_same_as_reference({
+        "{}",
+        "[]",
+        "{\n    \"value\": 12\n}",
+        "{\n    \"color\": {\n        \"name\": \"RED\",\n        \"value\": 0\n    },\n    \"id\": 3\n}",
+        "{\n    \"numbers\": [\n        1,\n        2,\n        3\n    ],\n    \"empty\": [],\n    \"nested\": {}\n}",
+        "{\"points\": [{\"x\": 1, \"y\": 2}, {\"x\": 3, \"y\": 4}], \"matrix\": [[1, 2], [3, 4]], \"mixed\": [1, [2]]}",
+        "[{}, [], null, true, false]",
+        "\"just a string\"",
+        "42",
+        "null",
+    });
+}
+
+/**
+ * Members are written sorted by name, however they come.
+ */
+TEST(JsonFormatterTest, unsorted_members)
+{
+    test::check_same_as_reference({
+        "{\"b\": 1, \"a\": 2}",
+        "{\"z\": {\"d\": [1, 2], \"c\": \"x\"}, \"a\": [{\"y\": 1, \"x\": 2}], \"m\": null}",
+        "{\"a\": {\"c\": 1, \"b\": 2}, \"b\": {\"b\": 1, \"a\": 2}}",
+        "{\"B\": 1, \"a\": 2, \"A\": 3, \"\": 4, \"\\u00e9\": 5, \"e\": 6}",
+        "{\"\\u0062\": 1, \"a\": 2, \"a\\u0000\": 3, \"\\\"\": 4}",
+    });
+}
+
+/**
+ * Only the last of repeated members is kept.
+ */
+TEST(JsonFormatterTest, repeated_members)
+{
+    test::check_same_as_reference({
+        "{\"a\": 1, \"a\": 2}",
+        "{\"b\": 1, \"a\": [1], \"b\": {\"c\": 3}, \"a\": [2]}",
+        "{\"a\": 1, \"\\u0061\": 2}",
+    });
+}
+
+/**
+ * Strings are decoded and escaped again.
+ */
+TEST(JsonFormatterTest, strings)
+{
+    test::check_same_as_reference({
+        "[\"plain\", \"\", \"tab\\t\", \"quote\\\"\", \"back\\\\slash\", \"\\/\", \"\\b\\f\\n\\r\"]",
+        "[\"\\u0001\\u001F\\u007f\", \"\\u00E9\", \"\xc3\xa9\", \"\\ud83d\\ude00\", \"\xf0\x9f\x98\x80\", \"\\u0000\"]",
+        "{\"k\\\\ey\\n\": \"v\\u0041lue\"}",
+    });
+}
+
+/**
+ * Numbers are written as nlohmann::json prints them once read.
+ */
+TEST(JsonFormatterTest, numbers)
+{
+    test::check_same_as_reference({
+        "[0, -0, 1, -1, 123456789012345678, -123456789012345678]",
+        "[9223372036854775807, -9223372036854775808, 18446744073709551615]",
+        "[18446744073709551616, -9223372036854775809, 100000000000000000000000]",
+        "[0.0, -0.0, 1.0, 1.50, 0.1, 3.14159, 1e2, 1E-2, 1.5e+300, -2.5E-300, 123.456e7]",
+    });
+}
+
+/**
+ * Random documents, with members in any order, match the reference.
+ */
+TEST(JsonFormatterTest, random_documents)
+{
+    std::mt19937 generator(42);
+    JsonFormatter formatter;
+    JsonFormatter two_spaces_formatter(2);
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        const auto document = test::random_value(generator, 0);
+        const std::string json = document.dump(i % 2 == 0 ? -1 : 4);
+        test::check_same_as_reference(formatter, json);
+        test::check_same_as_reference(two_spaces_formatter, json, 2);
+    }
+}
+
+/**
+ * Invalid documents are not written.
+ */
+TEST(JsonFormatterTest, invalid_documents)
+{
+    const std::vector<std::string> documents = {
+        "",
+        "   ",
+        "{",
+        "}",
+        "[1, 2",
+        "[1, 2,]",
+        "{\"a\": }",
+        "{\"a\" 1}",
+        "{\"a\": 1,}",
+        "{a: 1}",
+        "{\"b\": 1, \"a\": }",
+        "{\"b\": 1, \"a\": 2",
+        "[{\"a\": 1}, ]",
+        "\"unterminated",
+        "\"bad \\x escape\"",
+        "\"bad \\u12G4 escape\"",
+        "\"lone \\udc00 surrogate\"",
+        "\"lone \\ud800 surrogate\"",
+        "\"control \x01 character\"",
+        "\"bad \xc3 utf8\"",
+        "\"overlong \xc0\x80 utf8\"",
+        "\"surrogate \xed\xa0\x80 utf8\"",
+        "01",
+        "1.",
+        "1e",
+        "-",
+        "+1",
+        ".5",
+        "tru",
+        "nul",
+        "falsy",
+        "{} {}",
+        "[] x",
+        "1e400",
+        "[-1e400]",
+    };
+
+    JsonFormatter formatter;
+    for (const auto& json : documents)
+    {
+        std::string output = test::INITIAL_OUTPUT;
+        ASSERT_FALSE(formatter.format(json, output)) << json;
+        ASSERT_EQ(output, test::INITIAL_OUTPUT) << json;
+        ASSERT_THROW(nlohmann::json::parse(json), nlohmann::json::exception) << json;
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
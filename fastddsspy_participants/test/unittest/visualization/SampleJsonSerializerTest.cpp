@@ -0,0 +1,444 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilder.hpp>
+#include <fastdds/dds/xtypes/dynamic_types/DynamicTypeBuilderFactory.hpp>
+#include <fastdds/dds/xtypes/utils.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
+#include <fastddsspy_participants/visualization/JsonFormatter.hpp>
+#include <fastddsspy_participants/visualization/SampleJsonSerializer.hpp>
+
+using namespace eprosima;
+using namespace eprosima::spy::participants;
+
+namespace test {
+
+constexpr const char* INITIAL_OUTPUT = "previous output\n";
+
+void add_member(
+        const fastdds::dds::DynamicTypeBuilder::_ref_type& builder,
+        const std::string& name,
+        const fastdds::dds::DynamicType::_ref_type& type)
+{
+    auto member_desc = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
+    member_desc->name(name);
+    member_desc->type(type);
+    builder->add_member(member_desc);
+}
+
+fastdds::dds::DynamicType::_ref_type primitive(
+        fastdds::dds::TypeKind kind)
+{
+    return fastdds::dds::DynamicTypeBuilderFactory::get_instance()->get_primitive_type(kind);
+}
+
+fastdds::dds::DynamicTypeBuilder::_ref_type structure_builder(
+        const std::string& name,
+        fastdds::dds::ExtensibilityKind extensibility = fastdds::dds::ExtensibilityKind::FINAL)
+{
+    auto type_desc = fastdds::dds::traits<fastdds::dds::TypeDescriptor>::make_shared();
+    type_desc->kind(fastdds::dds::TK_STRUCTURE);
+    type_desc->name(name);
+    type_desc->extensibility_kind(extensibility);
+    return fastdds::dds::DynamicTypeBuilderFactory::get_instance()->create_type(type_desc);
+}
+
+/**
+ * Structure whose members are not declared in name order:
+ *
+ * struct Point { int16 y; int16 x; };
+ * enum Color { RED, GREEN, BLUE };
+ * struct Sample {
+ *     int32 z_index; double a_value; boolean m_flag; char c_char; string s_text; Color e_color; int8 b_small;
+ *     uint64 u_big; float f_ratio; sequence<int16> q_numbers; float r_array[3]; sequence<string> t_words;
+ *     Point p_point; sequence<Point> w_points;
+ * };
+ */
+fastdds::dds::DynamicType::_ref_type sample_type(
+        fastdds::dds::ExtensibilityKind extensibility)
+{
+    auto factory = fastdds::dds::DynamicTypeBuilderFactory::get_instance();
+
+    auto point_builder = structure_builder("Point", extensibility);
+    add_member(point_builder, "y", primitive(fastdds::dds::TK_INT16));
+    add_member(point_builder, "x", primitive(fastdds::dds::TK_INT16));
+    auto point_type = point_builder->build();
+
+    auto enum_desc = fastdds::dds::traits<fastdds::dds::TypeDescriptor>::make_shared();
+    enum_desc->kind(fastdds::dds::TK_ENUM);
+    enum_desc->name("Color");
+    auto enum_builder = factory->create_type(enum_desc);
+    for (const char* literal : {"RED", "GREEN", "BLUE"})
+    {
+        add_member(enum_builder, literal, primitive(fastdds::dds::TK_INT32));
+    }
+    auto enum_type = enum_builder->build();
+
+    auto string_type = factory->create_string_type(static_cast<uint32_t>(fastdds::dds::LENGTH_UNLIMITED))->build();
+
+    auto builder = structure_builder("Sample", extensibility);
+    add_member(builder, "z_index", primitive(fastdds::dds::TK_INT32));
+    add_member(builder, "a_value", primitive(fastdds::dds::TK_FLOAT64));
+    add_member(builder, "m_flag", primitive(fastdds::dds::TK_BOOLEAN));
+    add_member(builder, "c_char", primitive(fastdds::dds::TK_CHAR8));
+    add_member(builder, "s_text", string_type);
+    add_member(builder, "e_color", enum_type);
+    add_member(builder, "b_small", primitive(fastdds::dds::TK_INT8));
+    add_member(builder, "u_big", primitive(fastdds::dds::TK_UINT64));
+    add_member(builder, "f_ratio", primitive(fastdds::dds::TK_FLOAT32));
+    add_member(builder, "q_numbers",
+            factory->create_sequence_type(primitive(fastdds::dds::TK_INT16),
+            static_cast<uint32_t>(fastdds::dds::LENGTH_UNLIMITED))->build());
+    add_member(builder, "r_array",
+            factory->create_array_type(primitive(fastdds::dds::TK_FLOAT32), {3})->build());
+    add_member(builder, "t_words",
+            factory->create_sequence_type(string_type,
+            static_cast<uint32_t>(fastdds::dds::LENGTH_UNLIMITED))->build());
+    add_member(builder, "p_point", point_type);
+    add_member(builder, "w_points",
+            factory->create_sequence_type(point_type,
+            static_cast<uint32_t>(fastdds::dds::LENGTH_UNLIMITED))->build());
+    return builder->build();
+}
+
+fastdds::dds::DynamicData::_ref_type point_data(
+        const fastdds::dds::DynamicType::_ref_type& point_type,
+        int16_t x,
+        int16_t y)
+{
+    auto point = fastdds::dds::DynamicDataFactory::get_instance()->create_data(point_type);
+    point->set_int16_value(point->get_member_id_by_name("x"), x);
+    point->set_int16_value(point->get_member_id_by_name("y"), y);
+    return point;
+}
+
+fastdds::dds::DynamicData::_ref_type sample_data(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type)
+{
+    auto data = fastdds::dds::DynamicDataFactory::get_instance()->create_data(dyn_type);
+
+    data->set_int32_value(data->get_member_id_by_name("z_index"), -7);
+    data->set_float64_value(data->get_member_id_by_name("a_value"), 3.14159);
+    data->set_boolean_value(data->get_member_id_by_name("m_flag"), true);
+    data->set_char8_value(data->get_member_id_by_name("c_char"), 'q');
+    data->set_string_value(data->get_member_id_by_name("s_text"), "tab\tquote\"backslash\\");
+    data->set_int32_value(data->get_member_id_by_name("e_color"), 2);
+    data->set_int8_value(data->get_member_id_by_name("b_small"), -128);
+    data->set_uint64_value(data->get_member_id_by_name("u_big"), 18446744073709551615ull);
+    data->set_float32_value(data->get_member_id_by_name("f_ratio"), 0.1f);
+    data->set_int16_values(data->get_member_id_by_name("q_numbers"), {1, -2, 3, 32767});
+    data->set_float32_values(data->get_member_id_by_name("r_array"), {1.5f, -0.25f, 1e10f});
+    data->set_string_values(data->get_member_id_by_name("t_words"), {"one", "", "three"});
+
+    fastdds::dds::DynamicTypeMember::_ref_type point_member;
+    dyn_type->get_member_by_name(point_member, "p_point");
+    fastdds::dds::MemberDescriptor::_ref_type point_desc =
+            fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
+    point_member->get_descriptor(point_desc);
+    auto point_type = point_desc->type();
+
+    data->set_complex_value(data->get_member_id_by_name("p_point"), point_data(point_type, 10, -20));
+
+    auto points = data->loan_value(data->get_member_id_by_name("w_points"));
+    points->set_complex_value(0, point_data(point_type, 1, 2));
+    points->set_complex_value(1, point_data(point_type, 3, 4));
+    data->return_loaned_value(points);
+
+    return data;
+}
+
+std::unique_ptr<ddspipe::core::types::RtpsPayloadData> serialize(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        fastdds::dds::DynamicData::_ref_type dyn_data,
+        fastdds::dds::DataRepresentationId_t representation)
+{
+    fastdds::dds::DynamicPubSubType pubsub_type(dyn_type);
+
+    auto data = std::make_unique<ddspipe::core::types::RtpsPayloadData>();
+    data->payload.reserve(pubsub_type.calculate_serialized_size(&dyn_data, representation));
+    pubsub_type.serialize(&dyn_data, data->payload, representation);
+
+    return data;
+}
+
+//! JSON given by the generic path: DynamicData, Fast DDS JSON serialization and re-formatting
+std::string reference_json(
+        TypeDecoder& decoder,
+        const ddspipe::core::types::RtpsPayloadData& data)
+{
+    auto dyn_data = decoder.deserialize(data);
+    EXPECT_TRUE(dyn_data);
+
+    std::stringstream ss;
+    EXPECT_EQ(fastdds::dds::json_serialize(dyn_data.get(), fastdds::dds::DynamicDataJsonFormat::EPROSIMA, ss),
+            fastdds::dds::RETCODE_OK);
+
+    std::string json;
+    EXPECT_TRUE(JsonFormatter().format(ss.str(), json));
+    return json;
+}
+
+void check_same_json(
+        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        fastdds::dds::DynamicData::_ref_type dyn_data,
+        fastdds::dds::DataRepresentationId_t representation)
+{
+    auto decoder = std::make_shared<TypeDecoder>(dyn_type);
+    auto data = serialize(dyn_type, dyn_data, representation);
+
+    SampleJsonSerializer serializer;
+    std::string output = INITIAL_OUTPUT;
+    ASSERT_TRUE(serializer.serialize(*decoder, *data, output));
+
+    ASSERT_EQ(output, INITIAL_OUTPUT + reference_json(*decoder, *data));
+}
+
+} /* namespace test */
+
+/**
+ * Samples written from the CDR payload match the generic JSON path, with XCDR1 and XCDR2.
+ */
+TEST(SampleJsonSerializerTest, final_type)
+{
+    auto dyn_type = test::sample_type(fastdds::dds::ExtensibilityKind::FINAL);
+    ASSERT_TRUE(TypeDecoder(dyn_type).layout());
+
+    auto dyn_data = test::sample_data(dyn_type);
+    test::check_same_json(dyn_type, dyn_data, fastdds::dds::XCDR_DATA_REPRESENTATION);
+    test::check_same_json(dyn_type, dyn_data, fastdds::dds::XCDR2_DATA_REPRESENTATION);
+}
+
+/**
+ * Appendable types carry a DHEADER in XCDR2.
+ */
+TEST(SampleJsonSerializerTest, appendable_type)
+{
+    auto dyn_type = test::sample_type(fastdds::dds::ExtensibilityKind::APPENDABLE);
+    ASSERT_TRUE(TypeDecoder(dyn_type).layout());
+
+    auto dyn_data = test::sample_data(dyn_type);
+    test::check_same_json(dyn_type, dyn_data, fastdds::dds::XCDR_DATA_REPRESENTATION);
+    test::check_same_json(dyn_type, dyn_data, fastdds::dds::XCDR2_DATA_REPRESENTATION);
+}
+
+/**
+ * Default values: empty strings and collections.
+ */
+TEST(SampleJsonSerializerTest, empty_values)
+{
+    auto dyn_type = test::sample_type(fastdds::dds::ExtensibilityKind::FINAL);
+    auto dyn_data = fastdds::dds::DynamicDataFactory::get_instance()->create_data(dyn_type);
+
+    test::check_same_json(dyn_type, dyn_data, fastdds::dds::XCDR_DATA_REPRESENTATION);
+    test::check_same_json(dyn_type, dyn_data, fastdds::dds::XCDR2_DATA_REPRESENTATION);
+}
+
+/**
+ * Types with no layout are written through DynamicData.
+ */
+TEST(SampleJsonSerializerTest, unsupported_type)
+{
+    auto builder = test::structure_builder("Optional");
+    test::add_member(builder, "value", test::primitive(fastdds::dds::TK_INT32));
+    auto member_desc = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
+    member_desc->name("optional");
+    member_desc->type(test::primitive(fastdds::dds::TK_INT32));
+    member_desc->is_optional(true);
+    builder->add_member(member_desc);
+    auto dyn_type = builder->build();
+    ASSERT_FALSE(TypeDecoder(dyn_type).layout());
+
+    auto dyn_data = fastdds::dds::DynamicDataFactory::get_instance()->create_data(dyn_type);
+    dyn_data->set_int32_value(dyn_data->get_member_id_by_name("value"), 12);
+    dyn_data->set_int32_value(dyn_data->get_member_id_by_name("optional"), 34);
+
+    test::check_same_json(dyn_type, dyn_data, fastdds::dds::XCDR2_DATA_REPRESENTATION);
+}
+
+/**
+ * Malformed payloads are not written.
+ */
+TEST(SampleJsonSerializerTest, invalid_payload)
+{
+    auto dyn_type = test::sample_type(fastdds::dds::ExtensibilityKind::FINAL);
+    auto decoder = std::make_shared<TypeDecoder>(dyn_type);
+    auto data = test::serialize(dyn_type, test::sample_data(dyn_type), fastdds::dds::XCDR2_DATA_REPRESENTATION);
+
+    // Cut the payload in the middle of the strings
+    data->payload.length = 24;
+
+    SampleJsonSerializer serializer;
+    std::string output = test::INITIAL_OUTPUT;
+    ASSERT_FALSE(serializer.serialize(*decoder, *data, output));
+    ASSERT_EQ(output, test::INITIAL_OUTPUT);
+}
+
+/**
+ * Only the fields selected are written, with XCDR1 and XCDR2 and any extensibility.
+ */
+TEST(SampleJsonSerializerTest, select_fields)
+{
+    for (const auto extensibility : {fastdds::dds::ExtensibilityKind::FINAL,
+                                     fastdds::dds::ExtensibilityKind::APPENDABLE})
+    {
+        auto dyn_type = test::sample_type(extensibility);
+        auto decoder = std::make_shared<TypeDecoder>(dyn_type);
+
+        for (const auto representation : {fastdds::dds::XCDR_DATA_REPRESENTATION,
+                                          fastdds::dds::XCDR2_DATA_REPRESENTATION})
+        {
+            auto data = test::serialize(dyn_type, test::sample_data(dyn_type), representation);
+
+            SampleJsonSerializer serializer;
+            serializer.select_fields({"p_point.x", "s_text", "b_small"});
+
+            std::string output = test::INITIAL_OUTPUT;
+            ASSERT_TRUE(serializer.serialize(*decoder, *data, output));
+            ASSERT_EQ(output, std::string(test::INITIAL_OUTPUT) +
+                    R"({
+    "b_small": -128,
+    "p_point": {
+        "x": 10
+    },
+    "s_text": "tab\tquote\"backslash\\"
+})");
+
+            // A whole member overrides any field under it
+            serializer.select_fields({"p_point.y", "p_point", "w_points"});
+
+            output.clear();
+            ASSERT_TRUE(serializer.serialize(*decoder, *data, output));
+            ASSERT_EQ(output,
+                    R"({
+    "p_point": {
+        "x": 10,
+        "y": -20
+    },
+    "w_points": [
+        {
+            "x": 1,
+            "y": 2
+        },
+        {
+            "x": 3,
+            "y": 4
+        }
+    ]
+})");
+        }
+    }
+}
+
+/**
+ * Fields that are not members of the type, and types without layout, cannot be written.
+ */
+TEST(SampleJsonSerializerTest, select_fields_invalid)
+{
+    auto dyn_type = test::sample_type(fastdds::dds::ExtensibilityKind::FINAL);
+    auto decoder = std::make_shared<TypeDecoder>(dyn_type);
+    auto data = test::serialize(dyn_type, test::sample_data(dyn_type), fastdds::dds::XCDR2_DATA_REPRESENTATION);
+
+    SampleJsonSerializer serializer;
+    std::string error;
+    ASSERT_TRUE(serializer.can_serialize(*decoder, error));
+
+    for (const auto& fields : std::vector<std::vector<std::string>>{
+                {"missing"}, {"p_point.z"}, {"q_numbers.x"}, {"p_point."}, {""}})
+    {
+        serializer.select_fields(fields);
+        ASSERT_FALSE(serializer.can_serialize(*decoder, error));
+        ASSERT_FALSE(error.empty());
+
+        std::string output = test::INITIAL_OUTPUT;
+        ASSERT_FALSE(serializer.serialize(*decoder, *data, output));
+        ASSERT_EQ(output, test::INITIAL_OUTPUT);
+    }
+
+    // Type with an optional member, so with no layout
+    auto builder = test::structure_builder("Optional");
+    test::add_member(builder, "value", test::primitive(fastdds::dds::TK_INT32));
+    auto member_desc = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
+    member_desc->name("optional");
+    member_desc->type(test::primitive(fastdds::dds::TK_INT32));
+    member_desc->is_optional(true);
+    builder->add_member(member_desc);
+    TypeDecoder optional_decoder(builder->build());
+
+    serializer.select_fields({"value"});
+    ASSERT_FALSE(serializer.can_serialize(optional_decoder, error));
+}
+
+/**
+ * Compact JSON is the indented JSON in a single line, from the CDR payload and through DynamicData.
+ */
+TEST(SampleJsonSerializerTest, compact)
+{
+    // Type with an optional member, so with no layout
+    auto builder = test::structure_builder("Optional");
+    test::add_member(builder, "value", test::primitive(fastdds::dds::TK_INT32));
+    auto member_desc = fastdds::dds::traits<fastdds::dds::MemberDescriptor>::make_shared();
+    member_desc->name("optional");
+    member_desc->type(test::primitive(fastdds::dds::TK_INT32));
+    member_desc->is_optional(true);
+    builder->add_member(member_desc);
+    auto optional_type = builder->build();
+
+    auto sample_type = test::sample_type(fastdds::dds::ExtensibilityKind::APPENDABLE);
+
+    for (const auto& dyn_type : {sample_type, optional_type})
+    {
+        auto decoder = std::make_shared<TypeDecoder>(dyn_type);
+        auto dyn_data = dyn_type == sample_type ?
+                test::sample_data(dyn_type) :
+                fastdds::dds::DynamicDataFactory::get_instance()->create_data(dyn_type);
+        auto data = test::serialize(dyn_type, dyn_data, fastdds::dds::XCDR2_DATA_REPRESENTATION);
+
+        SampleJsonSerializer serializer;
+        std::string indented;
+        ASSERT_TRUE(serializer.serialize(*decoder, *data, indented));
+
+        serializer.set_compact(true);
+        std::string output = test::INITIAL_OUTPUT;
+        ASSERT_TRUE(serializer.serialize(*decoder, *data, output));
+        ASSERT_EQ(output, test::INITIAL_OUTPUT + nlohmann::json::parse(indented).dump());
+
+        // Back to the indented JSON
+        serializer.set_compact(false);
+        output.clear();
+        ASSERT_TRUE(serializer.serialize(*decoder, *data, output));
+        ASSERT_EQ(output, indented);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -23,7 +23,6 @@
 #include <cpp_utils/event/SignalEventHandler.hpp>
 #include <cpp_utils/exception/ConfigurationException.hpp>
 #include <cpp_utils/exception/InitializationException.hpp>
-#include <cpp_utils/logging/StdLogConsumer.hpp>
 #include <cpp_utils/ReturnCode.hpp>
 #include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
 #include <cpp_utils/time/time_utils.hpp>
@@ -47,6 +46,7 @@
 #include "user_interface/arguments_configuration.hpp"
 #include "user_interface/ProcessReturnCode.hpp"
 #include "tool/Controller.hpp"
+#include "tool/SinkLogConsumer.hpp"
 
 int main(
         int argc,
@@ -122,11 +122,11 @@ int main(
             // Activate log with verbosity, as this will avoid running log thread with not desired kind
             eprosima::utils::Log::SetVerbosity(configuration.ddspipe_configuration.log_configuration.verbosity);
 
-            // Stdout Log Consumer
+            // Stdout Log Consumer, written in order with the output of the tool
             if (log_configuration.stdout_enable)
             {
                 eprosima::utils::Log::RegisterConsumer(
-                    std::make_unique<eprosima::utils::StdLogConsumer>(&log_configuration));
+                    std::make_unique<eprosima::spy::SinkLogConsumer>(&log_configuration));
             }
 
             // DDS Log Consumer
@@ -147,8 +147,8 @@ int main(
         // Load XML profiles
         eprosima::ddspipe::participants::XmlHandler::load_xml(configuration.xml_configuration);
 
-        // Create the Spy
-        eprosima::spy::Controller spy(configuration);
+        // Create the Spy, that inspects a record file instead of a domain in offline mode
+        eprosima::spy::Controller spy(configuration, commandline_args.offline_file);
 
         // Update partitions filter from yaml
         spy.set_partition_filter(configuration.dds_configuration->allowed_partition_list);
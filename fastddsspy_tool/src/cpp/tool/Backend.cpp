@@ -47,6 +47,16 @@ Backend::Backend(
 
     load_internal_topics_(configuration_);
 
+    model_->set_rate_window(std::chrono::milliseconds(configuration.rate_window_ms));
+    model_->set_instance_limits(configuration.instances_max_per_topic, configuration.instances_max_total,
+            configuration.instances_max_memory);
+
+    // Keep the last samples of each topic from the start, so they can be echoed later
+    if (configuration.history_depth > 0)
+    {
+        model_->enable_history(configuration.history_depth, configuration.history_max_memory);
+    }
+
     if (configuration.dds_enabled)
     {
         dds_participant_ = std::make_shared<participants::SpyDdsXmlParticipant>(
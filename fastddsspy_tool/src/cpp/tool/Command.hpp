@@ -32,7 +32,9 @@ ENUMERATION_BUILDER(
     topic,
     print,
     error_input,
-    filter
+    filter,
+    record,
+    top
     );
 
 eProsima_ENUMERATION_BUILDER(
@@ -49,6 +51,8 @@ eProsima_ENUMERATION_BUILDER(
             { CommandValue::topic COMMA {"topic"  COMMA "topics" COMMA "t" COMMA "T"}} COMMA
             { CommandValue::print COMMA {"echo" COMMA "print" COMMA "show" COMMA "s" COMMA "S"}} COMMA
             { CommandValue::filter COMMA {"filter" COMMA "filters" COMMA "partitions" COMMA "f" COMMA "F"}} COMMA
+            { CommandValue::record COMMA {"record"}} COMMA
+            { CommandValue::top COMMA {"top"}} COMMA
         }
     );
 
@@ -12,12 +12,20 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <thread>
+
 #include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
-#include <fastdds/dds/xtypes/dynamic_types/DynamicPubSubType.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
-#include <fastdds/dds/xtypes/dynamic_types/DynamicDataFactory.hpp>
 #include <fastdds/dds/xtypes/utils.hpp>
 
+#include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/user_interface/CommandReader.hpp>
 #include <cpp_utils/macros/custom_enumeration.hpp>
 
@@ -26,7 +34,9 @@
 
 #include <fastddsspy_participants/library/config.h>
 #include <fastddsspy_participants/model/SpyModel.hpp>
+#include <fastddsspy_participants/recording/DataRecorder.hpp>
 #include <fastddsspy_participants/visualization/ModelParser.hpp>
+#include <fastddsspy_participants/visualization/SampleJsonSerializer.hpp>
 #include <fastddsspy_participants/types/EndpointInfo.hpp>
 
 #include <fastddsspy_yaml/YamlReaderConfiguration.hpp>
@@ -35,106 +45,54 @@
 #include "Controller.hpp"
 #include "Command.hpp"
 
-#include <nlohmann/json.hpp>
-using nlohmann::json;
-
 namespace eprosima {
 namespace spy {
 
-// Braces + indentation, arrays single-line
-static void print_json_arrays_inline(
-        const json& j,
-        std::ostream& o,
-        int indent,
-        int step)
+Controller::Controller(
+        const yaml::Configuration& configuration,
+        const std::string& offline_file /* = "" */)
+    : backend_(offline_file.empty() ? std::make_unique<Backend>(configuration) : nullptr)
+    , model_(backend_ ? backend_->model() : std::make_shared<participants::SpyModel>(configuration.ros2_types))
+    , configuration_(configuration)
+    , echo_dispatcher_(configuration.echo_queue_size, configuration.echo_drop_policy, configuration.echo_threads)
+    , echo_subscription_(participants::DataStreamer::INVALID_SUBSCRIPTION)
 {
-    if (j.is_object())
+    for (std::size_t i = 0; i < echo_dispatcher_.threads(); ++i)
     {
-        o << "{\n";
-        auto it = j.begin();
-        if (it != j.end())
-        {
-            o << std::string(indent + step, ' ');
-            o << json(it.key()).dump() << ": ";              // Quoted key
-            print_json_arrays_inline(it.value(), o, indent + step, step);
-            ++it;
-            for (; it != j.end(); ++it)
-            {
-                o << ",\n";
-                o << std::string(indent + step, ' ');
-                o << json(it.key()).dump() << ": ";              // Quoted key
-                print_json_arrays_inline(it.value(), o, indent + step, step);
-            }
-        }
-        o << "\n" << std::string(indent, ' ') << "}";
+        echo_formatters_.push_back(std::make_unique<EchoFormatter>());
     }
-    else if (j.is_array())
-    {
-        // Inline if all elements are primitives; otherwise, pretty multi-line.
-        bool all_primitives = std::all_of(j.begin(), j.end(),
-                        [](const json& e)
-                        {
-                            return e.is_primitive();
-                        });
 
-        std::size_t i = 0;
-        if (all_primitives)
+    if (!offline_file.empty())
+    {
+        if (configuration.history_depth > 0)
         {
-            o << "[";
-            if (i < j.size())
-            {
-                // Primitives: let nlohmann handle quoting/escaping
-                o << j[i++].dump();
-                for (; i < j.size(); ++i)
-                {
-                    // Primitives: let nlohmann handle quoting/escaping
-                    o << ", " << j[i].dump();
-                }
-            }
-            o << "]";
+            model_->enable_history(configuration.history_depth, configuration.history_max_memory);
         }
-        else
+
+        // Recorded data was not received now, so it is timed by its source timestamps and has no latency
+        model_->set_live(false);
+        model_->set_rate_window(std::chrono::milliseconds(configuration.rate_window_ms));
+        model_->set_instance_limits(configuration.instances_max_per_topic, configuration.instances_max_total,
+                configuration.instances_max_memory);
+
+        // The whole file is loaded before the first command, so every command sees all of its data
+        player_ = std::make_unique<participants::RecordPlayer>(model_);
+        if (!player_->load(offline_file, configuration.n_threads))
         {
-            // Structured elements -> readable multi-line
-            o << "[\n";
-            if (i < j.size())
-            {
-                o << std::string(indent + step, ' ');
-                print_json_arrays_inline(j[i++], o, indent + step, step);
-                for (; i < j.size(); ++i)
-                {
-                    o << ",\n" << std::string(indent + step, ' ');
-                    print_json_arrays_inline(j[i], o, indent + step, step);
-                }
-            }
-            o << "\n" << std::string(indent, ' ') << "]";
+            throw utils::InitializationException(STR_ENTRY
+                          << "Could not load record file <" << offline_file << ">.");
         }
     }
-    else
-    {
-        // Scalars: let nlohmann handle quoting/escaping/types
-        o << j.dump();
-    }
 }
 
-// Wrapper
-static std::string format_json_arrays_inline(
-        const std::string& json_str,
-        int indent_step = 4)
+Controller::~Controller()
 {
-    json j = json::parse(json_str);
-    std::ostringstream out;
-    print_json_arrays_inline(j, out, /*indent*/ 0, indent_step);
-    return out.str();
-}
-
-Controller::Controller(
-        const yaml::Configuration& configuration)
-    : backend_(configuration)
-    , model_(backend_.model())
-    , configuration_(configuration)
-{
-    // Do nothing
+    // NOTE: the model may outlive the controller, and the dispatcher threads use its view and formatters
+    if (echo_subscription_ != participants::DataStreamer::INVALID_SUBSCRIPTION)
+    {
+        model_->unsubscribe(echo_subscription_);
+    }
+    echo_dispatcher_.stop();
 }
 
 void Controller::run()
@@ -144,6 +102,7 @@ void Controller::run()
     command.command = CommandValue::participant;
     while (command.command != CommandValue::exit)
     {
+        view_.show_prompt();
         command = input_.wait_next_command();
         // refresh the database if a filter partition is active.
         // this checks if there is a new endpoint that does not
@@ -155,14 +114,24 @@ void Controller::run()
 void Controller::one_shot_run(
         const std::vector<std::string>& args)
 {
-    utils::sleep_for(configuration_.one_shot_wait_time_ms);
+    // Offline data is already loaded, there is nothing to discover
+    if (!player_)
+    {
+        utils::sleep_for(configuration_.one_shot_wait_time_ms);
+    }
     run_command_(input_.parse_as_command(args));
 }
 
 utils::ReturnCode Controller::reload_configuration(
         yaml::Configuration& new_configuration)
 {
-    return backend_.reload_configuration(new_configuration);
+    if (!backend_)
+    {
+        // Nothing to reload in offline mode
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
+    return backend_->reload_configuration(new_configuration);
 }
 
 void Controller::run_command_(
@@ -206,64 +175,62 @@ void Controller::run_command_(
             filter_command_(command.arguments);
             break;
 
-        default:
+        case CommandValue::record:
+            record_command_(command.arguments);
             break;
-    }
-}
 
-fastdds::dds::DynamicData::_ref_type Controller::get_dynamic_data_(
-        const fastdds::dds::DynamicType::_ref_type& dyn_type,
-        const ddspipe::core::types::RtpsPayloadData& data) noexcept
-{
-    // TODO fast this should not be done, but dyn types API is like it is.
-    auto& data_no_const = const_cast<ddspipe::core::types::RtpsPayloadData&>(data);
-
-    // Create PubSub Type
-    fastdds::dds::DynamicPubSubType pubsub_type(dyn_type);
-    fastdds::dds::DynamicData::_ref_type dyn_data(fastdds::dds::DynamicDataFactory::get_instance()->create_data(
-                dyn_type));
+        case CommandValue::top:
+            top_command_(command.arguments);
+            break;
 
-    pubsub_type.deserialize(data_no_const.payload, &dyn_data);
+        default:
+            break;
+    }
 
-    return dyn_data;
+    // The output of the command is complete: write it before the next prompt
+    view_.flush();
 }
 
 void Controller::data_stream_callback_(
+        EchoFormatter& formatter,
         const ddspipe::core::types::DdsTopic& topic,
-        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        const std::shared_ptr<participants::TypeDecoder>& decoder,
         const ddspipe::core::types::RtpsPayloadData& data)
 {
-    // Block entrance so prints does not collapse
-    std::lock_guard<std::mutex> _(view_mutex_);
-
-    // Get deserializad data
-    auto dyn_data = get_dynamic_data_(dyn_type, data);
+    // Samples of types without the fields selected are not printed
+    std::string error;
+    if (!formatter.serializer.can_serialize(*decoder, error))
+    {
+        return;
+    }
 
-    // TODO fast this does not make much sense as dynamictypes::print does not allow to choose target
-    // change in dyn types to be able to print it in view
-    view_.show("---");
-    std::stringstream ss;
-    if (fastdds::dds::RETCODE_OK !=
-            fastdds::dds::json_serialize(dyn_data, fastdds::dds::DynamicDataJsonFormat::EPROSIMA, ss))
+    // Write the whole block of the sample, reusing the buffer of previous samples
+    formatter.buffer.assign("---\n");
+    if (!formatter.serializer.serialize(*decoder, data, formatter.buffer))
     {
         EPROSIMA_LOG_WARNING(FASTDDSSPY_CONTROLLER,
                 "Not able to serialize data of topic " << topic.topic_name() << " into JSON format.");
         return;
     }
+    formatter.buffer.append("\n---\n\n");
 
-    // Reformat: arrays single-line
-    const std::string pretty = format_json_arrays_inline(ss.str(), /*indent_step*/ 4);
-    std::cout << pretty << std::endl;
-    view_.show("---\n");
+    // Block entrance only to print the block, so prints do not collapse
+    std::lock_guard<std::mutex> _(view_mutex_);
+    view_.write(formatter.buffer);
 }
 
 void Controller::data_stream_callback_verbose_(
+        EchoFormatter& formatter,
         const ddspipe::core::types::DdsTopic& topic,
-        const fastdds::dds::DynamicType::_ref_type& dyn_type,
+        const std::shared_ptr<participants::TypeDecoder>& decoder,
         const ddspipe::core::types::RtpsPayloadData& data)
 {
-    // Block entrance so prints does not collapse
-    std::lock_guard<std::mutex> _(view_mutex_);
+    // Samples of types without the fields selected are not printed
+    std::string error;
+    if (!formatter.serializer.can_serialize(*decoder, error))
+    {
+        return;
+    }
 
     // get the source guid
     std::ostringstream guid_ss;
@@ -287,26 +254,52 @@ void Controller::data_stream_callback_verbose_(
     // Write yaml with info
     Yaml yml;
     ddspipe::yaml::set(yml, data_info);
-    view_.show(yml);
-
-    // Get deserializad data
-    auto dyn_data = get_dynamic_data_(dyn_type, data);
+    std::ostringstream yml_ss;
+    yml_ss << yml << '\n';
 
-    // Print data
-    view_.show("data:\n---");
-    std::stringstream ss;
-    if (fastdds::dds::RETCODE_OK !=
-            fastdds::dds::json_serialize(dyn_data, fastdds::dds::DynamicDataJsonFormat::EPROSIMA, ss))
+    // Write the whole block of the sample, reusing the buffer of previous samples
+    formatter.buffer.assign(yml_ss.str());
+    formatter.buffer.append("data:\n---\n");
+    if (!formatter.serializer.serialize(*decoder, data, formatter.buffer))
     {
         EPROSIMA_LOG_WARNING(FASTDDSSPY_CONTROLLER,
                 "Not able to serialize data of topic " << topic.topic_name() << " into JSON format.");
         return;
     }
+    formatter.buffer.append("\n---\n\n");
+
+    // Block entrance only to print the block, so prints do not collapse
+    std::lock_guard<std::mutex> _(view_mutex_);
+    view_.write(formatter.buffer);
+}
+
+void Controller::data_stream_callback_compact_(
+        EchoFormatter& formatter,
+        participants::CompactFormat format,
+        const ddspipe::core::types::DdsTopic& topic,
+        const std::shared_ptr<participants::TypeDecoder>& decoder,
+        const ddspipe::core::types::RtpsPayloadData& data)
+{
+    // Samples of types without the fields selected are not printed
+    std::string error;
+    if (!formatter.serializer.can_serialize(*decoder, error))
+    {
+        return;
+    }
+
+    formatter.json.clear();
+    formatter.buffer.clear();
+    if (!formatter.serializer.serialize(*decoder, data, formatter.json) ||
+            !participants::append_compact_record(format, topic, data, formatter.json, formatter.buffer))
+    {
+        EPROSIMA_LOG_WARNING(FASTDDSSPY_CONTROLLER,
+                "Not able to serialize data of topic " << topic.topic_name() << " into a compact format.");
+        return;
+    }
 
-    // Reformat: arrays single-line
-    const std::string pretty = format_json_arrays_inline(ss.str(), /*indent_step*/ 4);
-    std::cout << pretty << std::endl;
-    view_.show("---\n");
+    // Block entrance only to print the record, so prints do not collapse
+    std::lock_guard<std::mutex> _(view_mutex_);
+    view_.write(formatter.buffer);
 }
 
 bool Controller::verbose_argument_(
@@ -346,6 +339,15 @@ bool Controller::keys_argument_(
         || (argument == "K"));
 }
 
+bool Controller::latency_argument_(
+        const std::string& argument) const noexcept
+{
+    return (
+        (argument == "latency")
+        || (argument == "lat")
+        || (argument == "l"));
+}
+
 bool Controller::all_argument_(
         const std::string& argument) const noexcept
 {
@@ -357,6 +359,109 @@ bool Controller::all_argument_(
         || (argument == "A"));
 }
 
+bool Controller::echo_arguments_(
+        const std::vector<std::string>& arguments,
+        bool& verbose,
+        double& max_rate,
+        uint32_t& every,
+        std::size_t& last,
+        std::vector<std::string>& fields,
+        bool& compact,
+        participants::CompactFormat& compact_format) noexcept
+{
+    for (std::size_t i = 2; i < arguments.size(); ++i)
+    {
+        const std::string& argument = arguments[i];
+        if (verbose_argument_(argument))
+        {
+            verbose = true;
+        }
+        else if (argument == "--max-rate")
+        {
+            const char* value = (i + 1 < arguments.size()) ? arguments[++i].c_str() : "";
+            char* end = nullptr;
+            max_rate = std::strtod(value, &end);
+            if (end == value || *end != '\0' || !(max_rate > 0) || !std::isfinite(max_rate))
+            {
+                view_.show_error(STR_ENTRY
+                        << "Option <" << argument << "> requires a positive number of samples per second.");
+                return false;
+            }
+        }
+        else if (argument == "--every")
+        {
+            const char* value = (i + 1 < arguments.size()) ? arguments[++i].c_str() : "";
+            char* end = nullptr;
+            const unsigned long long samples = std::strtoull(value, &end, 10);
+            if (end == value || *end != '\0' || value[0] == '-' || samples == 0 ||
+                    samples > std::numeric_limits<uint32_t>::max())
+            {
+                view_.show_error(STR_ENTRY
+                        << "Option <" << argument << "> requires a positive number of samples.");
+                return false;
+            }
+            every = static_cast<uint32_t>(samples);
+        }
+        else if (argument == "last")
+        {
+            const char* value = (i + 1 < arguments.size()) ? arguments[++i].c_str() : "";
+            char* end = nullptr;
+            const unsigned long long samples = std::strtoull(value, &end, 10);
+            if (end == value || *end != '\0' || value[0] == '-' || samples == 0 ||
+                    samples > std::numeric_limits<std::size_t>::max())
+            {
+                view_.show_error(STR_ENTRY
+                        << "Option <" << argument << "> requires a positive number of samples.");
+                return false;
+            }
+            last = static_cast<std::size_t>(samples);
+        }
+        else if (argument == "fields")
+        {
+            const std::string value = (i + 1 < arguments.size()) ? arguments[++i] : "";
+            fields.clear();
+            std::size_t begin = 0;
+            while (begin <= value.size())
+            {
+                const std::size_t end = std::min(value.find(',', begin), value.size());
+                if (end == begin)
+                {
+                    view_.show_error(STR_ENTRY
+                            << "Option <" << argument << "> requires a comma separated list of member names.");
+                    return false;
+                }
+                fields.push_back(value.substr(begin, end - begin));
+                begin = end + 1;
+            }
+        }
+        else if (argument == "--format")
+        {
+            const std::string value = (i + 1 < arguments.size()) ? arguments[++i] : "";
+            compact = true;
+            if (value == "ndjson")
+            {
+                compact_format = participants::CompactFormat::ndjson;
+            }
+            else if (value == "csv")
+            {
+                compact_format = participants::CompactFormat::csv;
+            }
+            else if (value == "cbor")
+            {
+                compact_format = participants::CompactFormat::cbor;
+            }
+            else
+            {
+                view_.show_error(STR_ENTRY
+                        << "Option <" << argument << "> requires one of the formats ndjson, csv or cbor.");
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 void Controller::participants_command_(
         const std::vector<std::string>& arguments) noexcept
 {
@@ -523,7 +628,7 @@ void Controller::topics_command_(
                 return;
             }
 
-            std::cout << '\n' << data << std::endl;
+            view_.show("\n" + data);
         }
         else if (keys_argument_(arg_2))
         {
@@ -541,6 +646,29 @@ void Controller::topics_command_(
 
             ddspipe::yaml::set(yml, data, true);
         }
+        else if (latency_argument_(arg_2))
+        {
+            // Handle 'topics <name> latency'
+            if (!model_->live())
+            {
+                view_.show_error(STR_ENTRY
+                        << "Latency is not available for recorded data.");
+                return;
+            }
+
+            auto data = participants::ModelParser::topics_latency(*model_, filter_topic);
+
+            if (data.empty())
+            {
+                view_.show_error(STR_ENTRY
+                        << "<"
+                        << arguments[1]
+                        << "> does not match any topic in the DDS network.");
+                return;
+            }
+
+            ddspipe::yaml::set_collection(yml, data);
+        }
 
         else
         {
@@ -548,7 +676,7 @@ void Controller::topics_command_(
                     << "<"
                     << arguments[2]
                     << "> is not a valid topic option. "
-                    << "Valid options are \"v \", \"vv\" (verbosity modes), \"idl\" or \"keys\".");
+                    << "Valid options are \"v \", \"vv\" (verbosity modes), \"idl\", \"keys\" or \"latency\".");
             return;
         }
     }
@@ -563,28 +691,44 @@ void Controller::topics_command_(
 
         if (keys_argument_(arg_2))
         {
-            // Handle 'topics <name> keys v'
-            auto data = participants::ModelParser::topics_keys(*model_, filter_topic);
-
-            if (data.empty())
-            {
-                view_.show_error(STR_ENTRY
-                        << "<"
-                        << arguments[1]
-                        << "> does not match any topic in the DDS network or no type information available.");
-                return;
-            }
-
             const std::string& arg_3 = arguments[3];
             if (verbose_argument_(arg_3))
             {
+                // Handle 'topics <name> keys v'
+                auto data = participants::ModelParser::topics_keys(*model_, filter_topic);
+
+                if (data.empty())
+                {
+                    view_.show_error(STR_ENTRY
+                            << "<"
+                            << arguments[1]
+                            << "> does not match any topic in the DDS network or no type information available.");
+                    return;
+                }
+
                 ddspipe::yaml::set(yml, data, false);
             }
+            else if (verbose_verbose_argument_(arg_3))
+            {
+                // Handle 'topics <name> keys vv'
+                auto data = participants::ModelParser::topics_instances(*model_, filter_topic);
+
+                if (data.empty())
+                {
+                    view_.show_error(STR_ENTRY
+                            << "<"
+                            << arguments[1]
+                            << "> does not match any topic in the DDS network or no type information available.");
+                    return;
+                }
+
+                ddspipe::yaml::set_collection(yml, data);
+            }
             else
             {
                 view_.show_error(STR_ENTRY
                         << "Last argument <" << arg_3 << "> is not valid. "
-                        << "Only \"v\" (verbosity mdode) is allowed after \"keys\".");
+                        << "Only \"v\" or \"vv\" (verbosity modes) are allowed after \"keys\".");
             }
         }
     }
@@ -605,33 +749,37 @@ void Controller::print_command_(
         return;
     }
 
-    // Print all data
-    if (all_argument_(arguments[1]))
+    // Read verbose and the echo limits
+    bool verbose = false;
+    double max_rate = participants::SampleThrottle::UNLIMITED_RATE;
+    uint32_t every = 1;
+    std::size_t last = 0;
+    std::vector<std::string> fields;
+    bool compact = false;
+    participants::CompactFormat compact_format = participants::CompactFormat::ndjson;
+    if (!echo_arguments_(arguments, verbose, max_rate, every, last, fields, compact, compact_format))
     {
-        bool activated = model_->activate_all(
-            std::make_shared<participants::DataStreamer::CallbackType>(
-                [this](
-                    const ddspipe::core::types::DdsTopic& topic,
-                    const fastdds::dds::DynamicType::_ref_type& dyn_type,
-                    const ddspipe::core::types::RtpsPayloadData& data
-                    )
-                {
-                    data_stream_callback_verbose_(topic, dyn_type, data);
-                }));
-
-        if (!activated)
-        {
-            view_.show_error(STR_ENTRY
-                    << "Error printing all topics.");
-            return;
-        }
+        return;
+    }
+    for (const auto& formatter : echo_formatters_)
+    {
+        formatter->serializer.select_fields(fields);
+        formatter->serializer.set_compact(compact);
+    }
 
+    if (last > 0 && model_->history_depth() == 0)
+    {
+        view_.show_error(STR_ENTRY
+                << "Option <last> requires the history to be enabled (set specs history depth).");
+        return;
     }
 
+    const bool print_all = all_argument_(arguments[1]);
+    ddspipe::core::types::WildcardDdsFilterTopic filter_topic;
+
     // Print topic
-    else
+    if (!print_all)
     {
-        ddspipe::core::types::WildcardDdsFilterTopic filter_topic;
         filter_topic.topic_name = arguments[1];
 
         std::set<eprosima::ddspipe::core::types::DdsTopic> topics =
@@ -651,54 +799,397 @@ void Controller::print_command_(
             return;
         }
 
-        // Check if verbose is set
-        bool verbose = false;
-        if (arguments.size() >= 3)
+        // The fields selected must be members of the type of at least one topic
+        if (!fields.empty())
         {
-            verbose = verbose_argument_(arguments[2]);
+            std::string error;
+            bool any_topic_has_fields = false;
+            for (const auto& topic : topics)
+            {
+                const auto decoder = model_->get_type_decoder(topic.type_name);
+                if (decoder && echo_formatters_.front()->serializer.can_serialize(*decoder, error))
+                {
+                    any_topic_has_fields = true;
+                    break;
+                }
+            }
+            if (!any_topic_has_fields)
+            {
+                view_.show_error(STR_ENTRY << error);
+                return;
+            }
         }
+    }
 
-        std::shared_ptr<participants::DataStreamer::CallbackType> callback;
+    // Every dispatcher thread formats the samples of its topics with its own formatter
+    const bool verbose_output = print_all || verbose;
+    std::vector<std::shared_ptr<participants::DataStreamer::CallbackType>> callbacks;
+    for (const auto& formatter : echo_formatters_)
+    {
+        EchoFormatter* thread_formatter = formatter.get();
+        callbacks.push_back(std::make_shared<participants::DataStreamer::CallbackType>(
+                    [this, verbose_output, compact, compact_format, thread_formatter](
+                        const ddspipe::core::types::DdsTopic& topic,
+                        const std::shared_ptr<participants::TypeDecoder>& decoder,
+                        const ddspipe::core::types::RtpsPayloadData& data
+                        )
+                    {
+                        if (compact)
+                        {
+                            data_stream_callback_compact_(*thread_formatter, compact_format, topic, decoder, data);
+                        }
+                        else if (verbose_output)
+                        {
+                            data_stream_callback_verbose_(*thread_formatter, topic, decoder, data);
+                        }
+                        else
+                        {
+                            data_stream_callback_(*thread_formatter, topic, decoder, data);
+                        }
+                    }));
+    }
 
-        if (verbose)
+    // The compact formats that need it start with a header
+    if (compact)
+    {
+        const std::string header = participants::compact_format_header(compact_format);
+        if (!header.empty())
         {
-            callback = std::make_shared<participants::DataStreamer::CallbackType>(
-                [this](
-                    const ddspipe::core::types::DdsTopic& topic,
-                    const fastdds::dds::DynamicType::_ref_type& dyn_type,
-                    const ddspipe::core::types::RtpsPayloadData& data
-                    )
-                {
-                    data_stream_callback_verbose_(topic, dyn_type, data);
-                });
+            std::lock_guard<std::mutex> _(view_mutex_);
+            view_.write(header);
+        }
+    }
+
+    // Samples left out by the echo limits are discarded before reaching the dispatcher
+    std::shared_ptr<participants::SampleThrottle> throttle;
+    if (max_rate != participants::SampleThrottle::UNLIMITED_RATE || every > 1)
+    {
+        throttle = std::make_shared<participants::SampleThrottle>(max_rate, every);
+    }
+
+    if (last > 0)
+    {
+        // The samples kept are printed at once from this thread, they are only decoded now
+        echo_history_(print_all ? ddspipe::core::types::WildcardDdsFilterTopic() : filter_topic, last,
+                *callbacks.front(), throttle);
+    }
+    else if (player_)
+    {
+        // Offline data is printed at once from this thread, in the order it was recorded
+        if (print_all)
+        {
+            player_->replay_all(*callbacks.front(), throttle);
         }
         else
         {
-            callback = std::make_shared<participants::DataStreamer::CallbackType>(
-                [this](
-                    const ddspipe::core::types::DdsTopic& topic,
-                    const fastdds::dds::DynamicType::_ref_type& dyn_type,
-                    const ddspipe::core::types::RtpsPayloadData& data
-                    )
-                {
-                    data_stream_callback_(topic, dyn_type, data);
-                });
+            player_->replay(filter_topic, *callbacks.front(), throttle);
+        }
+    }
+    else
+    {
+        // Printing happens in the dispatcher threads, reception threads only queue the samples
+        echo_dispatcher_.start(callbacks);
+
+        // The entry of each topic in the dispatcher is resolved once, along with the topic in the data streamer
+        auto dispatch_binder = std::make_shared<participants::DataStreamer::TopicBinderType>(
+            [this](
+                const ddspipe::core::types::DdsTopic& topic,
+                const std::shared_ptr<participants::TypeDecoder>& decoder
+                )
+            {
+                return echo_dispatcher_.topic_callback(topic, decoder);
+            });
+
+        // Must subscribe to the data streamer with the required callback
+        echo_subscription_ = print_all ?
+                model_->subscribe_all_bound(dispatch_binder, throttle) :
+                model_->subscribe_bound(filter_topic, dispatch_binder, throttle);
+
+        if (echo_subscription_ == participants::DataStreamer::INVALID_SUBSCRIPTION)
+        {
+            echo_dispatcher_.stop();
+            view_.show_error(STR_ENTRY
+                    << "Error printing "
+                    << (print_all ? "all topics" : arguments[1])
+                    << ".");
+            return;
+        }
+
+        // Wait for other command to stop printing topics
+        input_.stdin_handler().set_ignore_input(true);
+        input_.wait_something();
+        input_.stdin_handler().set_ignore_input(false);
+        model_->unsubscribe(echo_subscription_);
+        echo_subscription_ = participants::DataStreamer::INVALID_SUBSCRIPTION;
+        echo_dispatcher_.stop();
+
+        // Small delay to allow stdout to flush and avoid prompt overlap
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    // Report samples that could not be printed fast enough
+    const auto dropped_samples = echo_dispatcher_.dropped_samples();
+    if (!dropped_samples.empty())
+    {
+        std::lock_guard<std::mutex> _(view_mutex_);
+        Yaml yml;
+        for (const auto& dropped : dropped_samples)
+        {
+            yml[dropped.first] = dropped.second;
+        }
+        view_.show("Samples dropped by the echo queue:");
+        view_.show(yml);
+    }
+
+    // Report samples left out by the echo limits
+    const auto suppressed_samples = throttle ? throttle->suppressed_samples() : std::map<std::string, uint64_t>();
+    if (!suppressed_samples.empty())
+    {
+        std::lock_guard<std::mutex> _(view_mutex_);
+        Yaml yml;
+        for (const auto& suppressed : suppressed_samples)
+        {
+            yml[suppressed.first] = suppressed.second;
+        }
+        view_.show("Samples suppressed by the echo limits:");
+        view_.show(yml);
+    }
+}
+
+void Controller::echo_history_(
+        const ddspipe::core::types::WildcardDdsFilterTopic& filter_topic,
+        std::size_t last,
+        const participants::DataStreamer::CallbackType& callback,
+        const std::shared_ptr<participants::SampleThrottle>& throttle) noexcept
+{
+    for (const auto& topic : participants::ModelParser::get_topics(*model_, filter_topic))
+    {
+        const auto decoder = model_->get_type_decoder(topic.type_name);
+        if (!decoder)
+        {
+            continue;
+        }
+
+        for (const auto& data : model_->get_topic_history(topic, last))
+        {
+            // The limits apply to the time the samples were sent, not to the time they are printed
+            if (throttle &&
+                    !throttle->accept(topic.m_topic_name,
+                    std::chrono::steady_clock::time_point(std::chrono::nanoseconds(data->source_timestamp.to_ns()))))
+            {
+                continue;
+            }
+
+            callback(topic, decoder, *data);
+        }
+    }
+}
+
+void Controller::record_command_(
+        const std::vector<std::string>& arguments) noexcept
+{
+    // Check the number of arguments is correct
+    if (arguments.size() < 3)
+    {
+        view_.show_error(STR_ENTRY
+                << "Command <"
+                << arguments[0]
+                << "> requires a topic name (or all) and a file name.");
+        return;
+    }
+
+    const bool record_all = all_argument_(arguments[1]);
+    const std::string& file_name = arguments[2];
+
+    auto recorder = std::make_shared<participants::DataRecorder>();
+    if (!recorder->open(file_name))
+    {
+        view_.show_error(STR_ENTRY
+                << "Could not create file <"
+                << file_name
+                << ">.");
+        return;
+    }
+
+    // NOTE: the samples are appended as received, they are never deserialized
+    auto record_callback = std::make_shared<participants::DataStreamer::CallbackType>(
+        [recorder](
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<participants::TypeDecoder>& decoder,
+            const ddspipe::core::types::RtpsPayloadData& data
+            )
+        {
+            recorder->record(topic, decoder, data);
+        });
+
+    ddspipe::core::types::WildcardDdsFilterTopic filter_topic;
+    filter_topic.topic_name = arguments[1];
+
+    if (player_)
+    {
+        // Offline data is recorded again at once, so a file can be cut down to some of its topics
+        if (record_all)
+        {
+            player_->replay_all(*record_callback);
+        }
+        else
+        {
+            player_->replay(filter_topic, *record_callback);
+        }
+    }
+    else
+    {
+        // Topics discovered while recording are recorded as well
+        const auto subscription = record_all ?
+                model_->subscribe_all(record_callback) :
+                model_->subscribe(filter_topic, record_callback);
+
+        if (subscription == participants::DataStreamer::INVALID_SUBSCRIPTION)
+        {
+            recorder->close();
+            view_.show_error(STR_ENTRY
+                    << "Error recording "
+                    << (record_all ? "all topics" : arguments[1])
+                    << ".");
+            return;
         }
 
-        // Must activate data streamer with the required callback
-        bool activated = model_->activate(
-            filter_topic,
-            callback);
+        // Wait for other command to stop recording
+        input_.stdin_handler().set_ignore_input(true);
+        input_.wait_something();
+        input_.stdin_handler().set_ignore_input(false);
+        model_->unsubscribe(subscription);
     }
 
-    // Wait for other command to stop printing topics
+    recorder->close();
+
+    std::lock_guard<std::mutex> _(view_mutex_);
+    Yaml yml;
+    yml["file"] = file_name;
+    yml["samples"] = recorder->samples();
+    yml["bytes"] = recorder->size();
+    view_.show(yml);
+}
+
+void Controller::top_command_(
+        const std::vector<std::string>& arguments) noexcept
+{
+    std::size_t size = 10;
+    participants::TopicRanking::Key key = participants::TopicRanking::Key::rate;
+    std::string key_name = "rate";
+    uint64_t interval_ms = 1000;
+
+    for (std::size_t i = 1; i < arguments.size(); ++i)
+    {
+        const std::string& argument = arguments[i];
+        if (argument == "--sort")
+        {
+            key_name = (i + 1 < arguments.size()) ? arguments[++i] : "";
+            if (key_name == "rate")
+            {
+                key = participants::TopicRanking::Key::rate;
+            }
+            else if (key_name == "bandwidth")
+            {
+                key = participants::TopicRanking::Key::bandwidth;
+            }
+            else if (key_name == "writers")
+            {
+                key = participants::TopicRanking::Key::writers;
+            }
+            else
+            {
+                view_.show_error(STR_ENTRY
+                        << "Option <" << argument << "> requires one of rate, bandwidth or writers.");
+                return;
+            }
+        }
+        else if (argument == "--interval")
+        {
+            const char* value = (i + 1 < arguments.size()) ? arguments[++i].c_str() : "";
+            char* end = nullptr;
+            interval_ms = std::strtoull(value, &end, 10);
+            if (end == value || *end != '\0' || value[0] == '-' || interval_ms == 0 ||
+                    interval_ms > static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()))
+            {
+                view_.show_error(STR_ENTRY
+                        << "Option <" << argument << "> requires a positive number of milliseconds.");
+                return;
+            }
+        }
+        else
+        {
+            const char* value = argument.c_str();
+            char* end = nullptr;
+            const unsigned long long topics = std::strtoull(value, &end, 10);
+            if (end == value || *end != '\0' || value[0] == '-' || topics == 0 ||
+                    topics > std::numeric_limits<std::size_t>::max())
+            {
+                view_.show_error(STR_ENTRY
+                        << "<" << argument << "> is not a valid top option. "
+                        << "Valid options are a positive number of topics, \"--sort\" or \"--interval\".");
+                return;
+            }
+            size = static_cast<std::size_t>(topics);
+        }
+    }
+
+    if (player_)
+    {
+        // Offline data does not change, so it is shown once
+        show_top_(size, key, (STR_ENTRY << "Top " << size << " topics by " << key_name << ":").to_string());
+        return;
+    }
+
+    const std::string header = (STR_ENTRY
+            << "Top " << size << " topics by " << key_name
+            << ", every " << interval_ms << " ms (press enter to exit):").to_string();
+
+    // The ranking is refreshed in its own thread until something is entered
+    std::mutex stop_mutex;
+    std::condition_variable stop_cv;
+    bool stop = false;
+
+    std::thread refresh_thread([this, size, key, interval_ms, &header, &stop_mutex, &stop_cv, &stop]()
+            {
+                const auto stopped = [&stop]()
+                        {
+                            return stop;
+                        };
+
+                std::unique_lock<std::mutex> lock(stop_mutex);
+                show_top_(size, key, header);
+                while (!stop_cv.wait_for(lock, std::chrono::milliseconds(interval_ms), stopped))
+                {
+                    show_top_(size, key, header);
+                }
+            });
+
     input_.stdin_handler().set_ignore_input(true);
     input_.wait_something();
     input_.stdin_handler().set_ignore_input(false);
-    model_->deactivate();
 
-    // Small delay to allow stdout to flush and avoid prompt overlap
-    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    {
+        std::lock_guard<std::mutex> _(stop_mutex);
+        stop = true;
+    }
+    stop_cv.notify_all();
+    refresh_thread.join();
+}
+
+void Controller::show_top_(
+        std::size_t size,
+        participants::TopicRanking::Key key,
+        const std::string& header) noexcept
+{
+    Yaml yml;
+    ddspipe::yaml::set_collection(yml, participants::ModelParser::top_topics(*model_, size, key));
+
+    std::lock_guard<std::mutex> _(view_mutex_);
+    view_.clear();
+    view_.show(header);
+    view_.show(yml);
+    view_.flush();
 }
 
 void Controller::version_command_(
@@ -748,6 +1239,10 @@ void Controller::help_command_(
             "\ttopics <name> keys                          : Display the keys for topics matching <name> (wildcards allowed).\n"
             <<
             "\ttopics <name> keys v                        : verbose information about keys discovered in the network.\n"
+            <<
+            "\ttopics <name> keys vv                       : verbose information about each instance, highest rate first.\n"
+            <<
+            "\ttopics <name> latency                       : Latency percentiles of the data of topics matching <name>, by writer.\n"
             << "\tfilters                                     : Display the active filters.\n"
             << "\tfilters clear                               : Clear all the filter lists.\n"
             << "\tfilter clear <category>                     : Clear <category> filter list.\n"
@@ -764,10 +1259,31 @@ void Controller::help_command_(
             "\techo <wildcard_name> verbose                : data with additional source info of Topics matching the topic name (wildcard allowed (*)).\n"
             <<
             "\techo all                                    : verbose data of all topics (only those whose Data Type is discovered).\n"
+            <<
+            "\techo <name> --max-rate <Hz>                 : data of at most <Hz> samples per second of each Topic.\n"
+            << "\techo <name> --every <N>                     : data of one of every <N> samples of each Topic.\n"
+            <<
+            "\techo <name> last <N>                        : data of the last <N> samples kept of each Topic (history must be enabled).\n"
+            <<
+            "\techo <name> fields <list>                   : data of only the members in the comma separated <list> (e.g. header.stamp,status) of each Topic.\n"
+            <<
+            "\techo <name> --format <format>               : data of each sample in a single ndjson, csv or cbor record with its source info.\n"
+            <<
+            "\trecord <name> <file>                        : record the data of Topics matching the name (wildcard allowed (*)) in <file>.\n"
+            << "\trecord all <file>                           : record the data of all topics in <file>.\n"
+            <<
+            "\ttop                                         : the 10 Topics with the highest rate, refreshed in place every second.\n"
+            <<
+            "\ttop <N> --sort <key>                        : the <N> Topics with the highest rate, bandwidth or writers (<key>).\n"
+            <<
+            "\ttop --interval <ms>                         : the most active Topics, refreshed in place every <ms> milliseconds.\n"
             << "\n"
             << "Notes and comments:\n"
             << "\tTo exit from data printing, press enter.\n"
-            << "\tEach command is accessible by using its first letter (h/v/q/p/w/r/t/s/f).\n"
+            << "\tTo stop recording, press enter.\n"
+            << "\tTo exit from top, press enter.\n"
+            << "\tEcho options --max-rate and --every can be combined, and used with verbose and all.\n"
+            << "\tEach command but record and top is accessible by using its first letter (h/v/q/p/w/r/t/s/f).\n"
             << "\n"
             << "For more information about these commands and formats, please refer to the documentation:\n"
             << "https://fast-dds-spy.readthedocs.io/en/latest/\n"
@@ -823,10 +1339,11 @@ void Controller::filter_command_(
         }
 
         // print the filters list
-        std::cout << "--------\n";
-        std::cout << "Filters:\n";
-        std::cout << "--------\n\n";
-        std::cout << "  Topic:\n";
+        std::ostringstream filters;
+        filters << "--------\n";
+        filters << "Filters:\n";
+        filters << "--------\n\n";
+        filters << "  Topic:\n";
         for (const auto& topic_pair: topic_filter_dict_)
         {
             // If there is no content topic filter, do not print ""
@@ -835,15 +1352,17 @@ void Controller::filter_command_(
                 continue;
             }
 
-            std::cout << "    " << topic_pair.first << ": \"" << topic_pair.second << "\"\n";
+            filters << "    " << topic_pair.first << ": \"" << topic_pair.second << "\"\n";
         }
 
-        std::cout << "\n  Partitions:\n";
+        filters << "\n  Partitions:\n";
 
         for (const auto& partition: partition_filter_set_)
         {
-            std::cout << "    - " << (partition == "" ? "\"\"" : partition) << "\n";
+            filters << "    - " << (partition == "" ? "\"\"" : partition) << "\n";
         }
+
+        view_.write(filters.str());
     }
     else if (arguments.size() == 2) // clear filters
     {
@@ -904,8 +1423,12 @@ void Controller::filter_command_(
         }
         else
         {
-            topic_filter_dict_.clear();
+            for (auto& pair_topic : topic_filter_dict_)
+            {
+                pair_topic.second = "";
+            }
             update_topics();
+            topic_filter_dict_.clear();
         }
     }
     else if (arguments.size() == 4)
@@ -1000,6 +1523,7 @@ void Controller::filter_command_(
             else
             {
                 topic_filter_dict_[topic_str] = "";
+                update_content_topicfilter(topic_str);
             }
         }
 
@@ -1016,12 +1540,6 @@ void Controller::filter_command_(
             return;
         }
 
-        if (!configuration_.dds_enabled)
-        {
-            view_.show_error(STR_ENTRY << "RTPS does not support ContentFilteredTopic.");
-            return;
-        }
-
         operation = arguments[1];  // <set>
         category = arguments[2];   // topic
         topic_str = arguments[3];  // topic name
@@ -1042,6 +1560,18 @@ void Controller::filter_command_(
             return;
         }
 
+        // RTPS readers have no ContentFilteredTopic, so the spy filters their data itself
+        if (!configuration_.dds_enabled)
+        {
+            std::string error;
+            if (!model_->set_content_filter(topic_str, filter_str, error))
+            {
+                view_.show_error(STR_ENTRY
+                        << "Filter <" << filter_str << "> is not valid: " << error);
+                return;
+            }
+        }
+
         // Set "filter_str" for topic filter
         topic_filter_dict_[topic_str] = filter_str;
 
@@ -1071,11 +1601,33 @@ void Controller::update_content_topicfilter(
         filter_str = topic_it->second;
     }
 
-    backend_.update_readers_track_content_filter(topic_name, filter_str);
+    if (!configuration_.dds_enabled)
+    {
+        std::string error;
+        if (!model_->set_content_filter(topic_name, filter_str, error))
+        {
+            EPROSIMA_LOG_WARNING(
+                FASTDDSSPY_CONTROLLER,
+                "Filter <" << filter_str << "> of topic <" << topic_name << "> is not valid: " << error);
+        }
+    }
+    else if (backend_)
+    {
+        backend_->update_readers_track_content_filter(topic_name, filter_str);
+    }
 }
 
 void Controller::update_topics()
 {
+    // The spy filters topics by name, that may have no endpoint left
+    if (!configuration_.dds_enabled)
+    {
+        for (const auto& topic_filter : topic_filter_dict_)
+        {
+            update_content_topicfilter(topic_filter.first);
+        }
+    }
+
     for (const endpoint_pair& endpoint: model_->endpoint_database_)
     {
         update_content_topicfilter(endpoint.second.info.topic.topic_name());
@@ -1085,7 +1637,10 @@ void Controller::update_topics()
 void Controller::update_partitions()
 {
     // -- Update readers in the tracks ----------------------------------------
-    backend_.update_readers_track_partitions(partition_filter_set_);
+    if (backend_)
+    {
+        backend_->update_readers_track_partitions(partition_filter_set_);
+    }
 
 
     // -- Update endpoints in the database ------------------------------------
@@ -1188,6 +1743,15 @@ void Controller::set_content_topic_filter(
         const std::map<std::string, std::string>& topic_filter_dict)
 {
     topic_filter_dict_ = topic_filter_dict;
+
+    // The readers only get the filters of the configuration with DDS, so with RTPS the spy applies them itself
+    if (!configuration_.dds_enabled)
+    {
+        for (const auto& topic_filter : topic_filter_dict_)
+        {
+            update_content_topicfilter(topic_filter.first);
+        }
+    }
 }
 
 } /* namespace spy */
@@ -16,11 +16,19 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
+#include <vector>
 
 #include <fastdds/dds/xtypes/dynamic_types/DynamicType.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/DynamicData.hpp>
 
+#include <fastddsspy_participants/model/DataDispatcher.hpp>
 #include <fastddsspy_participants/model/DataStreamer.hpp>
+#include <fastddsspy_participants/model/SampleThrottle.hpp>
+#include <fastddsspy_participants/model/TypeDecoder.hpp>
+#include <fastddsspy_participants/recording/RecordPlayer.hpp>
+#include <fastddsspy_participants/visualization/compact_formats.hpp>
+#include <fastddsspy_participants/visualization/SampleJsonSerializer.hpp>
 
 #include <fastddsspy_yaml/YamlReaderConfiguration.hpp>
 
@@ -37,8 +45,19 @@ class Controller
 {
 public:
 
+    /**
+     * @brief Create the controller of the tool
+     *
+     * @param offline_file Record file to inspect instead of spying on a domain, empty to spy on a domain.
+     *
+     * @throw \c InitializationException if \c offline_file cannot be loaded.
+     */
     Controller(
-            const yaml::Configuration& configuration);
+            const yaml::Configuration& configuration,
+            const std::string& offline_file = "");
+
+    //! Stop echoing samples before the members they are formatted with are destroyed
+    ~Controller();
 
     void run();
 
@@ -56,23 +75,42 @@ public:
 
 protected:
 
+    //! Formatting state of a thread echoing samples, so samples are formatted without holding \c view_mutex_
+    struct EchoFormatter
+    {
+        //! Writes the JSON of echoed samples
+        participants::SampleJsonSerializer serializer;
+
+        //! Text of the echoed sample, kept to reuse its memory
+        std::string buffer;
+
+        //! Compact JSON of the echoed sample in the compact formats, kept to reuse its memory
+        std::string json;
+    };
+
     void run_command_(
             const utils::Command<CommandValue>& command);
 
     ////////////////////////////
     // DATA STREAM CALLBACKS
-    static fastdds::dds::DynamicData::_ref_type get_dynamic_data_(
-            const fastdds::dds::DynamicType::_ref_type& dyn_type,
-            const ddspipe::core::types::RtpsPayloadData& data) noexcept;
-
     void data_stream_callback_(
+            EchoFormatter& formatter,
             const ddspipe::core::types::DdsTopic& topic,
-            const fastdds::dds::DynamicType::_ref_type& dyn_type,
+            const std::shared_ptr<participants::TypeDecoder>& decoder,
             const ddspipe::core::types::RtpsPayloadData& data);
 
     void data_stream_callback_verbose_(
+            EchoFormatter& formatter,
+            const ddspipe::core::types::DdsTopic& topic,
+            const std::shared_ptr<participants::TypeDecoder>& decoder,
+            const ddspipe::core::types::RtpsPayloadData& data);
+
+    //! Print a sample as a single record in \c format, with its metadata inline
+    void data_stream_callback_compact_(
+            EchoFormatter& formatter,
+            participants::CompactFormat format,
             const ddspipe::core::types::DdsTopic& topic,
-            const fastdds::dds::DynamicType::_ref_type& dyn_type,
+            const std::shared_ptr<participants::TypeDecoder>& decoder,
             const ddspipe::core::types::RtpsPayloadData& data);
 
     /////////////////////
@@ -89,9 +127,29 @@ protected:
     bool keys_argument_(
             const std::string& argument) const noexcept;
 
+    bool latency_argument_(
+            const std::string& argument) const noexcept;
+
     bool all_argument_(
             const std::string& argument) const noexcept;
 
+    /**
+     * @brief Read the arguments of an echo command that follow the topic
+     *
+     * Shows an error if an option has a wrong value.
+     *
+     * @return false if the arguments are not valid.
+     */
+    bool echo_arguments_(
+            const std::vector<std::string>& arguments,
+            bool& verbose,
+            double& max_rate,
+            uint32_t& every,
+            std::size_t& last,
+            std::vector<std::string>& fields,
+            bool& compact,
+            participants::CompactFormat& compact_format) noexcept;
+
     ////////////////////////////////////////////////////////////////////////////////////
     // COMMANDS ROUTINES
 
@@ -111,6 +169,27 @@ protected:
     void print_command_(
             const std::vector<std::string>& arguments) noexcept;
 
+    //! Print the last \c last samples kept of each topic matching \c filter_topic
+    void echo_history_(
+            const ddspipe::core::types::WildcardDdsFilterTopic& filter_topic,
+            std::size_t last,
+            const participants::DataStreamer::CallbackType& callback,
+            const std::shared_ptr<participants::SampleThrottle>& throttle) noexcept;
+
+    void record_command_(
+            const std::vector<std::string>& arguments) noexcept;
+
+    /////////////////////
+    // TOP
+    void top_command_(
+            const std::vector<std::string>& arguments) noexcept;
+
+    //! Show the \c size most active topics ranked by \c key, in place of the previous ones
+    void show_top_(
+            std::size_t size,
+            participants::TopicRanking::Key key,
+            const std::string& header) noexcept;
+
     /////////////////////
     // FILTER
     void filter_command_(
@@ -127,7 +206,9 @@ protected:
 
     /////////////////////
     // VARIABLES
-    Backend backend_;
+
+    //! Spies on the domain, null in offline mode
+    std::unique_ptr<Backend> backend_;
 
     Input input_;
 
@@ -137,6 +218,15 @@ protected:
 
     yaml::Configuration configuration_;
 
+    //! Decouples the echo output from the reception threads
+    participants::DataDispatcher echo_dispatcher_;
+
+    //! Subscription of the samples pushed to \c echo_dispatcher_, invalid while not echoing
+    participants::DataStreamer::SubscriptionHandle echo_subscription_;
+
+    //! Data of the record file loaded in the model, null unless in offline mode
+    std::unique_ptr<participants::RecordPlayer> player_;
+
 private:
 
     template<typename SimpleF, typename VerboseF, typename specificF>
@@ -160,6 +250,9 @@ private:
 
     std::mutex view_mutex_;
 
+    //! Formatter of each thread of \c echo_dispatcher_, the first one also used by the commands that print at once
+    std::vector<std::unique_ptr<EchoFormatter>> echo_formatters_;
+
     std::set<std::string> partition_filter_set_;
     std::map<std::string, std::string> topic_filter_dict_;
 
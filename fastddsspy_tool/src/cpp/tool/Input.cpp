@@ -12,8 +12,6 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <iostream>
-
 #include <cpp_utils/user_interface/CommandReader.hpp>
 
 #include "Input.hpp"
@@ -30,7 +28,6 @@ Input::Input()
 utils::Command<CommandValue> Input::wait_next_command()
 {
     utils::Command<CommandValue> command;
-    std::cout << std::endl << "\033[1;36m" << "Insert a command for Fast DDS Spy:\n>> " << "\033[0m" << std::flush;
 
     auto res = reader_.read_next_command(command);
 
@@ -0,0 +1,236 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <iostream>
+
+#if defined(_WIN32)
+#include <io.h>
+#include <stdio.h>
+#else
+#include <cerrno>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif // if defined(_WIN32)
+
+#include "OutputSink.hpp"
+
+namespace eprosima {
+namespace spy {
+
+namespace {
+
+bool stdout_is_tty() noexcept
+{
+#if defined(_WIN32)
+    return _isatty(_fileno(stdout)) != 0;
+#else
+    return isatty(STDOUT_FILENO) != 0;
+#endif // if defined(_WIN32)
+}
+
+//! Write both buffers to stdout, in order
+void write_stdout(
+        const char* first,
+        std::size_t first_size,
+        const char* second,
+        std::size_t second_size)
+{
+    // Anything written through std::cout goes first
+    std::cout.flush();
+
+#if defined(_WIN32)
+    std::cout.write(first, first_size);
+    std::cout.write(second, second_size);
+    std::cout.flush();
+#else
+    struct iovec iov[2];
+    iov[0].iov_base = const_cast<char*>(first);
+    iov[0].iov_len = first_size;
+    iov[1].iov_base = const_cast<char*>(second);
+    iov[1].iov_len = second_size;
+
+    struct iovec* pending = iov;
+    int pending_count = (second_size > 0) ? 2 : 1;
+    while (pending_count > 0)
+    {
+        const ssize_t written = ::writev(STDOUT_FILENO, pending, pending_count);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            // stdout is not writable: output is lost, as it would be with std::cout
+            return;
+        }
+
+        // Skip what has been written, which may end in the middle of a buffer
+        std::size_t remaining = static_cast<std::size_t>(written);
+        while (pending_count > 0 && remaining >= pending->iov_len)
+        {
+            remaining -= pending->iov_len;
+            ++pending;
+            --pending_count;
+        }
+        if (pending_count > 0)
+        {
+            pending->iov_base = static_cast<char*>(pending->iov_base) + remaining;
+            pending->iov_len -= remaining;
+        }
+    }
+#endif // if defined(_WIN32)
+}
+
+} /* namespace */
+
+constexpr std::size_t OutputSink::FLUSH_SIZE;
+constexpr std::chrono::milliseconds OutputSink::MAX_DELAY;
+constexpr std::chrono::milliseconds OutputSink::TTY_IDLE_DELAY;
+
+OutputSink::OutputSink()
+    : is_tty_(stdout_is_tty())
+{
+    buffer_.reserve(FLUSH_SIZE);
+    writing_buffer_.reserve(FLUSH_SIZE);
+    thread_ = std::thread(&OutputSink::run_, this);
+}
+
+OutputSink& OutputSink::get_instance()
+{
+    static OutputSink instance;
+    return instance;
+}
+
+OutputSink::~OutputSink()
+{
+    {
+        std::lock_guard<std::mutex> _(buffer_mutex_);
+        stop_ = true;
+    }
+    wake_cv_.notify_one();
+    thread_.join();
+
+    flush();
+}
+
+void OutputSink::write(
+        const char* data,
+        std::size_t size)
+{
+    if (size >= FLUSH_SIZE)
+    {
+        // Too large to buffer: write it right after the buffered output
+        std::lock_guard<std::mutex> _(write_mutex_);
+        write_out_(data, size);
+        return;
+    }
+
+    bool was_empty;
+    bool full;
+    {
+        std::lock_guard<std::mutex> _(buffer_mutex_);
+        const auto now = std::chrono::steady_clock::now();
+        was_empty = buffer_.empty();
+        if (was_empty)
+        {
+            oldest_write_time_ = now;
+        }
+        newest_write_time_ = now;
+        buffer_.append(data, size);
+        full = (buffer_.size() >= FLUSH_SIZE);
+    }
+
+    if (full)
+    {
+        flush();
+    }
+    else if (was_empty)
+    {
+        // NOTE: the background thread only needs to know when the buffer stops being empty
+        wake_cv_.notify_one();
+    }
+}
+
+void OutputSink::write(
+        const std::string& data)
+{
+    write(data.data(), data.size());
+}
+
+void OutputSink::flush()
+{
+    std::lock_guard<std::mutex> _(write_mutex_);
+    write_out_(nullptr, 0);
+}
+
+bool OutputSink::is_tty() const noexcept
+{
+    return is_tty_;
+}
+
+void OutputSink::run_()
+{
+    std::unique_lock<std::mutex> lock(buffer_mutex_);
+    while (!stop_)
+    {
+        if (buffer_.empty())
+        {
+            wake_cv_.wait(lock, [this]()
+                    {
+                        return stop_ || !buffer_.empty();
+                    });
+            continue;
+        }
+
+        auto deadline = oldest_write_time_ + MAX_DELAY;
+        if (is_tty_)
+        {
+            deadline = std::min(deadline, newest_write_time_ + TTY_IDLE_DELAY);
+        }
+
+        if (std::chrono::steady_clock::now() < deadline)
+        {
+            // Output added meanwhile moves the deadline, so it is computed again on wake up
+            wake_cv_.wait_until(lock, deadline);
+            continue;
+        }
+
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+void OutputSink::write_out_(
+        const char* data,
+        std::size_t size)
+{
+    {
+        std::lock_guard<std::mutex> _(buffer_mutex_);
+        if (buffer_.empty() && size == 0)
+        {
+            return;
+        }
+
+        // Keep adding output to the other buffer while this one is written
+        std::swap(buffer_, writing_buffer_);
+    }
+
+    write_stdout(writing_buffer_.data(), writing_buffer_.size(), data, size);
+    writing_buffer_.clear();
+}
+
+} /* namespace spy */
+} /* namespace eprosima */
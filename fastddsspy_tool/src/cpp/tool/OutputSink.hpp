@@ -0,0 +1,124 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace eprosima {
+namespace spy {
+
+/**
+ * @brief Buffered writer of the standard output
+ *
+ * Output is kept in a userspace buffer and written to stdout in large batches: when the buffer reaches
+ * \c FLUSH_SIZE, when its oldest output is \c MAX_DELAY old, or, if stdout is a terminal, as soon as no output has
+ * been added for \c TTY_IDLE_DELAY. A background thread takes care of the time thresholds.
+ *
+ * Writes that do not fit in the buffer are written together with the buffered output in a single \c writev.
+ *
+ * Output written to \c std::cout is written before the buffered output, so anything else printing to stdout (e.g.
+ * the log) must flush the sink first to keep the order of the output.
+ *
+ * It is safe to use from several threads at once.
+ */
+class OutputSink
+{
+public:
+
+    //! Buffered size that triggers a write
+    static constexpr std::size_t FLUSH_SIZE = 64 * 1024;
+
+    //! Maximum time output stays buffered
+    static constexpr std::chrono::milliseconds MAX_DELAY{100};
+
+    //! Time without new output after which the buffer is written if stdout is a terminal
+    static constexpr std::chrono::milliseconds TTY_IDLE_DELAY{5};
+
+    OutputSink();
+
+    //! Write any buffered output
+    ~OutputSink();
+
+    OutputSink(
+            const OutputSink&) = delete;
+
+    OutputSink& operator =(
+            const OutputSink&) = delete;
+
+    //! Sink of all the output of the tool, shared with the log
+    static OutputSink& get_instance();
+
+    //! Add \c size bytes of \c data to the output
+    void write(
+            const char* data,
+            std::size_t size);
+
+    void write(
+            const std::string& data);
+
+    //! Write the buffered output now
+    void flush();
+
+    //! Whether stdout is a terminal
+    bool is_tty() const noexcept;
+
+protected:
+
+    //! Background thread: write the buffer when a time threshold expires
+    void run_();
+
+    /**
+     * @brief Write the buffered output followed by \c size bytes of \c data
+     *
+     * @pre \c write_mutex_ is locked.
+     */
+    void write_out_(
+            const char* data,
+            std::size_t size);
+
+    const bool is_tty_;
+
+    //! Output not yet written
+    std::string buffer_;
+
+    //! Output being written, kept to reuse its memory
+    std::string writing_buffer_;
+
+    //! Time the oldest output in the buffer was added
+    std::chrono::steady_clock::time_point oldest_write_time_;
+
+    //! Time the newest output in the buffer was added
+    std::chrono::steady_clock::time_point newest_write_time_;
+
+    bool stop_ {false};
+
+    //! Guards the buffer and the times
+    std::mutex buffer_mutex_;
+
+    //! Keeps the order of the writes to stdout
+    std::mutex write_mutex_;
+
+    std::condition_variable wake_cv_;
+
+    std::thread thread_;
+};
+
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,30 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "OutputSink.hpp"
+#include "SinkLogConsumer.hpp"
+
+namespace eprosima {
+namespace spy {
+
+void SinkLogConsumer::Consume(
+        const utils::Log::Entry& entry)
+{
+    // NOTE: the output shown so far goes first, as the entry is written straight to stdout
+    OutputSink::get_instance().flush();
+    utils::StdLogConsumer::Consume(entry);
+}
+
+} /* namespace spy */
+} /* namespace eprosima */
@@ -0,0 +1,38 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cpp_utils/logging/StdLogConsumer.hpp>
+
+namespace eprosima {
+namespace spy {
+
+/**
+ * @brief Log consumer of stdout that keeps the log in order with the output of the tool
+ *
+ * The output of the tool is buffered in \c OutputSink, so the sink is flushed before each log entry is written.
+ */
+class SinkLogConsumer : public utils::StdLogConsumer
+{
+public:
+
+    using utils::StdLogConsumer::StdLogConsumer;
+
+    void Consume(
+            const utils::Log::Entry& entry) override;
+};
+
+} /* namespace spy */
+} /* namespace eprosima */
@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <string>
+#include <sstream>
+
 #include <ddspipe_yaml/Yaml.hpp>
 
 #include "View.hpp"
@@ -21,32 +24,47 @@ namespace spy {
 
 void View::print_initial()
 {
-    std::cout << "\033[1;32m";
-    std::cout << " ____|             |        __ \\   __ \\    ___|        ___|                " << std::endl;
-    std::cout << " |     _` |   __|  __|      |   |  |   | \\___ \\      \\___ \\   __ \\   |   | " << std::endl;
-    std::cout << " __|  (   | \\__ \\  |        |   |  |   |       |           |  |   |  |   | " << std::endl;
-    std::cout << "_|   \\__,_| ____/ \\__|     ____/  ____/  _____/      _____/   .__/  \\__, | " << std::endl;
-    std::cout << "                                                              _|     ____/ " << std::endl;
-    std::cout << "\033[0m" << std::endl;
+    sink_.write(
+        "\033[1;32m"
+        " ____|             |        __ \\   __ \\    ___|        ___|                \n"
+        " |     _` |   __|  __|      |   |  |   | \\___ \\      \\___ \\   __ \\   |   | \n"
+        " __|  (   | \\__ \\  |        |   |  |   |       |           |  |   |  |   | \n"
+        "_|   \\__,_| ____/ \\__|     ____/  ____/  _____/      _____/   .__/  \\__, | \n"
+        "                                                              _|     ____/ \n"
+        "\033[0m\n");
+    sink_.flush();
+}
+
+void View::show_prompt()
+{
+    sink_.write("\n\033[1;36mInsert a command for Fast DDS Spy:\n>> \033[0m");
+    sink_.flush();
 }
 
+// NOTE: each line is written at once, so lines shown from several threads are never mixed
+
 void View::show(
         const std::string& value)
 {
-    show(value.c_str());
+    std::string line;
+    line.reserve(value.size() + 1);
+    line.append(value).push_back('\n');
+    sink_.write(line);
 }
 
 void View::show(
         const char* value)
 {
-    std::cout << value << std::endl;
+    show(std::string(value));
 }
 
 template <>
 void View::show(
         const Yaml& value)
 {
-    std::cout << value << std::endl;
+    std::ostringstream ss;
+    ss << value << '\n';
+    sink_.write(ss.str());
 }
 
 template <>
@@ -60,7 +78,7 @@ template <>
 void View::show_error(
         const std::string& value)
 {
-    std::cout << "\033[1;31m" << value << "\033[0m" << std::endl;
+    sink_.write("\033[1;31m" + value + "\033[0m\n");
 }
 
 template <>
@@ -70,5 +88,25 @@ void View::show_error(
     show_error(value.to_string());
 }
 
+void View::write(
+        const std::string& value)
+{
+    sink_.write(value);
+}
+
+void View::flush()
+{
+    sink_.flush();
+}
+
+void View::clear()
+{
+    if (sink_.is_tty())
+    {
+        // Move the cursor to the top left corner and erase the screen
+        sink_.write("\033[H\033[2J");
+    }
+}
+
 } /* namespace spy */
 } /* namespace eprosima */
@@ -18,6 +18,8 @@
 
 #include <fastddsspy_participants/model/DataStreamer.hpp>
 
+#include "OutputSink.hpp"
+
 namespace eprosima {
 namespace spy {
 
@@ -27,6 +29,9 @@ public:
 
     void print_initial();
 
+    //! Show the prompt of the next command, and everything shown before it
+    void show_prompt();
+
     void show(
             const std::string& value);
 
@@ -40,6 +45,21 @@ public:
     template <typename T>
     void show_error(
             const T& value);
+
+    //! Show \c value as is, with no line break after it
+    void write(
+            const std::string& value);
+
+    //! Write now any output shown
+    void flush();
+
+    //! Clear the terminal, so the next output is shown in place of the previous one (only if output is a terminal)
+    void clear();
+
+protected:
+
+    //! All the output of the view goes through the sink, shared with the log so that their output is not mixed
+    OutputSink& sink_ = OutputSink::get_instance();
 };
 
 } /* namespace spy */
@@ -112,6 +112,16 @@ const option::Descriptor usage[] = {
         "[Default = 0]."
     },
 
+    {
+        optionIndex::OFFLINE,
+        0,
+        "",
+        "offline",
+        Arg::Readable_File,
+        "  \t--offline\t  \t" \
+        "Load a file written by the record command and inspect its data instead of spying on a domain."
+    },
+
     ////////////////////
     // Debug options
     {
@@ -290,6 +300,10 @@ ProcessReturnCode parse_arguments(
             }
             break;
 
+            case optionIndex::OFFLINE:
+                commandline_args.offline_file = opt.arg;
+                break;
+
             case optionIndex::UNKNOWN_OPT:
                 EPROSIMA_LOG_ERROR(FASTDDSSPY_ARGS, opt << " is not a valid argument.");
                 option::printUsage(fwrite, stdout, usage, columns);
@@ -96,6 +96,12 @@ configuration_discovery_time.yaml',
                 '\ttopics <name> keys v                        : '
                 'verbose information about keys '
                 'discovered in the network.\n'
+                '\ttopics <name> keys vv                       : '
+                'verbose information about each instance, '
+                'highest rate first.\n'
+                '\ttopics <name> latency                       : '
+                'Latency percentiles of the data of topics '
+                'matching <name>, by writer.\n'
                 '\tfilters                                     : '
                 'Display the active filters.\n'
                 '\tfilters clear                               : '
@@ -128,10 +134,40 @@ configuration_discovery_time.yaml',
                 '\techo all                                    : '
                 'verbose data of all topics '
                 '(only those whose Data Type is discovered).\n'
+                '\techo <name> --max-rate <Hz>                 : '
+                'data of at most <Hz> samples per second '
+                'of each Topic.\n'
+                '\techo <name> --every <N>                     : '
+                'data of one of every <N> samples '
+                'of each Topic.\n'
+                '\techo <name> last <N>                        : '
+                'data of the last <N> samples kept '
+                'of each Topic (history must be enabled).\n'
+                '\techo <name> fields <list>                   : '
+                'data of only the members in the comma separated <list> '
+                '(e.g. header.stamp,status) of each Topic.\n'
+                '\techo <name> --format <format>               : '
+                'data of each sample in a single ndjson, csv or cbor record '
+                'with its source info.\n'
+                '\trecord <name> <file>                        : '
+                'record the data of Topics matching the name '
+                '(wildcard allowed (*)) in <file>.\n'
+                '\trecord all <file>                           : '
+                'record the data of all topics in <file>.\n'
+                '\ttop                                         : '
+                'the 10 Topics with the highest rate, refreshed in place every second.\n'
+                '\ttop <N> --sort <key>                        : '
+                'the <N> Topics with the highest rate, bandwidth or writers (<key>).\n'
+                '\ttop --interval <ms>                         : '
+                'the most active Topics, refreshed in place every <ms> milliseconds.\n'
                 '\n'
                 'Notes and comments:\n'
                 '\tTo exit from data printing, press enter.\n'
-                '\tEach command is accessible by using its '
+                '\tTo stop recording, press enter.\n'
+                '\tTo exit from top, press enter.\n'
+                '\tEcho options --max-rate and --every can be combined, '
+                'and used with verbose and all.\n'
+                '\tEach command but record and top is accessible by using its '
                 'first letter (h/v/q/p/w/r/t/s/f).\n'
                 '\n'
                 'For more information about these commands and formats, '
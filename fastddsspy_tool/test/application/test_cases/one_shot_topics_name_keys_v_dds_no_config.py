@@ -38,5 +38,5 @@ class TestCase_instance (test_class.TestCase):
             arguments_spy=['topics', 'HelloWorldTopic', 'key', 'v'],
             commands_spy=[],
             output="""- topic: HelloWorldTopic
-  keys:\n    []\n  instances:\n    []\n  instance_count: 0\n"""
+  keys:\n    []\n  instances:\n    []\n  instance_count: 0\n  evictions:\n    per_topic_limit: 0\n    total_limit: 0\n    memory_limit: 0\n"""
         )
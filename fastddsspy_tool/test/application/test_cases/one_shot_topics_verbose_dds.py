@@ -43,5 +43,11 @@ configuration_discovery_time.yaml',
   type: HelloWorld\n\
   datawriters: 1\n\
   datareaders: 0\n\
-  rate: %%rate%%\n"""
+  rate: %%rate%%\n\
+  average_rate: %%rate%%\n\
+  bandwidth: %%rate%%\n\
+  payload_size:\n\
+    min: %%rate%%\n\
+    mean: %%rate%%\n\
+    max: %%rate%%\n"""
         )
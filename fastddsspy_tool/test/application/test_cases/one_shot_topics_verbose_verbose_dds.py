@@ -44,5 +44,13 @@ configuration_discovery_time.yaml',
   datawriters:\n\
     - %%guid%% [""]\n\
   rate: %%rate%%\n\
-  dynamic_type_discovered: true\n"""
+  average_rate: %%rate%%\n\
+  dynamic_type_discovered: true\n\
+  bandwidth: %%rate%%\n\
+  payload_size:\n\
+    min: %%rate%%\n\
+    mean: %%rate%%\n\
+    max: %%rate%%\n\
+    histogram:\n\
+      %%rate%%\n"""
         )
@@ -97,6 +97,12 @@ configuration_discovery_time.yaml',
                 '\ttopics <name> keys v                        : '
                 'verbose information about keys '
                 'discovered in the network.\n\n'
+                '\ttopics <name> keys vv                       : '
+                'verbose information about each instance, '
+                'highest rate first.\n\n'
+                '\ttopics <name> latency                       : '
+                'Latency percentiles of the data of topics '
+                'matching <name>, by writer.\n\n'
                 '\tfilters                                     : '
                 'Display the active filters.\n\n'
                 '\tfilters clear                               : '
@@ -129,10 +135,40 @@ configuration_discovery_time.yaml',
                 '\techo all                                    : '
                 'verbose data of all topics '
                 '(only those whose Data Type is discovered).\n\n'
+                '\techo <name> --max-rate <Hz>                 : '
+                'data of at most <Hz> samples per second '
+                'of each Topic.\n\n'
+                '\techo <name> --every <N>                     : '
+                'data of one of every <N> samples '
+                'of each Topic.\n\n'
+                '\techo <name> last <N>                        : '
+                'data of the last <N> samples kept '
+                'of each Topic (history must be enabled).\n\n'
+                '\techo <name> fields <list>                   : '
+                'data of only the members in the comma separated <list> '
+                '(e.g. header.stamp,status) of each Topic.\n\n'
+                '\techo <name> --format <format>               : '
+                'data of each sample in a single ndjson, csv or cbor record '
+                'with its source info.\n\n'
+                '\trecord <name> <file>                        : '
+                'record the data of Topics matching the name '
+                '(wildcard allowed (*)) in <file>.\n\n'
+                '\trecord all <file>                           : '
+                'record the data of all topics in <file>.\n\n'
+                '\ttop                                         : '
+                'the 10 Topics with the highest rate, refreshed in place every second.\n\n'
+                '\ttop <N> --sort <key>                        : '
+                'the <N> Topics with the highest rate, bandwidth or writers (<key>).\n\n'
+                '\ttop --interval <ms>                         : '
+                'the most active Topics, refreshed in place every <ms> milliseconds.\n\n'
                 '\n\n'
                 'Notes and comments:\n\n'
                 '\tTo exit from data printing, press enter.\n\n'
-                '\tEach command is accessible by using its '
+                '\tTo stop recording, press enter.\n\n'
+                '\tTo exit from top, press enter.\n\n'
+                '\tEcho options --max-rate and --every can be combined, '
+                'and used with verbose and all.\n\n'
+                '\tEach command but record and top is accessible by using its '
                 'first letter (h/v/q/p/w/r/t/s/f).\n\n'
                 '\n\n'
                 'For more information about these commands and formats, '
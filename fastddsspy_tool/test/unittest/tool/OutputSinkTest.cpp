@@ -0,0 +1,195 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif // if defined(_WIN32)
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <tool/OutputSink.hpp>
+
+using namespace eprosima::spy;
+
+namespace test {
+
+#if defined(_WIN32)
+#define TEST_DUP _dup
+#define TEST_DUP2 _dup2
+#define TEST_FILENO _fileno
+#define TEST_CLOSE _close
+#else
+#define TEST_DUP dup
+#define TEST_DUP2 dup2
+#define TEST_FILENO fileno
+#define TEST_CLOSE close
+#endif // if defined(_WIN32)
+
+//! Redirects stdout to a file while it exists, so that what is written to it can be read
+class StdoutCapture
+{
+public:
+
+    StdoutCapture()
+        : path_(::testing::TempDir() + "OutputSinkTest_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".txt")
+    {
+        std::cout.flush();
+        std::fflush(stdout);
+
+        file_ = std::fopen(path_.c_str(), "wb");
+        saved_stdout_ = TEST_DUP(TEST_FILENO(stdout));
+        TEST_DUP2(TEST_FILENO(file_), TEST_FILENO(stdout));
+    }
+
+    ~StdoutCapture()
+    {
+        std::cout.flush();
+        std::fflush(stdout);
+
+        TEST_DUP2(saved_stdout_, TEST_FILENO(stdout));
+        TEST_CLOSE(saved_stdout_);
+        std::fclose(file_);
+        std::remove(path_.c_str());
+    }
+
+    //! Everything written to stdout so far
+    std::string output() const
+    {
+        std::ifstream file(path_, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+protected:
+
+    const std::string path_;
+
+    std::FILE* file_;
+
+    int saved_stdout_;
+};
+
+} /* namespace test */
+
+/**
+ * Output is kept in the buffer, and written at once when the sink is flushed.
+ */
+TEST(OutputSinkTest, batching)
+{
+    test::StdoutCapture capture;
+    OutputSink sink;
+
+    const auto start = std::chrono::steady_clock::now();
+    sink.write("first\n");
+    sink.write("second\n", 7);
+    sink.write(std::string("third\n"));
+
+    // NOTE: stdout is a file, so the output is only written by time once it is MAX_DELAY old
+    if (std::chrono::steady_clock::now() - start < OutputSink::MAX_DELAY)
+    {
+        ASSERT_TRUE(capture.output().empty());
+    }
+
+    sink.flush();
+    ASSERT_EQ(capture.output(), "first\nsecond\nthird\n");
+}
+
+/**
+ * The buffer is written as soon as it reaches FLUSH_SIZE.
+ */
+TEST(OutputSinkTest, flush_when_full)
+{
+    test::StdoutCapture capture;
+    OutputSink sink;
+
+    const std::string chunk(1024, 'a');
+    std::string expected;
+    while (expected.size() < OutputSink::FLUSH_SIZE)
+    {
+        sink.write(chunk);
+        expected += chunk;
+    }
+
+    ASSERT_EQ(capture.output(), expected);
+}
+
+/**
+ * Output is written by the background thread once it is MAX_DELAY old, without flushing the sink.
+ */
+TEST(OutputSinkTest, max_delay)
+{
+    test::StdoutCapture capture;
+    OutputSink sink;
+
+    const auto start = std::chrono::steady_clock::now();
+    sink.write("delayed\n");
+
+    std::string output;
+    while (output.empty() && std::chrono::steady_clock::now() - start < 20 * OutputSink::MAX_DELAY)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        output = capture.output();
+    }
+
+    ASSERT_EQ(output, "delayed\n");
+    ASSERT_GE(std::chrono::steady_clock::now() - start, OutputSink::MAX_DELAY);
+}
+
+/**
+ * A write too large for the buffer is written at once, after the output buffered before it.
+ */
+TEST(OutputSinkTest, large_write)
+{
+    test::StdoutCapture capture;
+    OutputSink sink;
+
+    const std::string large(OutputSink::FLUSH_SIZE, 'b');
+    sink.write("small\n");
+    sink.write(large);
+
+    ASSERT_EQ(capture.output(), "small\n" + large);
+}
+
+/**
+ * Output still buffered is written when the sink is destroyed.
+ */
+TEST(OutputSinkTest, flush_on_destruction)
+{
+    test::StdoutCapture capture;
+    {
+        OutputSink sink;
+        sink.write("last\n");
+    }
+
+    ASSERT_EQ(capture.output(), "last\n");
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
+
 #include <cpp_utils/types/Fuzzy.hpp>
 
 #include <ddspipe_core/configuration/CommandlineArgs.hpp>
@@ -56,6 +59,9 @@ struct FASTDDSSPY_YAML_DllAPI CommandlineArgsSpy : public ddspipe::core::Command
 
     // Domain
     utils::Fuzzy<ddspipe::core::types::DomainId> domain{0, utils::FuzzyLevelValues::fuzzy_level_default};
+
+    // Record file to load instead of spying on a domain (empty to spy on a domain)
+    std::string offline_file;
 };
 
 } /* namespace yaml */
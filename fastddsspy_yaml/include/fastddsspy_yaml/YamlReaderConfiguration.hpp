@@ -30,6 +30,10 @@
 #include <ddspipe_yaml/YamlReader.hpp>
 
 #include <fastddsspy_participants/configuration/SpyParticipantConfiguration.hpp>
+#include <fastddsspy_participants/model/DataDispatcher.hpp>
+#include <fastddsspy_participants/model/InstanceCache.hpp>
+#include <fastddsspy_participants/model/SampleHistory.hpp>
+#include <fastddsspy_participants/model/TopicRateCalculator.hpp>
 #include <fastddsspy_participants/types/EndpointInfo.hpp>
 #include <fastddsspy_participants/types/ParticipantInfo.hpp>
 
@@ -82,8 +86,23 @@ public:
     // Specs
     unsigned int n_threads = 12;
     utils::Duration_ms one_shot_wait_time_ms = 1000;
+    utils::Duration_ms rate_window_ms = participants::TopicRateCalculator::DEFAULT_RATE_WINDOW_MS;
     ddspipe::core::types::TopicQoS topic_qos{};
 
+    // Echo
+    unsigned int echo_queue_size = participants::DataDispatcher::DEFAULT_QUEUE_SIZE;
+    participants::DropPolicy echo_drop_policy = participants::DropPolicy::drop_oldest;
+    unsigned int echo_threads = participants::DataDispatcher::DEFAULT_THREADS;
+
+    // History (disabled with depth 0)
+    unsigned int history_depth = 0;
+    unsigned int history_max_memory = participants::SampleHistory::DEFAULT_MAX_MEMORY;
+
+    // Instances
+    unsigned int instances_max_per_topic = participants::InstanceCache::DEFAULT_MAX_INSTANCES_PER_TOPIC;
+    unsigned int instances_max_total = participants::InstanceCache::DEFAULT_MAX_INSTANCES;
+    unsigned int instances_max_memory = participants::InstanceCache::DEFAULT_MAX_MEMORY;
+
 protected:
 
     void load_configuration_(
@@ -94,6 +113,18 @@ protected:
             const Yaml& yml,
             const ddspipe::yaml::YamlReaderVersion& version);
 
+    void load_echo_configuration_(
+            const Yaml& yml,
+            const ddspipe::yaml::YamlReaderVersion& version);
+
+    void load_history_configuration_(
+            const Yaml& yml,
+            const ddspipe::yaml::YamlReaderVersion& version);
+
+    void load_instances_configuration_(
+            const Yaml& yml,
+            const ddspipe::yaml::YamlReaderVersion& version);
+
     void load_dds_configuration_(
             const Yaml& yml,
             const ddspipe::yaml::YamlReaderVersion& version);
@@ -87,6 +87,12 @@ void set(
         Yaml& yml,
         const ComplexEndpointData::QoS& value);
 
+template <>
+FASTDDSSPY_YAML_DllAPI
+void set(
+        Yaml& yml,
+        const SamplesData& value);
+
 template <>
 FASTDDSSPY_YAML_DllAPI
 void set(
@@ -99,6 +105,12 @@ void set(
         Yaml& yml,
         const SimpleTopicData::Rate& value);
 
+template <>
+FASTDDSSPY_YAML_DllAPI
+void set(
+        Yaml& yml,
+        const PayloadSizeData& value);
+
 template <>
 FASTDDSSPY_YAML_DllAPI
 void set(
@@ -112,18 +124,54 @@ void set(
         Yaml& yml,
         const ComplexTopicData::Endpoint& value);
 
+template <>
+FASTDDSSPY_YAML_DllAPI
+void set(
+        Yaml& yml,
+        const ComplexTopicData::WriterTraffic& value);
+
 template <>
 FASTDDSSPY_YAML_DllAPI
 void set(
         Yaml& yml,
         const ComplexTopicData& value);
 
+template <>
+FASTDDSSPY_YAML_DllAPI
+void set(
+        Yaml& yml,
+        const LatencyData& value);
+
+template <>
+FASTDDSSPY_YAML_DllAPI
+void set(
+        Yaml& yml,
+        const TopicLatencyData::Writer& value);
+
+template <>
+FASTDDSSPY_YAML_DllAPI
+void set(
+        Yaml& yml,
+        const TopicLatencyData& value);
+
+template <>
+FASTDDSSPY_YAML_DllAPI
+void set(
+        Yaml& yml,
+        const TopTopicData& value);
+
 template <>
 FASTDDSSPY_YAML_DllAPI
 void set(
         Yaml& yml,
         const DdsDataData& value);
 
+template <>
+FASTDDSSPY_YAML_DllAPI
+void set(
+        Yaml& yml,
+        const TopicKeysData::Evictions& value);
+
 template <>
 FASTDDSSPY_YAML_DllAPI
 void set(
@@ -131,6 +179,18 @@ void set(
         const TopicKeysData& value,
         bool is_compact);
 
+template <>
+FASTDDSSPY_YAML_DllAPI
+void set(
+        Yaml& yml,
+        const InstanceData& value);
+
+template <>
+FASTDDSSPY_YAML_DllAPI
+void set(
+        Yaml& yml,
+        const TopicInstancesData& value);
+
 } /* namespace yaml */
 } /* namespace ddspipe */
 } /* namespace eprosima */
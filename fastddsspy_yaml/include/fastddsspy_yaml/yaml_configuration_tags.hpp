@@ -36,6 +36,24 @@ constexpr const char* FASTDDSSPY_PROFILE_TAG("dds-profile");
 // Specs related tags
 ////////////////////////
 constexpr const char* GATHERING_TIME_TAG("discovery-time");
+constexpr const char* RATE_WINDOW_TAG("rate-window");
+
+constexpr const char* ECHO_TAG("echo");
+constexpr const char* ECHO_QUEUE_SIZE_TAG("queue-size");
+constexpr const char* ECHO_THREADS_TAG("threads");
+constexpr const char* ECHO_DROP_POLICY_TAG("drop-policy");
+constexpr const char* ECHO_DROP_POLICY_DROP_OLDEST_TAG("drop-oldest");
+constexpr const char* ECHO_DROP_POLICY_DROP_NEWEST_TAG("drop-newest");
+constexpr const char* ECHO_DROP_POLICY_BLOCK_TAG("block");
+
+constexpr const char* HISTORY_TAG("history");
+constexpr const char* HISTORY_DEPTH_TAG("depth");
+constexpr const char* HISTORY_MAX_MEMORY_TAG("max-memory");
+
+constexpr const char* INSTANCES_TAG("instances");
+constexpr const char* INSTANCES_MAX_PER_TOPIC_TAG("max-per-topic");
+constexpr const char* INSTANCES_MAX_TOTAL_TAG("max-total");
+constexpr const char* INSTANCES_MAX_MEMORY_TAG("max-memory");
 
 } /* namespace yaml */
 } /* namespace spy */
@@ -286,6 +286,12 @@ void Configuration::load_specs_configuration_(
         one_shot_wait_time_ms = YamlReader::get<utils::Duration_ms>(yml, GATHERING_TIME_TAG, version);
     }
 
+    // Get optional rate window
+    if (YamlReader::is_tag_present(yml, RATE_WINDOW_TAG))
+    {
+        rate_window_ms = YamlReader::get<utils::Duration_ms>(yml, RATE_WINDOW_TAG, version);
+    }
+
     // Get optional rtps enabled
     if (YamlReader::is_tag_present(yml, RTPS_ENABLED_TAG))
     {
@@ -299,6 +305,96 @@ void Configuration::load_specs_configuration_(
         ddspipe_configuration.log_configuration = YamlReader::get<DdsPipeLogConfiguration>(yml, LOG_CONFIGURATION_TAG,
                         version);
     }
+
+    /////
+    // Get optional echo configuration
+    if (YamlReader::is_tag_present(yml, ECHO_TAG))
+    {
+        load_echo_configuration_(YamlReader::get_value_in_tag(yml, ECHO_TAG), version);
+    }
+
+    /////
+    // Get optional history configuration
+    if (YamlReader::is_tag_present(yml, HISTORY_TAG))
+    {
+        load_history_configuration_(YamlReader::get_value_in_tag(yml, HISTORY_TAG), version);
+    }
+
+    /////
+    // Get optional instances configuration
+    if (YamlReader::is_tag_present(yml, INSTANCES_TAG))
+    {
+        load_instances_configuration_(YamlReader::get_value_in_tag(yml, INSTANCES_TAG), version);
+    }
+}
+
+void Configuration::load_echo_configuration_(
+        const Yaml& yml,
+        const ddspipe::yaml::YamlReaderVersion& version)
+{
+    // Get optional queue size
+    if (YamlReader::is_tag_present(yml, ECHO_QUEUE_SIZE_TAG))
+    {
+        echo_queue_size = YamlReader::get<unsigned int>(yml, ECHO_QUEUE_SIZE_TAG, version);
+    }
+
+    // Get optional number of threads
+    if (YamlReader::is_tag_present(yml, ECHO_THREADS_TAG))
+    {
+        echo_threads = YamlReader::get<unsigned int>(yml, ECHO_THREADS_TAG, version);
+    }
+
+    // Get optional drop policy
+    if (YamlReader::is_tag_present(yml, ECHO_DROP_POLICY_TAG))
+    {
+        echo_drop_policy = YamlReader::get_enumeration<participants::DropPolicy>(
+            YamlReader::get_value_in_tag(yml, ECHO_DROP_POLICY_TAG),
+            {
+                {ECHO_DROP_POLICY_DROP_OLDEST_TAG, participants::DropPolicy::drop_oldest},
+                {ECHO_DROP_POLICY_DROP_NEWEST_TAG, participants::DropPolicy::drop_newest},
+                {ECHO_DROP_POLICY_BLOCK_TAG, participants::DropPolicy::block},
+            });
+    }
+}
+
+void Configuration::load_history_configuration_(
+        const Yaml& yml,
+        const ddspipe::yaml::YamlReaderVersion& version)
+{
+    // Get optional depth
+    if (YamlReader::is_tag_present(yml, HISTORY_DEPTH_TAG))
+    {
+        history_depth = YamlReader::get<unsigned int>(yml, HISTORY_DEPTH_TAG, version);
+    }
+
+    // Get optional maximum memory
+    if (YamlReader::is_tag_present(yml, HISTORY_MAX_MEMORY_TAG))
+    {
+        history_max_memory = YamlReader::get<unsigned int>(yml, HISTORY_MAX_MEMORY_TAG, version);
+    }
+}
+
+void Configuration::load_instances_configuration_(
+        const Yaml& yml,
+        const ddspipe::yaml::YamlReaderVersion& version)
+{
+    // Get optional maximum instances of each topic
+    if (YamlReader::is_tag_present(yml, INSTANCES_MAX_PER_TOPIC_TAG))
+    {
+        instances_max_per_topic = YamlReader::get<unsigned int>(yml, INSTANCES_MAX_PER_TOPIC_TAG, version);
+    }
+
+    // Get optional maximum instances of all topics
+    if (YamlReader::is_tag_present(yml, INSTANCES_MAX_TOTAL_TAG))
+    {
+        instances_max_total = YamlReader::get<unsigned int>(yml, INSTANCES_MAX_TOTAL_TAG, version);
+    }
+
+    // Get optional maximum memory
+    if (YamlReader::is_tag_present(yml, INSTANCES_MAX_MEMORY_TAG))
+    {
+        instances_max_memory = YamlReader::get<unsigned int>(yml, INSTANCES_MAX_MEMORY_TAG, version);
+    }
 }
 
 void Configuration::load_configuration_from_file_(
@@ -345,6 +441,48 @@ bool Configuration::is_valid(
         error_msg << "Must be at least 1 thread. ";
         return false;
     }
+
+    if (rate_window_ms < 1)
+    {
+        error_msg << "Rate window must be at least 1 millisecond. ";
+        return false;
+    }
+
+    if (echo_queue_size < 1)
+    {
+        error_msg << "Echo queue size must be at least 1. ";
+        return false;
+    }
+
+    if (echo_threads < 1)
+    {
+        error_msg << "Must be at least 1 echo thread. ";
+        return false;
+    }
+
+    if (history_depth > 0 && history_max_memory < 1)
+    {
+        error_msg << "History maximum memory must be at least 1 byte. ";
+        return false;
+    }
+
+    if (instances_max_per_topic < 1)
+    {
+        error_msg << "Must keep at least 1 instance of each topic. ";
+        return false;
+    }
+
+    if (instances_max_total < 1)
+    {
+        error_msg << "Must keep at least 1 instance of all topics. ";
+        return false;
+    }
+
+    if (instances_max_memory < 1)
+    {
+        error_msg << "Instances maximum memory must be at least 1 byte. ";
+        return false;
+    }
     return true;
 }
 
@@ -221,6 +221,28 @@ void set(
     }
 }
 
+template <>
+void set(
+        Yaml& yml,
+        const SamplesData& value)
+{
+    yml["received"] = value.received;
+    yml["lost"] = value.lost;
+
+    utils::Formatter f;
+    f << value.loss << " " << value.loss_unit;
+    set_in_tag(yml, "loss", f.to_string());
+
+    yml["out_of_order"] = value.out_of_order;
+    yml["duplicates"] = value.duplicates;
+
+    // Only live samples have jitter
+    if (value.jitter.samples > 0)
+    {
+        set_in_tag(yml, "jitter", value.jitter);
+    }
+}
+
 template <>
 void set(
         Yaml& yml,
@@ -230,6 +252,12 @@ void set(
     set_in_tag(yml, "participant", value.participant_name);
     set_in_tag(yml, "topic", value.topic);
     set_in_tag(yml, "qos", value.qos);
+
+    // Only writers whose samples have been received
+    if (value.samples.received > 0)
+    {
+        set_in_tag(yml, "samples", value.samples);
+    }
 }
 
 template <>
@@ -242,6 +270,36 @@ void set(
     set(yml, f.to_string());
 }
 
+template <>
+void set(
+        Yaml& yml,
+        const PayloadSizeData& value)
+{
+    auto set_size_in_tag = [&yml, &value](const std::string& tag, double size)
+            {
+                utils::Formatter f;
+                f << size << " " << value.unit;
+                set_in_tag(yml, tag, f.to_string());
+            };
+
+    set_size_in_tag("min", value.min);
+    set_size_in_tag("mean", value.mean);
+    set_size_in_tag("max", value.max);
+
+    if (!value.histogram.empty())
+    {
+        // Sizes of each bucket, as "<lower>-<upper> B: <count>"
+        Yaml histogram;
+        for (const auto& bucket : value.histogram)
+        {
+            utils::Formatter f;
+            f << bucket.lower_bound << "-" << bucket.upper_bound << " " << value.unit;
+            histogram[f.to_string()] = bucket.count;
+        }
+        yml["histogram"] = histogram;
+    }
+}
+
 template <>
 void set(
         Yaml& yml,
@@ -265,6 +323,9 @@ void set(
         set_in_tag(yml, "datawriters", value.datawriters);
         set_in_tag(yml, "datareaders", value.datareaders);
         set_in_tag(yml, "rate", value.rate);
+        set_in_tag(yml, "average_rate", value.average_rate);
+        set_in_tag(yml, "bandwidth", value.bandwidth);
+        set_in_tag(yml, "payload_size", value.payload_size);
     }
 }
 
@@ -282,6 +343,21 @@ void set(
     set(yml, guid_and_partition);
 }
 
+template <>
+void set(
+        Yaml& yml,
+        const ComplexTopicData::WriterTraffic& value)
+{
+    set_in_tag(yml, "guid", value.guid);
+    set_in_tag(yml, "bandwidth", value.bandwidth);
+    set_in_tag(yml, "payload_size", value.payload_size);
+
+    if (value.samples.received > 0)
+    {
+        set_in_tag(yml, "samples", value.samples);
+    }
+}
+
 template <>
 void set(
         Yaml& yml,
@@ -292,7 +368,63 @@ void set(
     set_in_tag(yml, "datawriters", value.datawriters);
     set_in_tag(yml, "datareaders", value.datareaders);
     set_in_tag(yml, "rate", value.rate);
+    set_in_tag(yml, "average_rate", value.average_rate);
     set_in_tag(yml, "dynamic_type_discovered", value.discovered);
+    set_in_tag(yml, "bandwidth", value.bandwidth);
+    set_in_tag(yml, "payload_size", value.payload_size);
+    set_in_tag(yml, "datawriters_traffic", value.datawriters_traffic);
+}
+
+template <>
+void set(
+        Yaml& yml,
+        const LatencyData& value)
+{
+    auto set_latency_in_tag = [&yml, &value](const std::string& tag, double latency)
+            {
+                utils::Formatter f;
+                f << latency << " " << value.unit;
+                set_in_tag(yml, tag, f.to_string());
+            };
+
+    yml["samples"] = value.samples;
+    set_latency_in_tag("mean", value.mean);
+    set_latency_in_tag("p50", value.p50);
+    set_latency_in_tag("p90", value.p90);
+    set_latency_in_tag("p99", value.p99);
+    set_latency_in_tag("p99.9", value.p999);
+    set_latency_in_tag("max", value.max);
+}
+
+template <>
+void set(
+        Yaml& yml,
+        const TopicLatencyData::Writer& value)
+{
+    set_in_tag(yml, "guid", value.guid);
+    set_in_tag(yml, "latency", value.latency);
+}
+
+template <>
+void set(
+        Yaml& yml,
+        const TopicLatencyData& value)
+{
+    set_in_tag(yml, "name", value.name);
+    set_in_tag(yml, "type", value.type);
+    set_in_tag(yml, "latency", value.latency);
+    set_in_tag(yml, "datawriters", value.datawriters);
+}
+
+template <>
+void set(
+        Yaml& yml,
+        const TopTopicData& value)
+{
+    set_in_tag(yml, "name", value.name);
+    set_in_tag(yml, "rate", value.rate);
+    set_in_tag(yml, "bandwidth", value.bandwidth);
+    set_in_tag(yml, "datawriters", value.datawriters);
 }
 
 template <>
@@ -306,6 +438,16 @@ void set(
     set_in_tag(yml, "timestamp", value.timestamp);
 }
 
+template <>
+void set(
+        Yaml& yml,
+        const TopicKeysData::Evictions& value)
+{
+    yml["per_topic_limit"] = value.per_topic_limit;
+    yml["total_limit"] = value.total_limit;
+    yml["memory_limit"] = value.memory_limit;
+}
+
 template <>
 void set(
         Yaml& yml,
@@ -347,6 +489,56 @@ void set(
         }
     }
     yml["instance_count"] = value.instance_count;
+    if (!is_compact)
+    {
+        set_in_tag(yml, "evictions", value.evictions);
+    }
+}
+
+template <>
+void set(
+        Yaml& yml,
+        const InstanceData& value)
+{
+    try
+    {
+        yml["key"] = json_to_yaml(nlohmann::json::parse(value.key));
+    }
+    catch (const std::exception& e)
+    {
+        set_in_tag(yml, "key", value.key);
+    }
+    set_in_tag(yml, "state", value.state);
+    yml["writers"] = value.writers;
+    yml["samples"] = value.samples;
+    set_in_tag(yml, "rate", value.rate);
+    set_in_tag(yml, "payload_size", value.payload_size);
+}
+
+template <>
+void set(
+        Yaml& yml,
+        const TopicInstancesData& value)
+{
+    set_in_tag(yml, "topic", value.topic_name);
+    if (value.key_fields.empty())
+    {
+        yml["keys"] = YAML::Node(YAML::NodeType:: Sequence);
+    }
+    else
+    {
+        set_in_tag(yml, "keys", value.key_fields);
+    }
+    if (value.instances.empty())
+    {
+        yml["instances"] = YAML::Node(YAML::NodeType:: Sequence);
+    }
+    else
+    {
+        set_in_tag(yml, "instances", value.instances);
+    }
+    yml["instance_count"] = value.instances.size();
+    set_in_tag(yml, "evictions", value.evictions);
 }
 
 } /* namespace yaml */
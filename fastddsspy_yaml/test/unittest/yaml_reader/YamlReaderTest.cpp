@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cpp_utils/exception/ConfigurationException.hpp>
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -60,6 +61,276 @@ TEST(YamlReaderTest, get_spy_configuration_trivial)
     ASSERT_EQ(configuration.dds_configuration->easy_mode_ip, "127.0.0.1");
 }
 
+/**
+ * Test load the echo specs from yaml node.
+ *
+ * CASES:
+ *  - Default values when not set
+ *  - Queue size, threads and drop policy set
+ *  - Unknown drop policy
+ *  - No echo threads
+ */
+TEST(YamlReaderTest, get_spy_configuration_echo)
+{
+    // Default values
+    {
+        Yaml yml = YAML::Load("version: v4.0");
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        ASSERT_EQ(configuration.echo_queue_size, DataDispatcher::DEFAULT_QUEUE_SIZE);
+        ASSERT_EQ(configuration.echo_threads, DataDispatcher::DEFAULT_THREADS);
+        ASSERT_EQ(configuration.echo_drop_policy, DropPolicy::drop_oldest);
+    }
+
+    // Values set
+    {
+        const char* yml_str =
+                R"(
+                specs:
+                    echo:
+                        queue-size: 16
+                        threads: 8
+                        drop-policy: block
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration.is_valid(error_msg));
+        ASSERT_EQ(configuration.echo_queue_size, 16u);
+        ASSERT_EQ(configuration.echo_threads, 8u);
+        ASSERT_EQ(configuration.echo_drop_policy, DropPolicy::block);
+    }
+
+    // Unknown drop policy
+    {
+        const char* yml_str =
+                R"(
+                specs:
+                    echo:
+                        drop-policy: drop-random
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+        ASSERT_THROW(eprosima::spy::yaml::Configuration configuration(yml), utils::ConfigurationException);
+    }
+
+    // No echo threads
+    {
+        const char* yml_str =
+                R"(
+                specs:
+                    echo:
+                        threads: 0
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the history specs from yaml node.
+ *
+ * CASES:
+ *  - Disabled when not set
+ *  - Depth and maximum memory set
+ *  - No memory for an enabled history
+ */
+TEST(YamlReaderTest, get_spy_configuration_history)
+{
+    // Default values
+    {
+        Yaml yml = YAML::Load("version: v4.0");
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        ASSERT_EQ(configuration.history_depth, 0u);
+        ASSERT_EQ(configuration.history_max_memory, SampleHistory::DEFAULT_MAX_MEMORY);
+    }
+
+    // Values set
+    {
+        const char* yml_str =
+                R"(
+                specs:
+                    history:
+                        depth: 50
+                        max-memory: 1048576
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration.is_valid(error_msg));
+        ASSERT_EQ(configuration.history_depth, 50u);
+        ASSERT_EQ(configuration.history_max_memory, 1048576u);
+    }
+
+    // No memory
+    {
+        const char* yml_str =
+                R"(
+                specs:
+                    history:
+                        depth: 50
+                        max-memory: 0
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the instances specs from yaml node.
+ *
+ * CASES:
+ *  - Default when not set
+ *  - Limits set
+ *  - No instances of each topic
+ *  - No instances of all topics
+ *  - No memory
+ */
+TEST(YamlReaderTest, get_spy_configuration_instances)
+{
+    // Default values
+    {
+        Yaml yml = YAML::Load("version: v4.0");
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        ASSERT_EQ(configuration.instances_max_per_topic, InstanceCache::DEFAULT_MAX_INSTANCES_PER_TOPIC);
+        ASSERT_EQ(configuration.instances_max_total, InstanceCache::DEFAULT_MAX_INSTANCES);
+        ASSERT_EQ(configuration.instances_max_memory, InstanceCache::DEFAULT_MAX_MEMORY);
+    }
+
+    // Values set
+    {
+        const char* yml_str =
+                R"(
+                specs:
+                    instances:
+                        max-per-topic: 50000
+                        max-total: 200000
+                        max-memory: 33554432
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration.is_valid(error_msg));
+        ASSERT_EQ(configuration.instances_max_per_topic, 50000u);
+        ASSERT_EQ(configuration.instances_max_total, 200000u);
+        ASSERT_EQ(configuration.instances_max_memory, 33554432u);
+    }
+
+    // No instances of each topic
+    {
+        const char* yml_str =
+                R"(
+                specs:
+                    instances:
+                        max-per-topic: 0
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration.is_valid(error_msg));
+    }
+
+    // No instances of all topics
+    {
+        const char* yml_str =
+                R"(
+                specs:
+                    instances:
+                        max-total: 0
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration.is_valid(error_msg));
+    }
+
+    // No memory
+    {
+        const char* yml_str =
+                R"(
+                specs:
+                    instances:
+                        max-memory: 0
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test load the rate window specs from yaml node.
+ *
+ * CASES:
+ *  - Default when not set
+ *  - Window set
+ *  - Empty window
+ */
+TEST(YamlReaderTest, get_spy_configuration_rate_window)
+{
+    // Default values
+    {
+        Yaml yml = YAML::Load("version: v4.0");
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        ASSERT_EQ(configuration.rate_window_ms, TopicRateCalculator::DEFAULT_RATE_WINDOW_MS);
+    }
+
+    // Values set
+    {
+        const char* yml_str =
+                R"(
+                specs:
+                    rate-window: 2000
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_TRUE(configuration.is_valid(error_msg));
+        ASSERT_EQ(configuration.rate_window_ms, 2000u);
+    }
+
+    // Empty window
+    {
+        const char* yml_str =
+                R"(
+                specs:
+                    rate-window: 0
+            )";
+
+        Yaml yml = YAML::Load(yml_str);
+        eprosima::spy::yaml::Configuration configuration(yml);
+
+        utils::Formatter error_msg;
+        ASSERT_FALSE(configuration.is_valid(error_msg));
+    }
+}
+
 int main(
         int argc,
         char** argv)
@@ -168,6 +168,52 @@ TEST(YamlWriterTest, test_ComplexEndpointData)
         );
 }
 
+/**
+ * Convert a ComplexEndpointData of a writer whose samples have been received to yaml
+ */
+TEST(YamlWriterTest, test_ComplexEndpointData_samples)
+{
+    ddspipe::core::types::Guid guid = ddspipe::core::types::Guid::new_unique_guid();
+    ComplexEndpointData data;
+    data.guid = guid;
+    data.participant_name = "Name";
+    data.topic = {"topic_name", "topic_type", "partition"};
+    data.qos = {};
+    data.samples = {300, 100, 2, 1, 25, "%", {299, 0.5, 0.25, 1, 2, 4, 8, "ms"}};
+
+    // Set yaml using set
+    Yaml yml;
+    set(yml, data);
+
+    // Set yaml using Yaml functions
+    Yaml yml_expected;
+    yml_expected["guid"] = utils::generic_to_string(guid);
+    yml_expected["participant"] = "Name";
+    yml_expected["topic"]["name"] = "topic_name";
+    yml_expected["topic"]["type"] = "topic_type";
+    yml_expected["topic"]["partitions"] = "partition";
+    yml_expected["qos"]["durability"] = "volatile";
+    yml_expected["qos"]["reliability"] = "reliable";
+    yml_expected["samples"]["received"] = 300;
+    yml_expected["samples"]["lost"] = 100;
+    yml_expected["samples"]["loss"] = "25 %";
+    yml_expected["samples"]["out_of_order"] = 2;
+    yml_expected["samples"]["duplicates"] = 1;
+    yml_expected["samples"]["jitter"]["samples"] = 299;
+    yml_expected["samples"]["jitter"]["mean"] = "0.5 ms";
+    yml_expected["samples"]["jitter"]["p50"] = "0.25 ms";
+    yml_expected["samples"]["jitter"]["p90"] = "1 ms";
+    yml_expected["samples"]["jitter"]["p99"] = "2 ms";
+    yml_expected["samples"]["jitter"]["p99.9"] = "4 ms";
+    yml_expected["samples"]["jitter"]["max"] = "8 ms";
+
+    // Check they are the same
+    ASSERT_EQ(
+        utils::generic_to_string(yml),
+        utils::generic_to_string(yml_expected)
+        );
+}
+
 /**
  * Convert a SimpleTopicData to yaml (is_compact = false)
  */
@@ -180,6 +226,9 @@ TEST(YamlWriterTest, test_SimpleTopicData_compact_false)
     data.datawriters = 1;
     data.datareaders = 0;
     data.rate = {15, "Hz"};
+    data.average_rate = {12.5, "Hz"};
+    data.bandwidth = {960, "B/s"};
+    data.payload_size = {48, 64, 80, "B", {}};
 
     // Set yaml using set
     Yaml yml;
@@ -192,6 +241,11 @@ TEST(YamlWriterTest, test_SimpleTopicData_compact_false)
     yml_expected["datawriters"] = "1";
     yml_expected["datareaders"] = "0";
     yml_expected["rate"] = "15 Hz";
+    yml_expected["average_rate"] = "12.5 Hz";
+    yml_expected["bandwidth"] = "960 B/s";
+    yml_expected["payload_size"]["min"] = "48 B";
+    yml_expected["payload_size"]["mean"] = "64 B";
+    yml_expected["payload_size"]["max"] = "80 B";
 
     // Check they are the same
     ASSERT_EQ(
@@ -212,6 +266,9 @@ TEST(YamlWriterTest, test_SimpleTopicData_compact_true)
     data.datawriters = 1;
     data.datareaders = 0;
     data.rate = {15, "Hz"};
+    data.average_rate = {12.5, "Hz"};
+    data.bandwidth = {960, "B/s"};
+    data.payload_size = {48, 64, 80, "B", {}};
 
     // Set yaml using set
     Yaml yml;
@@ -245,7 +302,11 @@ TEST(YamlWriterTest, test_ComplexTopicData)
     data.datawriters = {{guid, "partition"}};
     data.datareaders = {};
     data.rate = {15, "Hz"};
+    data.average_rate = {12.5, "Hz"};
+    data.bandwidth = {960, "B/s"};
+    data.payload_size = {48, 64, 80, "B", {{32, 63, 1}, {64, 127, 2}}};
     data.discovered = true;
+    data.datawriters_traffic = {{guid, {960, "B/s"}, {48, 64, 80, "B", {{32, 63, 1}, {64, 127, 2}}}}};
 
     // Set yaml using set
     Yaml yml;
@@ -258,7 +319,51 @@ TEST(YamlWriterTest, test_ComplexTopicData)
     yml_expected["datawriters"].push_back(guid_str + " [partition]");
     yml_expected["datareaders"];
     yml_expected["rate"] = "15 Hz";
+    yml_expected["average_rate"] = "12.5 Hz";
     yml_expected["dynamic_type_discovered"] = true;
+    Yaml payload_size;
+    payload_size["min"] = "48 B";
+    payload_size["mean"] = "64 B";
+    payload_size["max"] = "80 B";
+    payload_size["histogram"]["32-63 B"] = 1;
+    payload_size["histogram"]["64-127 B"] = 2;
+    yml_expected["bandwidth"] = "960 B/s";
+    yml_expected["payload_size"] = payload_size;
+    Yaml writer_traffic;
+    writer_traffic["guid"] = guid_str;
+    writer_traffic["bandwidth"] = "960 B/s";
+    writer_traffic["payload_size"] = YAML::Clone(payload_size);
+    yml_expected["datawriters_traffic"].push_back(writer_traffic);
+
+    // Check they are the same
+    ASSERT_EQ(
+        utils::generic_to_string(yml),
+        utils::generic_to_string(yml_expected)
+        );
+}
+
+/**
+ * Convert a TopTopicData to yaml
+ */
+TEST(YamlWriterTest, test_TopTopicData)
+{
+    TopTopicData data;
+
+    data.name = "Name";
+    data.datawriters = 2;
+    data.rate = {15, "Hz"};
+    data.bandwidth = {960, "B/s"};
+
+    // Set yaml using set
+    Yaml yml;
+    set(yml, data);
+
+    // Set yaml using Yaml functions
+    Yaml yml_expected;
+    yml_expected["name"] = "Name";
+    yml_expected["rate"] = "15 Hz";
+    yml_expected["bandwidth"] = "960 B/s";
+    yml_expected["datawriters"] = "2";
 
     // Check they are the same
     ASSERT_EQ(
@@ -352,6 +457,9 @@ TEST(YamlWriterTest, test_TopicKeysData_compact_false)
         R"({"Key1":"Value1", "Key2":"Value3"})"
     };
     data.instance_count = 2;
+    data.evictions.per_topic_limit = 3;
+    data.evictions.total_limit = 2;
+    data.evictions.memory_limit = 1;
 
     // Set yaml using set
     Yaml yml;
@@ -367,6 +475,9 @@ TEST(YamlWriterTest, test_TopicKeysData_compact_false)
     yml_expected["instances"][1]["Key1"] = "Value1";
     yml_expected["instances"][1]["Key2"] = "Value3";
     yml_expected["instance_count"] = 2;
+    yml_expected["evictions"]["per_topic_limit"] = 3;
+    yml_expected["evictions"]["total_limit"] = 2;
+    yml_expected["evictions"]["memory_limit"] = 1;
 
     // Check they are the same
     ASSERT_EQ(
@@ -546,6 +657,69 @@ TEST(YamlWriterTest, test_TopicKeysData_json_malformed)
     yml_expected["instances"][0] = "MALFORMED JSON";
     yml_expected["instances"][1] = "{ALSO MALFORMED JSON}";
     yml_expected["instance_count"] = 2;
+    yml_expected["evictions"]["per_topic_limit"] = 0;
+    yml_expected["evictions"]["total_limit"] = 0;
+    yml_expected["evictions"]["memory_limit"] = 0;
+
+    // Check they are the same
+    ASSERT_EQ(
+        utils::generic_to_string(yml),
+        utils::generic_to_string(yml_expected)
+        );
+}
+
+/**
+ * Convert a TopicInstancesData to yaml
+ */
+TEST(YamlWriterTest, test_TopicInstancesData)
+{
+    TopicInstancesData data;
+
+    data.topic_name = "Name";
+    data.key_fields = {"Key1"};
+
+    InstanceData instance;
+    instance.key = R"({"Key1":"Value1"})";
+    instance.state = "alive";
+    instance.writers = 2;
+    instance.samples = 30;
+    instance.rate = {10, "Hz"};
+    instance.payload_size = {28, "B"};
+    data.instances.push_back(instance);
+
+    instance.key = "MALFORMED JSON";
+    instance.state = "no_writers";
+    instance.writers = 0;
+    instance.samples = 5;
+    instance.rate = {0, "Hz"};
+    data.instances.push_back(instance);
+
+    data.evictions.per_topic_limit = 3;
+
+    // Set yaml using set
+    Yaml yml;
+    set(yml, data);
+
+    // Set yaml using Yaml functions
+    Yaml yml_expected;
+    yml_expected["topic"] = "Name";
+    yml_expected["keys"][0] = "Key1";
+    yml_expected["instances"][0]["key"]["Key1"] = "Value1";
+    yml_expected["instances"][0]["state"] = "alive";
+    yml_expected["instances"][0]["writers"] = 2;
+    yml_expected["instances"][0]["samples"] = 30;
+    yml_expected["instances"][0]["rate"] = "10 Hz";
+    yml_expected["instances"][0]["payload_size"] = "28 B";
+    yml_expected["instances"][1]["key"] = "MALFORMED JSON";
+    yml_expected["instances"][1]["state"] = "no_writers";
+    yml_expected["instances"][1]["writers"] = 0;
+    yml_expected["instances"][1]["samples"] = 5;
+    yml_expected["instances"][1]["rate"] = "0 Hz";
+    yml_expected["instances"][1]["payload_size"] = "28 B";
+    yml_expected["instance_count"] = 2;
+    yml_expected["evictions"]["per_topic_limit"] = 3;
+    yml_expected["evictions"]["total_limit"] = 0;
+    yml_expected["evictions"]["memory_limit"] = 0;
 
     // Check they are the same
     ASSERT_EQ(